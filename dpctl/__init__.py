@@ -52,6 +52,7 @@ from ._sycl_queue import (
     LocalAccessor,
     RawKernelArg,
     SyclKernelInvalidRangeError,
+    SyclKernelLaunch,
     SyclKernelSubmitError,
     SyclQueue,
     SyclQueueCreationError,
@@ -103,6 +104,7 @@ __all__ += [
 __all__ += [
     "SyclQueue",
     "SyclKernelInvalidRangeError",
+    "SyclKernelLaunch",
     "SyclKernelSubmitError",
     "SyclQueueCreationError",
     "WorkGroupMemory",
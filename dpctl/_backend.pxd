@@ -137,6 +137,7 @@ cdef extern from "syclinterface/dpctl_sycl_types.h":
     cdef struct DPCTLOpaqueSyclKernel
     cdef struct DPCTLOpaqueSyclPlatform
     cdef struct DPCTLOpaqueSyclKernelBundle
+    cdef struct DPCTLOpaqueSyclKernelLaunch
     cdef struct DPCTLOpaqueSyclQueue
     cdef struct DPCTLOpaqueSyclUSM
 
@@ -147,6 +148,7 @@ cdef extern from "syclinterface/dpctl_sycl_types.h":
     ctypedef DPCTLOpaqueSyclKernel *DPCTLSyclKernelRef
     ctypedef DPCTLOpaqueSyclPlatform *DPCTLSyclPlatformRef
     ctypedef DPCTLOpaqueSyclKernelBundle *DPCTLSyclKernelBundleRef
+    ctypedef DPCTLOpaqueSyclKernelLaunch *DPCTLSyclKernelLaunchRef
     ctypedef DPCTLOpaqueSyclQueue *DPCTLSyclQueueRef
     ctypedef DPCTLOpaqueSyclUSM *DPCTLSyclUSMRef
 
@@ -451,6 +453,17 @@ cdef extern from "syclinterface/dpctl_sycl_kernel_bundle_interface.h":
     cdef void DPCTLKernelBundle_Delete(DPCTLSyclKernelBundleRef KBRef)
     cdef DPCTLSyclKernelBundleRef DPCTLKernelBundle_Copy(
         const DPCTLSyclKernelBundleRef KBRef)
+    cdef void DPCTLKernelBundle_SetProgramCacheDir(const char *Dir)
+    cdef const char *DPCTLKernelBundle_GetProgramCacheDir()
+    cdef void DPCTLKernelBundle_SetProgramCacheLimits(
+        size_t MemoryLimit, size_t DiskLimit)
+    cdef size_t DPCTLKernelBundle_GetProgramCacheMemoryLimit()
+    cdef size_t DPCTLKernelBundle_GetProgramCacheDiskLimit()
+    cdef void DPCTLKernelBundle_ClearProgramCache(bool ClearDisk)
+    cdef size_t DPCTLKernelBundle_GetProgramCacheMemoryHits()
+    cdef size_t DPCTLKernelBundle_GetProgramCacheDiskHits()
+    cdef size_t DPCTLKernelBundle_GetProgramCacheMisses()
+    cdef size_t DPCTLKernelBundle_GetProgramCacheRejected()
 
 
 cdef extern from "syclinterface/dpctl_sycl_queue_interface.h":
@@ -498,6 +511,27 @@ cdef extern from "syclinterface/dpctl_sycl_queue_interface.h":
         size_t NDims,
         const DPCTLSyclEventRef *DepEvents,
         size_t NDepEvents)
+    cdef DPCTLSyclKernelLaunchRef DPCTLKernelLaunch_Create(
+        const DPCTLSyclKernelRef KRef,
+        void **Args,
+        const _arg_data_type *ArgTypes,
+        size_t NArgs,
+        const size_t gRange[3],
+        const size_t lRange[3],
+        size_t NDims)
+    cdef bool DPCTLKernelLaunch_SetArg(
+        DPCTLSyclKernelLaunchRef LRef,
+        size_t Idx,
+        void *Arg,
+        _arg_data_type ArgTy)
+    cdef size_t DPCTLKernelLaunch_GetNumArgs(
+        const DPCTLSyclKernelLaunchRef LRef)
+    cdef DPCTLSyclEventRef DPCTLKernelLaunch_Submit(
+        const DPCTLSyclKernelLaunchRef LRef,
+        const DPCTLSyclQueueRef QRef,
+        const DPCTLSyclEventRef *DepEvents,
+        size_t NDepEvents)
+    cdef void DPCTLKernelLaunch_Delete(DPCTLSyclKernelLaunchRef LRef)
     cdef void DPCTLQueue_Wait(const DPCTLSyclQueueRef QRef) nogil
     cdef DPCTLSyclEventRef DPCTLQueue_Memcpy(
         const DPCTLSyclQueueRef Q,
@@ -24,6 +24,7 @@ from libcpp cimport bool as cpp_bool
 
 from ._backend cimport (
     DPCTLSyclDeviceRef,
+    DPCTLSyclKernelLaunchRef,
     DPCTLSyclQueueRef,
     DPCTLSyclRawKernelArgRef,
     DPCTLSyclWorkGroupMemoryRef,
@@ -107,6 +108,16 @@ cdef public api class SyclQueue (_SyclQueue) [
     cpdef mem_advise(self, ptr, size_t count, int mem)
     cpdef SyclEvent submit_barrier(self, dependent_events=*)
 
+cdef class SyclKernelLaunch:
+    """ Python wrapper class for a prepared kernel launch.
+    """
+    cdef DPCTLSyclKernelLaunchRef _launch_ref
+    cdef SyclQueue _queue
+    cdef list _args
+
+    cpdef SyclEvent submit_async(self, list dEvents=*)
+    cpdef SyclEvent submit(self, list dEvents=*)
+
 cdef public api class _WorkGroupMemory [
     object Py_WorkGroupMemoryObject, type Py_WorkGroupMemoryType
 ]:
@@ -33,6 +33,11 @@ from ._backend cimport (  # noqa: E211
     DPCTLEvent_Delete,
     DPCTLEvent_Wait,
     DPCTLFilterSelector_Create,
+    DPCTLKernelLaunch_Create,
+    DPCTLKernelLaunch_Delete,
+    DPCTLKernelLaunch_GetNumArgs,
+    DPCTLKernelLaunch_SetArg,
+    DPCTLKernelLaunch_Submit,
     DPCTLQueue_AreEq,
     DPCTLQueue_Copy,
     DPCTLQueue_Create,
@@ -1373,6 +1378,111 @@ cdef class SyclQueue(_SyclQueue):
         e.wait()
         return e
 
+    def prepare_launch(
+        self,
+        SyclKernel kernel,
+        list args,
+        list gS,
+        list lS=None
+    ):
+        """
+        Prepares repeated submission of :class:`dpctl.program.SyclKernel`
+        with the given arguments and iteration range.
+
+        Arguments are validated and packed once, so that submitting the
+        returned :class:`dpctl.SyclKernelLaunch` avoids the conversion work
+        done by :meth:`dpctl.SyclQueue.submit_async` on every call.
+
+        Args:
+            kernel (dpctl.program.SyclKernel):
+                SYCL kernel object
+            args (List[object]):
+                List of kernel arguments, of the types accepted by
+                :meth:`dpctl.SyclQueue.submit_async`.
+            gS (List[int]):
+                Global iteration range. Must be a list of length 1, 2, or 3.
+            lS (List[int], optional):
+                Local iteration range. Must be ``None`` or have the same
+                length as ``gS`` and each element of ``gS`` must be divisible
+                by respective element of ``lS``.
+
+        Returns:
+            dpctl.SyclKernelLaunch:
+                The prepared launch, bound to this queue.
+
+        Raises:
+            TypeError:
+                If an argument has unsupported type.
+            SyclKernelInvalidRangeError:
+                If a range does not have between one and three dimensions.
+            ValueError:
+                If local and global ranges have different dimensions, or
+                an argument could not be packed.
+        """
+        cdef void **kargs = NULL
+        cdef _arg_data_type *kargty = NULL
+        cdef DPCTLSyclKernelLaunchRef LRef = NULL
+        cdef size_t gRange[3]
+        cdef size_t lRange[3]
+        cdef size_t *lRangePtr = NULL
+        cdef size_t nArgs = len(args)
+        cdef size_t nGS = len(gS)
+        cdef size_t nLS = len(lS) if lS is not None else 0
+        cdef SyclKernelLaunch launch
+
+        if self._populate_range(gRange, gS, nGS) == -1:
+            raise SyclKernelInvalidRangeError(
+                "Range with ", nGS, " not allowed. Range can only have "
+                "between one and three dimensions."
+            )
+        if lS is not None:
+            if self._populate_range(lRange, lS, nLS) == -1:
+                raise SyclKernelInvalidRangeError(
+                    "Range with ", nLS, " not allowed. Range can only have "
+                    "between one and three dimensions."
+                )
+            if nGS != nLS:
+                raise ValueError(
+                    "Local and global ranges need to have same "
+                    "number of dimensions."
+                )
+            lRangePtr = lRange
+
+        if nArgs > 0:
+            kargs = <void**>malloc(nArgs * sizeof(void*))
+            kargty = (
+                <_arg_data_type*>malloc(nArgs * sizeof(_arg_data_type))
+            )
+            if not kargs or not kargty:
+                free(kargs)
+                free(kargty)
+                raise MemoryError()
+            if self._populate_args(args, kargs, kargty) == -1:
+                free(kargs)
+                free(kargty)
+                raise TypeError("Unsupported type for a kernel argument")
+
+        LRef = DPCTLKernelLaunch_Create(
+            kernel.get_kernel_ref(),
+            kargs,
+            kargty,
+            nArgs,
+            gRange,
+            lRangePtr,
+            nGS
+        )
+        free(kargs)
+        free(kargty)
+        if LRef is NULL:
+            raise ValueError("Kernel launch could not be prepared.")
+
+        launch = SyclKernelLaunch.__new__(SyclKernelLaunch)
+        launch._launch_ref = LRef
+        launch._queue = self
+        # keep USM allocations and other referenced arguments alive
+        launch._args = list(args)
+        return launch
+
     cpdef void wait(self):
         with nogil:
             DPCTLQueue_Wait(self._queue_ref)
@@ -1397,6 +1507,7 @@ cdef class SyclQueue(_SyclQueue):
         cdef DPCTLSyclEventRef ERef = NULL
         cdef DPCTLSyclEventRef *depEvents = NULL
         cdef size_t nDE = 0
+        cdef SyclEvent ev
 
         if dEvents is None:
             ERef = _memcpy_impl(<SyclQueue>self, dest, src, count, NULL, 0)
@@ -1424,7 +1535,14 @@ cdef class SyclQueue(_SyclQueue):
                 "SyclQueue.memcpy operation encountered an error"
             )
 
-        return SyclEvent._create(ERef)
+        ev = SyclEvent._create(ERef)
+        # allocations are not released until the copy completes
+        if isinstance(dest, _Memory):
+            (<_Memory>dest)._record_last_use(ev)
+        if isinstance(src, _Memory):
+            (<_Memory>src)._record_last_use(ev)
+
+        return ev
 
     cpdef prefetch(self, mem, size_t count=0):
         cdef void *ptr
@@ -1664,6 +1782,137 @@ cdef api SyclQueue SyclQueue_Make(DPCTLSyclQueueRef QRef):
     cdef DPCTLSyclQueueRef copied_QRef = DPCTLQueue_Copy(QRef)
     return SyclQueue._create(copied_QRef)
 
+cdef class SyclKernelLaunch:
+    """
+    A kernel launch prepared by :meth:`dpctl.SyclQueue.prepare_launch`.
+
+    Holds the kernel, its packed arguments and iteration range, and the
+    queue to submit to. Individual arguments can be replaced with
+    :meth:`set_arg` between submissions.
+
+    .. note::
+        The launch keeps references to its arguments, so USM allocations
+        passed as arguments remain alive at least as long as the launch.
+        One must still ensure the lifetime of arguments extends after
+        submitted tasks complete, e.g. by keeping the launch alive.
+    """
+
+    def __cinit__(self, *args, **kwargs):
+        self._launch_ref = NULL
+        self._queue = None
+        self._args = []
+
+    def __init__(self, *args, **kwargs):
+        raise TypeError(
+            "SyclKernelLaunch can only be created by "
+            "dpctl.SyclQueue.prepare_launch"
+        )
+
+    def __dealloc__(self):
+        DPCTLKernelLaunch_Delete(self._launch_ref)
+
+    @property
+    def num_args(self):
+        """Number of kernel arguments of the launch."""
+        return DPCTLKernelLaunch_GetNumArgs(self._launch_ref)
+
+    @property
+    def sycl_queue(self):
+        """:class:`dpctl.SyclQueue` the launch is submitted to."""
+        return self._queue
+
+    def set_arg(self, size_t idx, arg):
+        """
+        Replaces the kernel argument at position ``idx``.
+
+        Args:
+            idx (int):
+                Position of the argument.
+            arg (object):
+                New argument, of the same type as the argument the launch
+                was prepared with.
+
+        Raises:
+            IndexError:
+                If ``idx`` is out of range.
+            TypeError:
+                If the argument has unsupported type, or a type different
+                from the prepared one.
+        """
+        cdef void *karg = NULL
+        cdef _arg_data_type kargty
+        if idx >= len(self._args):
+            raise IndexError("Kernel argument index is out of range")
+        if self._queue._populate_args([arg], &karg, &kargty) == -1:
+            raise TypeError("Unsupported type for a kernel argument")
+        if not DPCTLKernelLaunch_SetArg(self._launch_ref, idx, karg, kargty):
+            raise TypeError(
+                "Kernel argument type differs from the prepared type"
+            )
+        self._args[idx] = arg
+
+    cpdef SyclEvent submit_async(self, list dEvents=None):
+        """
+        Asynchronously submits the prepared launch.
+
+        Args:
+            dEvents (List[dpctl.SyclEvent], optional):
+                List of events indicating ordering of this task relative
+                to tasks associated with specified events.
+
+        Returns:
+            dpctl.SyclEvent:
+                An event associated with submission of the kernel.
+        """
+        cdef DPCTLSyclEventRef *depEvents = NULL
+        cdef DPCTLSyclEventRef Eref = NULL
+        cdef size_t nDE = len(dEvents) if dEvents is not None else 0
+
+        if nDE > 0:
+            depEvents = (
+                <DPCTLSyclEventRef*>malloc(nDE*sizeof(DPCTLSyclEventRef))
+            )
+            if not depEvents:
+                raise MemoryError()
+            for idx, de in enumerate(dEvents):
+                if isinstance(de, SyclEvent):
+                    depEvents[idx] = (<SyclEvent>de).get_event_ref()
+                else:
+                    free(depEvents)
+                    raise TypeError(
+                        "A sequence of dpctl.SyclEvent is expected"
+                    )
+
+        Eref = DPCTLKernelLaunch_Submit(
+            self._launch_ref, self._queue.get_queue_ref(), depEvents, nDE
+        )
+        free(depEvents)
+
+        if Eref is NULL:
+            raise SyclKernelSubmitError(
+                "Kernel submission to Sycl queue failed."
+            )
+
+        return SyclEvent._create(Eref)
+
+    cpdef SyclEvent submit(self, list dEvents=None):
+        """
+        Submits the prepared launch and waits for its completion.
+
+        Args:
+            dEvents (List[dpctl.SyclEvent], optional):
+                List of events indicating ordering of this task relative
+                to tasks associated with specified events.
+
+        Returns:
+            dpctl.SyclEvent:
+                An event which is always complete. May be ignored.
+        """
+        cdef SyclEvent e = self.submit_async(dEvents)
+        e.wait()
+        return e
+
+
 cdef class _WorkGroupMemory:
     def __dealloc__(self):
         if(self._mem_ref):
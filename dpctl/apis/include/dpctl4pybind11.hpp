@@ -26,8 +26,10 @@
 #pragma once
 
 #include "dpctl_capi.h"
+#include <algorithm>
 #include <complex>
 #include <cstddef> // for std::size_t for C++ linkage
+#include <limits>
 #include <memory>
 #include <pybind11/pybind11.h>
 #include <stddef.h> // for size_t for C linkage
@@ -1258,13 +1260,341 @@ struct ManagedMemory
     }
 };
 
+/*! @brief Collects owners of arguments of consecutive submissions to a
+ *         queue, so that they can be released by a single host_task.
+ *
+ *  Owners are released when the batch is flushed, by a host_task depending
+ *  on all events recorded in the batch, or on the host without submitting
+ *  anything if all of these events have already completed.
+ *
+ *  A retaining batch, used while submissions to the queue are recorded
+ *  into a command graph, never releases owners: events of recorded
+ *  commands can not be waited on, and owners must outlive the graph. They
+ *  are handed over with `take_retained` instead.
+ *
+ *  Batches are only accessed with GIL held.
+ */
+class KeepAliveBatch
+{
+private:
+    sycl::queue q_;
+    std::size_t max_size_;
+    bool retain_ = false;
+    std::size_t n_ops_ = 0;
+    std::size_t depth_ = 1;
+    std::vector<std::shared_ptr<void>> usm_owners_{};
+    std::vector<py::handle> py_objs_{};
+    std::vector<sycl::event> events_{};
+
+    static bool is_event_complete(const sycl::event &e)
+    {
+        static constexpr auto exec_complete =
+            sycl::info::event_command_status::complete;
+
+        const auto status =
+            e.get_info<sycl::info::event::command_execution_status>();
+        return (status == exec_complete);
+    }
+
+    void release_on_host()
+    {
+        usm_owners_.clear();
+        for (auto &h : py_objs_) {
+            h.dec_ref();
+        }
+        py_objs_.clear();
+        events_.clear();
+        n_ops_ = 0;
+    }
+
+public:
+    KeepAliveBatch(const sycl::queue &q,
+                   std::size_t max_size,
+                   bool retain = false)
+        : q_(q), max_size_((max_size > 0) ? max_size : 1), retain_(retain)
+    {
+    }
+
+    KeepAliveBatch(const KeepAliveBatch &) = delete;
+    KeepAliveBatch &operator=(const KeepAliveBatch &) = delete;
+
+    const sycl::queue &get_queue() const { return q_; }
+
+    std::size_t size() const { return n_ops_; }
+
+    std::size_t get_max_size() const { return max_size_; }
+
+    bool is_retaining() const { return retain_; }
+
+    std::size_t enter() { return ++depth_; }
+
+    std::size_t exit() { return (depth_ > 0) ? --depth_ : 0; }
+
+    /*! @brief Record owners of one submission. Returns `true` if the batch
+     *         reached its maximal size and should be flushed. */
+    bool add(std::vector<std::shared_ptr<void>> &&usm_owners,
+             std::vector<py::handle> &&py_objs,
+             const std::vector<sycl::event> &depends)
+    {
+        if (retain_) {
+            for (auto &shp : usm_owners) {
+                usm_owners_.push_back(std::move(shp));
+            }
+            for (const auto &h : py_objs) {
+                py_objs_.push_back(h);
+            }
+            ++n_ops_;
+            return false;
+        }
+
+        // poll for completion: drop events which have completed, and
+        // release everything held if nothing is outstanding
+        const auto &it = std::remove_if(events_.begin(), events_.end(),
+                                        is_event_complete);
+        events_.erase(it, events_.end());
+        if (events_.empty() && n_ops_ > 0) {
+            release_on_host();
+        }
+
+        for (auto &shp : usm_owners) {
+            usm_owners_.push_back(std::move(shp));
+        }
+        for (const auto &h : py_objs) {
+            py_objs_.push_back(h);
+        }
+        for (const auto &e : depends) {
+            if (!is_event_complete(e)) {
+                events_.push_back(e);
+            }
+        }
+        ++n_ops_;
+
+        return (n_ops_ >= max_size_);
+    }
+
+    /*! @brief Release everything held once recorded events complete.
+     *         Returns event of the submitted host_task, or a default
+     *         constructed event if nothing had to be submitted. */
+    sycl::event flush()
+    {
+        if (retain_ || n_ops_ == 0) {
+            return sycl::event{};
+        }
+
+        const auto &it = std::remove_if(events_.begin(), events_.end(),
+                                        is_event_complete);
+        events_.erase(it, events_.end());
+        if (events_.empty()) {
+            release_on_host();
+            return sycl::event{};
+        }
+
+        sycl::event host_task_ev = q_.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(events_);
+            cgh.host_task([usm_owners = std::move(usm_owners_),
+                           py_objs = std::move(py_objs_)]() {
+                // USM owners are released when the lambda is destroyed
+                py::gil_scoped_acquire acquire;
+
+                for (const auto &h : py_objs) {
+                    h.dec_ref();
+                }
+            });
+        });
+
+        usm_owners_.clear();
+        py_objs_.clear();
+        events_.clear();
+        n_ops_ = 0;
+
+        return host_task_ev;
+    }
+
+    /*! @brief Move owners held by the batch to the caller. References to
+     *         Python objects are transferred along with the handles. */
+    void take_retained(std::vector<std::shared_ptr<void>> &usm_owners,
+                       std::vector<py::handle> &py_objs)
+    {
+        usm_owners = std::move(usm_owners_);
+        py_objs = std::move(py_objs_);
+        usm_owners_.clear();
+        py_objs_.clear();
+        events_.clear();
+        n_ops_ = 0;
+    }
+};
+
+/*! @brief Registry of keep-alive batches, one per queue with batching
+ *         enabled. Single instance is owned by `dpctl.utils` and shared
+ *         with other extensions through a capsule. */
+class KeepAliveBatchRegistry
+{
+private:
+    std::vector<std::unique_ptr<KeepAliveBatch>> batches_{};
+
+    using BatchIt = std::vector<std::unique_ptr<KeepAliveBatch>>::iterator;
+
+    BatchIt find_batch(const sycl::queue &q)
+    {
+        return std::find_if(
+            batches_.begin(), batches_.end(),
+            [&q](const auto &batch) { return batch->get_queue() == q; });
+    }
+
+public:
+    static constexpr const char *capsule_name =
+        "dpctl.utils._keep_alive_batch_registry";
+
+    KeepAliveBatchRegistry() = default;
+    KeepAliveBatchRegistry(const KeepAliveBatchRegistry &) = delete;
+    KeepAliveBatchRegistry &
+    operator=(const KeepAliveBatchRegistry &) = delete;
+
+    bool empty() const { return batches_.empty(); }
+
+    KeepAliveBatch *get(const sycl::queue &q)
+    {
+        if (batches_.empty()) {
+            return nullptr;
+        }
+        const auto &it = find_batch(q);
+        return (it == batches_.end()) ? nullptr : it->get();
+    }
+
+    /*! @brief Start batching for queue `q`. Nested calls are counted,
+     *         and maximal size of the outermost batch is retained. */
+    void begin(const sycl::queue &q, std::size_t max_size)
+    {
+        if (KeepAliveBatch *batch = get(q)) {
+            batch->enter();
+            return;
+        }
+        batches_.emplace_back(std::make_unique<KeepAliveBatch>(q, max_size));
+    }
+
+    /*! @brief Flush batch for queue `q`, and stop batching if this
+     *         matches the outermost `begin`. */
+    sycl::event end(const sycl::queue &q)
+    {
+        const auto &it = find_batch(q);
+        if (it == batches_.end()) {
+            return sycl::event{};
+        }
+        sycl::event ht_ev = (*it)->flush();
+        if ((*it)->exit() == 0) {
+            batches_.erase(it);
+        }
+        return ht_ev;
+    }
+
+    sycl::event flush(const sycl::queue &q)
+    {
+        KeepAliveBatch *batch = get(q);
+        return (batch) ? batch->flush() : sycl::event{};
+    }
+
+    /*! @brief Start retaining owners of arguments of submissions to `q`
+     *         until `end_retaining` is called. */
+    void begin_retaining(const sycl::queue &q)
+    {
+        if (get(q)) {
+            throw std::runtime_error(
+                "Keep-alive batching is already active for the queue");
+        }
+        batches_.emplace_back(std::make_unique<KeepAliveBatch>(
+            q, std::numeric_limits<std::size_t>::max(), /* retain */ true));
+    }
+
+    /*! @brief Stop retaining for `q`, moving retained owners to the
+     *         caller */
+    void end_retaining(const sycl::queue &q,
+                       std::vector<std::shared_ptr<void>> &usm_owners,
+                       std::vector<py::handle> &py_objs)
+    {
+        const auto &it = find_batch(q);
+        if (it == batches_.end() || !(*it)->is_retaining()) {
+            throw std::runtime_error(
+                "Owners of arguments are not being retained for the queue");
+        }
+        (*it)->take_retained(usm_owners, py_objs);
+        batches_.erase(it);
+    }
+};
+
+/*! @brief Returns registry of keep-alive batches exported by
+ *         `dpctl.utils._seq_order_keeper`, or `nullptr` if not available. */
+inline KeepAliveBatchRegistry *get_keep_alive_batch_registry()
+{
+    static KeepAliveBatchRegistry *registry = []() {
+        KeepAliveBatchRegistry *ptr = nullptr;
+        try {
+            py::object cap_obj =
+                py::module_::import("dpctl.utils._seq_order_keeper")
+                    .attr("_keep_alive_batch_registry");
+            py::capsule cap = py::reinterpret_borrow<py::capsule>(cap_obj);
+            ptr = cap.get_pointer<KeepAliveBatchRegistry>();
+        } catch (const py::error_already_set &) {
+            ptr = nullptr;
+        }
+        return ptr;
+    }();
+    return registry;
+}
+
+} // end of namespace detail
+
+namespace detail
+{
+
+template <std::size_t num>
+sycl::event keep_args_alive_batched(KeepAliveBatch &batch,
+                                    const py::object (&py_objs)[num],
+                                    const std::vector<sycl::event> &depends)
+{
+    std::vector<std::shared_ptr<void>> usm_owners;
+    std::vector<py::handle> handles;
+    usm_owners.reserve(num);
+    handles.reserve(num);
+
+    for (std::size_t i = 0; i < num; ++i) {
+        const auto &py_obj_i = py_objs[i];
+        if (ManagedMemory::is_usm_managed_by_shared_ptr(py_obj_i)) {
+            usm_owners.push_back(ManagedMemory::extract_shared_ptr(py_obj_i));
+        }
+        else {
+            py::handle h = py_obj_i;
+            h.inc_ref();
+            handles.push_back(h);
+        }
+    }
+
+    if (batch.add(std::move(usm_owners), std::move(handles), depends)) {
+        return batch.flush();
+    }
+    // owners are released later, when the batch is flushed
+    return sycl::event{};
+}
+
 } // end of namespace detail
 
+/*! @brief Keep Python objects, and USM allocations they own, alive until
+    all events in `depends` complete.
+
+    If keep-alive batching is enabled for `q` (see
+    `dpctl.utils.SequentialOrderManager[q].keep_alive_batching`), objects
+    are added to the batch, and a default constructed event is returned
+    unless the batch got flushed. */
 template <std::size_t num>
 sycl::event keep_args_alive(sycl::queue &q,
                             const py::object (&py_objs)[num],
                             const std::vector<sycl::event> &depends = {})
 {
+    if (auto *registry = detail::get_keep_alive_batch_registry()) {
+        if (auto *batch = registry->get(q)) {
+            return detail::keep_args_alive_batched(*batch, py_objs, depends);
+        }
+    }
+
     std::size_t n_objects_held = 0;
     std::array<std::shared_ptr<py::handle>, num> shp_arr{};
 
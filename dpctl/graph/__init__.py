@@ -0,0 +1,29 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2025 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+    **Data Parallel Control Graph** records sequences of operations
+    offloaded to a queue, e.g. by :mod:`dpctl.tensor` functions, so that
+    they can be replayed with low host overhead.
+
+"""
+from ._graph import Graph, capture, is_supported
+
+__all__ = [
+    "Graph",
+    "capture",
+    "is_supported",
+]
@@ -0,0 +1,303 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2025 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from contextlib import contextmanager
+
+import dpctl
+import dpctl.tensor as dpt
+from dpctl.utils import SequentialOrderManager
+
+from ._graph_impl import _CommandGraph, _graph_is_supported
+
+__doc__ = (
+    "Implementation module of :func:`dpctl.graph.capture` context manager."
+)
+
+
+def is_supported(queue):
+    """is_supported(queue)
+
+    Returns ``True`` if the device of the queue supports recording of
+    SYCL command graphs (``sycl_ext_oneapi_graph`` extension).
+
+    Args:
+        queue (:class:`dpctl.SyclQueue`):
+            queue to check
+
+    Returns:
+        bool:
+            whether :func:`capture` records submitted commands natively
+    """
+    if not isinstance(queue, dpctl.SyclQueue):
+        raise TypeError(f"Expected dpctl.SyclQueue, got {type(queue)}")
+    return _graph_is_supported(queue)
+
+
+def _as_pairs(pairs):
+    if pairs is None:
+        return []
+    res = []
+    for pair in pairs:
+        captured, other = pair
+        if not isinstance(captured, dpt.usm_ndarray) or not isinstance(
+            other, dpt.usm_ndarray
+        ):
+            raise TypeError(
+                "Expected pairs of dpctl.tensor.usm_ndarray, got "
+                f"({type(captured)}, {type(other)})"
+            )
+        if captured.shape != other.shape:
+            raise ValueError(
+                f"Shape {other.shape} does not match shape "
+                f"{captured.shape} of the captured array"
+            )
+        res.append((captured, other))
+    return res
+
+
+def _update_result(res, new_res):
+    """Copies content of arrays returned by a replayed call into arrays
+    returned by the recorded call."""
+    if isinstance(res, dpt.usm_ndarray):
+        if not isinstance(new_res, dpt.usm_ndarray) or (
+            res.shape != new_res.shape
+        ):
+            raise RuntimeError(
+                "Replayed call returned a result inconsistent with the "
+                "recorded one"
+            )
+        if new_res is not res:
+            res[...] = new_res
+    elif isinstance(res, (tuple, list)):
+        if not isinstance(new_res, (tuple, list)) or len(res) != len(
+            new_res
+        ):
+            raise RuntimeError(
+                "Replayed call returned a result inconsistent with the "
+                "recorded one"
+            )
+        for r, new_r in zip(res, new_res):
+            _update_result(r, new_r)
+
+
+class Graph:
+    """
+    Graph()
+
+    Operations offloaded to a queue, recorded by :func:`capture` to be
+    replayed.
+
+    If the device supports SYCL command graphs, commands submitted to
+    the queue while capturing are recorded into a graph and are not
+    executed. Replaying the graph submits all of them at once.
+
+    Otherwise, calls made with :meth:`Graph.call` are executed and recorded
+    into a list, and replaying the graph repeats these calls.
+
+    Instances are created by :func:`capture`.
+    """
+
+    def __init__(self):
+        raise TypeError("Graph instances are created by dpctl.graph.capture")
+
+    @classmethod
+    def _create(cls, queue, native):
+        g = cls.__new__(cls)
+        g._queue = queue
+        g._impl = _CommandGraph(queue) if native else None
+        g._commands = []
+        g._capturing = False
+        g._recorded = False
+        g._num_calls_offloaded = 0
+        return g
+
+    @property
+    def sycl_queue(self):
+        """:class:`dpctl.SyclQueue` the operations are offloaded to"""
+        return self._queue
+
+    @property
+    def is_native(self):
+        """``True`` if operations are recorded into a SYCL command
+        graph"""
+        return self._impl is not None
+
+    @property
+    def num_commands(self):
+        """Number of recorded commands of a native graph, or number of
+        recorded calls otherwise"""
+        if self._impl is not None:
+            return self._impl.num_nodes
+        return len(self._commands)
+
+    def call(self, fn, /, *args, **kwargs):
+        """call(fn, *args, **kwargs)
+
+        Calls ``fn(*args, **kwargs)`` and records the call to be repeated
+        on replay.
+
+        For a native graph, commands submitted by ``fn`` are recorded
+        like any other command offloaded while capturing. Otherwise,
+        the call is executed, and replaying the graph calls ``fn`` with
+        the same arguments. Content of :class:`dpctl.tensor.usm_ndarray`
+        instances returned by the repeated call is copied into the arrays
+        returned now, so that results of the replay are found in the same
+        arrays in either case.
+
+        Returns:
+            Result of the call.
+        """
+        if not self._capturing:
+            raise RuntimeError(
+                "Graph.call can only be used while the graph is captured"
+            )
+        if self._impl is not None:
+            return fn(*args, **kwargs)
+        som = SequentialOrderManager[self._queue]
+        n_before = som._num_event_pairs
+        res = fn(*args, **kwargs)
+        self._num_calls_offloaded += som._num_event_pairs - n_before
+        self._commands.append((fn, args, kwargs, res))
+        return res
+
+    def replay(self, *, inputs=None, outputs=None):
+        """replay(*, inputs=None, outputs=None)
+
+        Offloads all recorded operations again, ordered after previously
+        offloaded tasks by :class:`dpctl.utils.SequentialOrderManager`.
+
+        Operations read from and write to the arrays used while capturing.
+        To run them on other data, pass ``inputs``, pairs of a captured
+        array and an array of the same shape whose content is copied into
+        the captured array before replaying, and ``outputs``, pairs of a
+        captured array and an array of the same shape the captured array
+        is copied into after replaying.
+
+        Args:
+            inputs (Sequence[Tuple[usm_ndarray, usm_ndarray]], optional):
+                pairs ``(captured, new_input)``
+            outputs (Sequence[Tuple[usm_ndarray, usm_ndarray]], optional):
+                pairs ``(captured, destination)``
+        """
+        if self._capturing:
+            raise RuntimeError("Graph can not be replayed while captured")
+        if not self._recorded:
+            raise RuntimeError("Graph has not been recorded")
+        input_pairs = _as_pairs(inputs)
+        output_pairs = _as_pairs(outputs)
+
+        for captured, new_input in input_pairs:
+            captured[...] = new_input
+        if self._impl is not None:
+            som = SequentialOrderManager[self._queue]
+            replay_ev = self._impl.replay(som.submitted_events)
+            som.add_event_pair(dpctl.SyclEvent(), replay_ev)
+        else:
+            for fn, args, kwargs, res in self._commands:
+                _update_result(res, fn(*args, **kwargs))
+        for captured, destination in output_pairs:
+            destination[...] = captured
+
+    def wait(self):
+        """Waits for completion of offloaded tasks, including replays of
+        the graph"""
+        SequentialOrderManager[self._queue].wait()
+
+
+@contextmanager
+def capture(queue, *, native=None):
+    """capture(queue, *, native=None)
+
+    Context manager recording operations offloaded to ``queue`` into a
+    :class:`Graph`.
+
+    .. code-block:: python
+
+        with dpctl.graph.capture(q) as g:
+            g.call(step, x, out=y)
+
+        for _ in range(n_steps):
+            g.replay()
+
+    If the device supports SYCL command graphs, all commands submitted to
+    the queue while the context is active are recorded and are executed
+    only when the graph is replayed. Operations must not synchronize with
+    the host, e.g. by waiting on events or copying data to NumPy arrays.
+    Arrays used by recorded operations are kept alive as long as the
+    graph.
+
+    Otherwise, only calls made with :meth:`Graph.call` are recorded, and
+    they are executed once while capturing. Offloading any other operation
+    to the queue while capturing raises :exc:`RuntimeError`, since it could
+    not be replayed. Calling functions with :meth:`Graph.call` thus gives
+    the same behavior regardless of device support.
+
+    Tasks previously offloaded to the queue are waited on before capture
+    starts.
+
+    Args:
+        queue (:class:`dpctl.SyclQueue`):
+            queue operations are offloaded to
+        native (bool, optional):
+            whether to record a SYCL command graph. Default: ``None``,
+            record a command graph if supported by the device.
+
+    Yields:
+        :class:`Graph`:
+            graph recorded when the context exits
+    """
+    supported = is_supported(queue)
+    if native is None:
+        native = supported
+    elif native and not supported:
+        raise ValueError(
+            "Device of the queue does not support SYCL command graphs"
+        )
+    som = SequentialOrderManager[queue]
+    # recorded commands can not depend on tasks submitted before
+    som.wait()
+
+    g = Graph._create(queue, bool(native))
+    if g._impl is not None:
+        with som._recording():
+            g._impl.begin_recording()
+            g._capturing = True
+            try:
+                yield g
+            except BaseException:
+                g._capturing = False
+                g._impl.discard()
+                raise
+            g._capturing = False
+            g._impl.end_recording()
+    else:
+        n_before = som._num_event_pairs
+        g._capturing = True
+        try:
+            yield g
+        finally:
+            g._capturing = False
+        n_uncaptured = (
+            som._num_event_pairs - n_before - g._num_calls_offloaded
+        )
+        if n_uncaptured > 0:
+            g._commands.clear()
+            raise RuntimeError(
+                f"{n_uncaptured} operations were offloaded outside of "
+                "Graph.call while capturing, and can not be replayed "
+                "without support for SYCL command graphs"
+            )
+    g._recorded = True
@@ -0,0 +1,252 @@
+//===-- graph_impl.cpp - Recording and replay of command graphs -*-C++-*--===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines the _graph_impl extension, which records commands
+/// submitted to a queue into a SYCL command graph using the
+/// sycl_ext_oneapi_graph extension, and replays the finalized graph.
+//===----------------------------------------------------------------------===//
+
+#include "dpctl4pybind11.hpp"
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <sycl/sycl.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace
+{
+
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+namespace syclexp = sycl::ext::oneapi::experimental;
+#endif
+
+bool graph_is_supported(const sycl::queue &q)
+{
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+    const sycl::device &dev = q.get_device();
+    return dev.has(sycl::aspect::ext_oneapi_graph) ||
+           dev.has(sycl::aspect::ext_oneapi_limited_graph);
+#else
+    (void)q;
+    return false;
+#endif
+}
+
+/*! @brief Command graph recorded from submissions to a queue.
+ *
+ *  While recording, owners of arguments of recorded operations, which
+ *  `dpctl::utils::keep_args_alive` would otherwise release by a host_task,
+ *  are retained by the graph, since recorded commands reference them on
+ *  every replay.
+ */
+class CommandGraph
+{
+private:
+    sycl::queue q_;
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+    using modifiable_graphT =
+        syclexp::command_graph<syclexp::graph_state::modifiable>;
+    using executable_graphT =
+        syclexp::command_graph<syclexp::graph_state::executable>;
+
+    std::optional<modifiable_graphT> graph_{};
+    std::optional<executable_graphT> exec_graph_{};
+#endif
+    bool recording_ = false;
+    std::vector<std::shared_ptr<void>> usm_owners_{};
+    std::vector<py::object> py_objs_{};
+    sycl::event last_replay_ev_{};
+
+    static dpctl::utils::detail::KeepAliveBatchRegistry &get_registry()
+    {
+        auto *registry = dpctl::utils::detail::get_keep_alive_batch_registry();
+        if (!registry) {
+            throw std::runtime_error(
+                "Registry of keep-alive batches is not available");
+        }
+        return *registry;
+    }
+
+    void stop_recording()
+    {
+        recording_ = false;
+
+        std::vector<py::handle> handles;
+        get_registry().end_retaining(q_, usm_owners_, handles);
+        py_objs_.reserve(py_objs_.size() + handles.size());
+        for (const auto &h : handles) {
+            // batch holds a reference to each object
+            py_objs_.push_back(py::reinterpret_steal<py::object>(h));
+        }
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+        graph_->end_recording(q_);
+#endif
+    }
+
+public:
+    explicit CommandGraph(const sycl::queue &q) : q_(q)
+    {
+        if (!graph_is_supported(q_)) {
+            throw py::value_error(
+                "Device of the queue does not support command graphs");
+        }
+    }
+
+    CommandGraph(const CommandGraph &) = delete;
+    CommandGraph &operator=(const CommandGraph &) = delete;
+
+    ~CommandGraph()
+    {
+        if (recording_) {
+            try {
+                stop_recording();
+            } catch (const std::exception &) {
+                // nothing was executed, owners are released below
+            }
+        }
+        try {
+            py::gil_scoped_release release;
+            last_replay_ev_.wait();
+        } catch (const std::exception &) {
+            // replays are waited on to release owners safely
+        }
+    }
+
+    const sycl::queue &get_queue() const { return q_; }
+
+    bool is_recording() const { return recording_; }
+
+    bool is_finalized() const
+    {
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+        return exec_graph_.has_value();
+#else
+        return false;
+#endif
+    }
+
+    /*! @brief Start recording commands submitted to the queue */
+    void begin_recording()
+    {
+        if (recording_ || is_finalized()) {
+            throw std::runtime_error("Graph has already been recorded");
+        }
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+        graph_.emplace(q_.get_context(), q_.get_device());
+        get_registry().begin_retaining(q_);
+        try {
+            graph_->begin_recording(q_);
+        } catch (...) {
+            std::vector<std::shared_ptr<void>> usm_owners;
+            std::vector<py::handle> handles;
+            get_registry().end_retaining(q_, usm_owners, handles);
+            graph_.reset();
+            throw;
+        }
+        recording_ = true;
+#endif
+    }
+
+    /*! @brief Stop recording and finalize the graph for execution */
+    void end_recording()
+    {
+        if (!recording_) {
+            throw std::runtime_error("Graph is not being recorded");
+        }
+        stop_recording();
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+        exec_graph_.emplace(graph_->finalize());
+#endif
+    }
+
+    /*! @brief Stop recording and discard recorded commands */
+    void discard()
+    {
+        if (recording_) {
+            stop_recording();
+        }
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+        graph_.reset();
+#endif
+        usm_owners_.clear();
+        py_objs_.clear();
+    }
+
+    /*! @brief Submit all recorded commands for execution once events in
+     *         `depends` and the previous replay have completed */
+    sycl::event replay(const std::vector<sycl::event> &depends)
+    {
+        if (!is_finalized()) {
+            throw std::runtime_error("Graph has not been recorded");
+        }
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+        std::vector<sycl::event> deps;
+        deps.reserve(depends.size() + 1);
+        deps.insert(deps.end(), depends.begin(), depends.end());
+        // replays are serialized, since they write to the same memory
+        deps.push_back(last_replay_ev_);
+
+        last_replay_ev_ = q_.ext_oneapi_graph(*exec_graph_, deps);
+#endif
+        return last_replay_ev_;
+    }
+
+    std::size_t get_num_nodes() const
+    {
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+        if (graph_) {
+            return graph_->get_nodes().size();
+        }
+#endif
+        return 0;
+    }
+
+    std::size_t get_num_retained() const
+    {
+        return usm_owners_.size() + py_objs_.size();
+    }
+};
+
+} // end of anonymous namespace
+
+PYBIND11_MODULE(_graph_impl, m)
+{
+    m.def("_graph_is_supported", &graph_is_supported, py::arg("sycl_queue"));
+
+    py::class_<CommandGraph>(m, "_CommandGraph")
+        .def(py::init<const sycl::queue &>(), py::arg("sycl_queue"))
+        .def_property_readonly("sycl_queue", &CommandGraph::get_queue)
+        .def_property_readonly("is_recording", &CommandGraph::is_recording)
+        .def_property_readonly("is_finalized", &CommandGraph::is_finalized)
+        .def_property_readonly("num_nodes", &CommandGraph::get_num_nodes)
+        .def_property_readonly("num_retained",
+                               &CommandGraph::get_num_retained)
+        .def("begin_recording", &CommandGraph::begin_recording)
+        .def("end_recording", &CommandGraph::end_recording)
+        .def("discard", &CommandGraph::discard)
+        .def("replay", &CommandGraph::replay, py::arg("depends") = py::list());
+}
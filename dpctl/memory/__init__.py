@@ -34,6 +34,11 @@ from ._memory import (
     MemoryUSMShared,
     USMAllocationError,
     as_usm_memory,
+    disable_pool,
+    enable_pool,
+    is_pool_enabled,
+    pool_stats,
+    trim,
 )
 
 __all__ = [
@@ -42,4 +47,9 @@ __all__ = [
     "MemoryUSMShared",
     "USMAllocationError",
     "as_usm_memory",
+    "enable_pool",
+    "disable_pool",
+    "is_pool_enabled",
+    "pool_stats",
+    "trim",
 ]
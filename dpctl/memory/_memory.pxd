@@ -25,6 +25,7 @@ in dpctl.memory._memory.pyx.
 from .._backend cimport DPCTLSyclQueueRef, DPCTLSyclUSMRef, _usm_type
 from .._sycl_context cimport SyclContext
 from .._sycl_device cimport SyclDevice
+from .._sycl_event cimport SyclEvent
 from .._sycl_queue cimport SyclQueue
 
 
@@ -38,11 +39,14 @@ cdef public api class _Memory [object Py_MemoryObject, type Py_MemoryType]:
     cdef Py_ssize_t nbytes
     cdef SyclQueue queue
     cdef object refobj
+    cdef list _last_use_events
 
     cdef _cinit_empty(self)
     cdef _cinit_alloc(self, Py_ssize_t alignment, Py_ssize_t nbytes,
                       bytes ptr_type, SyclQueue queue)
     cdef _cinit_other(self, object other)
+    cdef _release_opaque_ptr(self)
+    cdef _record_last_use(self, SyclEvent ev)
     cdef _getbuffer(self, Py_buffer *buffer, int flags)
 
     cpdef copy_to_host(self, object obj=*)
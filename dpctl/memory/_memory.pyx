@@ -28,6 +28,7 @@ import dpctl
 
 from cpython cimport Py_buffer, pycapsule
 from cpython.bytes cimport PyBytes_AS_STRING, PyBytes_FromStringAndSize
+from libc.stdlib cimport free, malloc
 
 from dpctl._backend cimport (  # noqa: E211
     DPCTLaligned_alloc_device,
@@ -37,6 +38,7 @@ from dpctl._backend cimport (  # noqa: E211
     DPCTLContext_Delete,
     DPCTLDevice_Copy,
     DPCTLEvent_Delete,
+    DPCTLEvent_GetCommandExecutionStatus,
     DPCTLEvent_Wait,
     DPCTLmalloc_device,
     DPCTLmalloc_host,
@@ -55,11 +57,13 @@ from dpctl._backend cimport (  # noqa: E211
     DPCTLSyclUSMRef,
     DPCTLUSM_GetPointerDevice,
     DPCTLUSM_GetPointerType,
+    _event_status_type,
     _usm_type,
 )
 
 from .._sycl_context cimport SyclContext
 from .._sycl_device cimport SyclDevice
+from .._sycl_event cimport SyclEvent
 from .._sycl_queue cimport SyclQueue
 from .._sycl_queue_manager cimport get_device_cached_queue
 
@@ -73,6 +77,11 @@ __all__ = [
     "MemoryUSMHost",
     "MemoryUSMDevice",
     "USMAllocationError",
+    "enable_pool",
+    "disable_pool",
+    "is_pool_enabled",
+    "pool_stats",
+    "trim",
 ]
 
 include "_sycl_usm_array_interface_utils.pxi"
@@ -81,8 +90,22 @@ cdef extern from "_opaque_smart_ptr.hpp":
     void * OpaqueSmartPtr_Make(void *, DPCTLSyclQueueRef) nogil
     void * OpaqueSmartPtr_Copy(void *) nogil
     void OpaqueSmartPtr_Delete(void *) nogil
+    void OpaqueSmartPtr_DeleteAfter(
+        void *, DPCTLSyclQueueRef, DPCTLSyclEventRef *, size_t
+    ) nogil
     void * OpaqueSmartPtr_Get(void *) nogil
 
+cdef extern from "_usm_pool.hpp":
+    void * USMPool_MakeAllocation(
+        DPCTLSyclQueueRef, size_t, size_t, int, void **
+    ) nogil
+    int USMPool_IsEnabled() nogil
+    void USMPool_SetEnabled(int) nogil
+    size_t USMPool_GetMaxCachedBytes() nogil
+    void USMPool_SetMaxCachedBytes(size_t) nogil
+    size_t USMPool_Trim(int) nogil
+    void USMPool_GetStats(int, size_t *, size_t *, size_t *, size_t *) nogil
+
 
 class USMAllocationError(Exception):
     """
@@ -96,6 +119,36 @@ class USMAllocationError(Exception):
     pass
 
 
+cdef int _usm_pool_kind(str usm_type) except -2:
+    "Code of USM allocation kind used by the caching allocator"
+    if usm_type is None or usm_type == "all":
+        return -1
+    elif usm_type == "device":
+        return 0
+    elif usm_type == "shared":
+        return 1
+    elif usm_type == "host":
+        return 2
+    raise ValueError(
+        "Unrecognized value of usm_type '{}', expected 'device', "
+        "'shared', 'host', or None".format(usm_type)
+    )
+
+
+cdef inline bint _is_pending(SyclEvent ev):
+    """
+    Whether the task associated with event `ev` is known to not have
+    completed. Status of events of tasks recorded into a graph is unknown.
+    """
+    cdef _event_status_type ESTy = (
+        DPCTLEvent_GetCommandExecutionStatus(ev.get_event_ref())
+    )
+    return (
+        ESTy == _event_status_type._SUBMITTED
+        or ESTy == _event_status_type._RUNNING
+    )
+
+
 cdef void copy_via_host(void *dest_ptr, SyclQueue dest_queue,
                         void *src_ptr, SyclQueue src_queue, size_t nbytes):
     """
@@ -164,11 +217,15 @@ cdef class _Memory:
         self.nbytes = 0
         self.queue = None
         self.refobj = None
+        self._last_use_events = None
 
     cdef _cinit_alloc(self, Py_ssize_t alignment, Py_ssize_t nbytes,
                       bytes ptr_type, SyclQueue queue):
         cdef DPCTLSyclUSMRef p = NULL
         cdef DPCTLSyclQueueRef QRef = NULL
+        cdef void *pool_ptr = NULL
+        cdef void *pool_usm_ptr = NULL
+        cdef int pool_kind = 0
 
         self._cinit_empty()
 
@@ -177,6 +234,18 @@ cdef class _Memory:
                 queue = get_device_cached_queue(dpctl.SyclDevice())
 
             QRef = queue.get_queue_ref()
+            if USMPool_IsEnabled():
+                pool_kind = _usm_pool_kind(ptr_type.decode("UTF-8"))
+                with nogil:
+                    pool_ptr = USMPool_MakeAllocation(
+                        QRef, nbytes, alignment, pool_kind, &pool_usm_ptr
+                    )
+                if pool_ptr is not NULL:
+                    self._memory_ptr = <DPCTLSyclUSMRef>pool_usm_ptr
+                    self._opaque_ptr = pool_ptr
+                    self.nbytes = nbytes
+                    self.queue = queue
+                    return
             if (ptr_type == b"shared"):
                 if alignment > 0:
                     with nogil:
@@ -261,9 +330,57 @@ cdef class _Memory:
 
     def __dealloc__(self):
         if not (self._opaque_ptr is NULL):
-            OpaqueSmartPtr_Delete(self._opaque_ptr)
+            self._release_opaque_ptr()
         self._cinit_empty()
 
+    cdef _release_opaque_ptr(self):
+        """
+        Releases ownership of the allocation. If tasks which used the
+        allocation through this object have not completed, the allocation
+        is retained until they do, without blocking the calling thread.
+        """
+        cdef list evs = self._last_use_events
+        cdef size_t nERefs = 0
+        cdef size_t i = 0
+        cdef DPCTLSyclEventRef *ERefs = NULL
+        cdef DPCTLSyclQueueRef QRef = NULL
+
+        if evs is not None and self.queue is not None:
+            nERefs = len(evs)
+        if nERefs > 0:
+            ERefs = <DPCTLSyclEventRef *>malloc(
+                nERefs * sizeof(DPCTLSyclEventRef)
+            )
+        if ERefs is NULL:
+            OpaqueSmartPtr_Delete(self._opaque_ptr)
+            return
+        for i in range(nERefs):
+            ERefs[i] = (<SyclEvent>evs[i]).get_event_ref()
+        QRef = self.queue.get_queue_ref()
+        with nogil:
+            OpaqueSmartPtr_DeleteAfter(self._opaque_ptr, QRef, ERefs, nERefs)
+        free(ERefs)
+
+    cdef _record_last_use(self, SyclEvent ev):
+        """
+        Records event of a task using the allocation. Release of the
+        allocation by this object is deferred until the task completes.
+        """
+        cdef SyclEvent e
+        if self._opaque_ptr is NULL:
+            if isinstance(self.refobj, _Memory):
+                (<_Memory>self.refobj)._record_last_use(ev)
+            return
+        # events of completed tasks no longer defer release
+        if self._last_use_events is None:
+            self._last_use_events = []
+        else:
+            self._last_use_events = [
+                e for e in self._last_use_events if _is_pending(e)
+            ]
+        if _is_pending(ev):
+            self._last_use_events.append(ev)
+
     cdef DPCTLSyclUSMRef get_data_ptr(self):
         return self._memory_ptr
 
@@ -940,6 +1057,120 @@ def as_usm_memory(obj):
         )
 
 
+def enable_pool(max_cached_bytes=None):
+    """
+    enable_pool(max_cached_bytes=None)
+
+    Enables caching allocator of USM memory.
+
+    When enabled, memory released by :class:`.MemoryUSMDevice`,
+    :class:`.MemoryUSMShared`, and :class:`.MemoryUSMHost` instances, and
+    hence by :class:`dpctl.tensor.usm_ndarray` instances, is retained
+    in per-(context, device, USM type) free lists of size classes, and is
+    reused by subsequent allocations instead of calling SYCL runtime.
+
+    Requests of more than 1 GiB, or requiring alignment of more than
+    64 bytes, are not served by the pool.
+
+    Args:
+        max_cached_bytes (Optional[int]):
+            High-water mark for the number of bytes retained in free lists
+            per (context, device, USM type). Blocks released beyond this
+            limit are freed. If ``None``, the current limit, 1 GiB by
+            default, is kept.
+    """
+    if max_cached_bytes is not None:
+        if not isinstance(max_cached_bytes, numbers.Integral):
+            raise TypeError(
+                "Expected integral value of max_cached_bytes, got {}".format(
+                    type(max_cached_bytes)
+                )
+            )
+        if max_cached_bytes < 0:
+            raise ValueError("max_cached_bytes must be non-negative")
+        USMPool_SetMaxCachedBytes(<size_t>max_cached_bytes)
+    USMPool_SetEnabled(1)
+
+
+def disable_pool():
+    """
+    disable_pool()
+
+    Disables caching allocator of USM memory, and frees all cached
+    blocks. Blocks still in use are freed when released.
+    """
+    with nogil:
+        USMPool_SetEnabled(0)
+
+
+def is_pool_enabled():
+    """
+    is_pool_enabled()
+
+    Returns ``True`` if caching allocator of USM memory is enabled.
+    """
+    return bool(USMPool_IsEnabled())
+
+
+def pool_stats():
+    """
+    pool_stats()
+
+    Returns statistics of caching allocator of USM memory.
+
+    Returns:
+        dict:
+            Dictionary keyed by USM type, ``"device"``, ``"shared"``, and
+            ``"host"``, with dictionary values having keys
+            ``"cached_bytes"`` (bytes retained in free lists),
+            ``"in_use_bytes"`` (bytes of pooled blocks in use),
+            ``"hits"`` (allocations served from free lists),
+            ``"misses"`` (allocations requested from SYCL runtime),
+            and ``"max_cached_bytes"`` (high-water mark).
+    """
+    cdef size_t cached_bytes = 0
+    cdef size_t in_use_bytes = 0
+    cdef size_t n_hits = 0
+    cdef size_t n_misses = 0
+    cdef size_t max_cached_bytes = USMPool_GetMaxCachedBytes()
+    res = dict()
+    for usm_type in ("device", "shared", "host"):
+        USMPool_GetStats(
+            _usm_pool_kind(usm_type),
+            &cached_bytes, &in_use_bytes, &n_hits, &n_misses
+        )
+        res[usm_type] = {
+            "cached_bytes": cached_bytes,
+            "in_use_bytes": in_use_bytes,
+            "hits": n_hits,
+            "misses": n_misses,
+            "max_cached_bytes": max_cached_bytes,
+        }
+    return res
+
+
+def trim(usm_type=None):
+    """
+    trim(usm_type=None)
+
+    Frees blocks cached by caching allocator of USM memory.
+
+    Args:
+        usm_type (Optional[str]):
+            USM type of blocks to free, one of ``"device"``, ``"shared"``,
+            or ``"host"``. If ``None``, blocks of all USM types are freed.
+
+    Returns:
+        int:
+            Number of freed bytes.
+    """
+    cdef int kind = _usm_pool_kind(usm_type)
+    cdef size_t released = 0
+    with nogil:
+        released = USMPool_Trim(kind)
+    return released
+
+
 cdef api void * Memory_GetOpaquePointer(_Memory obj):
     "Opaque pointer value"
     return obj.get_opaque_ptr()
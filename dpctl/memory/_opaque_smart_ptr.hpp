@@ -32,9 +32,11 @@
 
 #include "syclinterface/dpctl_sycl_type_casters.hpp"
 #include "syclinterface/dpctl_sycl_types.h"
+#include <cstddef>
 #include <memory>
 #include <sycl/sycl.hpp>
 #include <utility>
+#include <vector>
 
 #include <exception>
 #include <iostream>
@@ -94,6 +96,57 @@ void OpaqueSmartPtr_Delete(void *opaque_ptr)
     delete sptr;
 }
 
+/*! @brief Release ownership of USM allocation once given events complete.
+ *
+ * Events are those of tasks which used the allocation through this owner.
+ * If some of them have not completed, ownership is transferred to a host
+ * task submitted to the queue, so that the calling thread is not blocked,
+ * and the allocation is freed, or returned to the pool, after the last
+ * task using it has completed.
+ */
+void OpaqueSmartPtr_DeleteAfter(void *opaque_ptr,
+                                DPCTLSyclQueueRef QRef,
+                                DPCTLSyclEventRef *ERefs,
+                                std::size_t nERefs)
+{
+    auto sptr = reinterpret_cast<std::shared_ptr<void> *>(opaque_ptr);
+
+    std::vector<sycl::event> deps;
+    deps.reserve(nERefs);
+    for (std::size_t i = 0; i < nERefs; ++i) {
+        const sycl::event &e =
+            *(dpctl::syclinterface::unwrap<sycl::event>(ERefs[i]));
+        try {
+            if (e.get_info<sycl::info::event::command_execution_status>() !=
+                sycl::info::event_command_status::complete)
+            {
+                deps.push_back(e);
+            }
+        } catch (const std::exception &) {
+            // e.g. events of tasks recorded into a graph, which can not
+            // be waited on
+        }
+    }
+
+    if (!deps.empty()) {
+        sycl::queue *q_ptr = dpctl::syclinterface::unwrap<sycl::queue>(QRef);
+        std::shared_ptr<void> owner(*sptr);
+        try {
+            q_ptr->submit([&](sycl::handler &cgh) {
+                cgh.depends_on(deps);
+                cgh.host_task([owner]() {});
+            });
+        } catch (const std::exception &e) {
+            std::cout << "Deferred release of USM allocation caught an "
+                         "exception: "
+                      << e.what() << std::endl;
+            sycl::event::wait(deps);
+        }
+    }
+
+    delete sptr;
+}
+
 void *OpaqueSmartPtr_Copy(void *opaque_ptr)
 {
     auto sptr = reinterpret_cast<std::shared_ptr<void> *>(opaque_ptr);
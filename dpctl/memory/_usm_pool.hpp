@@ -0,0 +1,415 @@
+//===--- _usm_pool.hpp                                             --------===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===---------------------------------------------------------------------===//
+///
+/// \file
+/// This file implements an opt-in caching allocator of USM memory. Freed
+/// blocks are kept in per-(context, device, USM kind) free lists of size
+/// classes, and are reused by subsequent allocations, bypassing calls to
+/// sycl::malloc_* and sycl::free.
+///
+//===---------------------------------------------------------------------===//
+
+#pragma once
+
+#ifndef __cplusplus
+#error "C++ is required to compile this file"
+#endif
+
+#include "syclinterface/dpctl_sycl_type_casters.hpp"
+#include "syclinterface/dpctl_sycl_types.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <sycl/sycl.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <exception>
+#include <iostream>
+
+namespace detail
+{
+
+/*! @brief Kinds of USM allocation, as used in the Cython interface */
+enum USMPoolKind : int
+{
+    USM_POOL_KIND_DEVICE = 0,
+    USM_POOL_KIND_SHARED = 1,
+    USM_POOL_KIND_HOST = 2,
+    USM_POOL_KIND_ALL = -1
+};
+
+struct USMPoolStats
+{
+    std::size_t cached_bytes = 0;
+    std::size_t in_use_bytes = 0;
+    std::size_t n_hits = 0;
+    std::size_t n_misses = 0;
+};
+
+class USMPool
+{
+public:
+    // requests smaller than this are served from the smallest size class
+    static constexpr std::size_t min_block_size = 512;
+    // size classes are powers of two up to this size, and multiples of
+    // it above
+    static constexpr std::size_t large_block_granularity = (1UL << 20);
+    // larger requests bypass the pool
+    static constexpr std::size_t max_block_size = (1UL << 30);
+    static constexpr std::size_t block_alignment = 64;
+    static constexpr std::size_t default_max_cached_bytes = (1UL << 30);
+
+    static USMPool &get()
+    {
+        // intentionally leaked, since blocks may be returned while the
+        // interpreter is being finalized
+        static USMPool *pool = new USMPool{};
+        return *pool;
+    }
+
+    bool is_enabled() const { return enabled_; }
+
+    void set_enabled(bool enabled)
+    {
+        enabled_ = enabled;
+        if (!enabled) {
+            trim(USM_POOL_KIND_ALL);
+        }
+    }
+
+    std::size_t get_max_cached_bytes() const { return max_cached_bytes_; }
+
+    void set_max_cached_bytes(std::size_t max_cached_bytes)
+    {
+        max_cached_bytes_ = max_cached_bytes;
+        for (auto &bin : bins_snapshot()) {
+            trim_bin(*bin, max_cached_bytes);
+        }
+    }
+
+    static std::size_t size_class(std::size_t nbytes)
+    {
+        if (nbytes <= min_block_size) {
+            return min_block_size;
+        }
+        if (nbytes <= large_block_granularity) {
+            std::size_t cls = min_block_size;
+            while (cls < nbytes) {
+                cls <<= 1;
+            }
+            return cls;
+        }
+        return ((nbytes + large_block_granularity - 1) /
+                large_block_granularity) *
+               large_block_granularity;
+    }
+
+    /*! @brief Returns block of at least `nbytes` bytes, or `nullptr` if
+     *         the request can not be served by the pool. */
+    void *allocate(const sycl::queue &q,
+                   std::size_t nbytes,
+                   std::size_t alignment,
+                   int kind,
+                   std::size_t &block_size)
+    {
+        if (!enabled_ || nbytes > max_block_size ||
+            alignment > block_alignment || kind < 0 ||
+            kind > USM_POOL_KIND_HOST)
+        {
+            return nullptr;
+        }
+
+        block_size = size_class(nbytes);
+        Bin &bin = get_bin(q.get_context(), q.get_device(), kind);
+        {
+            std::lock_guard<std::mutex> lock(bin.mu);
+            auto &free_list = bin.free_lists[block_size];
+            if (!free_list.empty()) {
+                void *ptr = free_list.back();
+                free_list.pop_back();
+                bin.stats.cached_bytes -= block_size;
+                bin.stats.in_use_bytes += block_size;
+                ++bin.stats.n_hits;
+                return ptr;
+            }
+            ++bin.stats.n_misses;
+        }
+
+        void *ptr = sycl::aligned_alloc(block_alignment, block_size,
+                                        bin.device, bin.context,
+                                        to_sycl_alloc_kind(kind));
+        if (ptr == nullptr) {
+            // release cached blocks of this bin and retry once
+            trim_bin(bin, 0);
+            ptr = sycl::aligned_alloc(block_alignment, block_size, bin.device,
+                                      bin.context, to_sycl_alloc_kind(kind));
+        }
+        if (ptr != nullptr) {
+            std::lock_guard<std::mutex> lock(bin.mu);
+            bin.stats.in_use_bytes += block_size;
+        }
+        return ptr;
+    }
+
+    void deallocate(void *ptr,
+                    const sycl::context &ctx,
+                    const sycl::device &dev,
+                    int kind,
+                    std::size_t block_size)
+    {
+        Bin &bin = get_bin(ctx, dev, kind);
+        {
+            std::lock_guard<std::mutex> lock(bin.mu);
+            bin.stats.in_use_bytes -= block_size;
+            if (enabled_ &&
+                bin.stats.cached_bytes + block_size <= max_cached_bytes_)
+            {
+                bin.free_lists[block_size].push_back(ptr);
+                bin.stats.cached_bytes += block_size;
+                return;
+            }
+        }
+        free_noexcept(ptr, ctx);
+    }
+
+    /*! @brief Free all cached blocks of given kind, returns number of
+     *         released bytes */
+    std::size_t trim(int kind)
+    {
+        std::size_t released = 0;
+        for (auto &bin : bins_snapshot()) {
+            if (kind == USM_POOL_KIND_ALL || bin->kind == kind) {
+                released += trim_bin(*bin, 0);
+            }
+        }
+        return released;
+    }
+
+    USMPoolStats get_stats(int kind)
+    {
+        USMPoolStats res{};
+        for (auto &bin : bins_snapshot()) {
+            if (kind == USM_POOL_KIND_ALL || bin->kind == kind) {
+                std::lock_guard<std::mutex> lock(bin->mu);
+                res.cached_bytes += bin->stats.cached_bytes;
+                res.in_use_bytes += bin->stats.in_use_bytes;
+                res.n_hits += bin->stats.n_hits;
+                res.n_misses += bin->stats.n_misses;
+            }
+        }
+        return res;
+    }
+
+private:
+    struct Bin
+    {
+        sycl::context context;
+        sycl::device device;
+        int kind;
+        std::mutex mu{};
+        std::unordered_map<std::size_t, std::vector<void *>> free_lists{};
+        USMPoolStats stats{};
+
+        Bin(const sycl::context &ctx, const sycl::device &dev, int kind_)
+            : context(ctx), device(dev), kind(kind_)
+        {
+        }
+    };
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<std::size_t> max_cached_bytes_ = default_max_cached_bytes;
+    std::mutex mu_{};
+    std::vector<std::shared_ptr<Bin>> bins_{};
+
+    USMPool() = default;
+
+    static sycl::usm::alloc to_sycl_alloc_kind(int kind)
+    {
+        switch (kind) {
+        case USM_POOL_KIND_SHARED:
+            return sycl::usm::alloc::shared;
+        case USM_POOL_KIND_HOST:
+            return sycl::usm::alloc::host;
+        default:
+            return sycl::usm::alloc::device;
+        }
+    }
+
+    static void free_noexcept(void *ptr, const sycl::context &ctx)
+    {
+        try {
+            sycl::free(ptr, ctx);
+        } catch (const std::exception &e) {
+            std::cout << "Call to sycl::free caught an exception: " << e.what()
+                      << std::endl;
+        }
+    }
+
+    Bin &get_bin(const sycl::context &ctx, const sycl::device &dev, int kind)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        for (auto &bin : bins_) {
+            // host allocations are bound to the context only
+            if (bin->kind == kind && bin->context == ctx &&
+                (kind == USM_POOL_KIND_HOST || bin->device == dev))
+            {
+                return *bin;
+            }
+        }
+        bins_.push_back(std::make_shared<Bin>(ctx, dev, kind));
+        return *(bins_.back());
+    }
+
+    std::vector<std::shared_ptr<Bin>> bins_snapshot()
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        return bins_;
+    }
+
+    /*! @brief Free cached blocks of the bin, largest first, until at most
+     *         `keep_bytes` remain cached */
+    std::size_t trim_bin(Bin &bin, std::size_t keep_bytes)
+    {
+        std::vector<std::pair<void *, std::size_t>> to_free;
+        {
+            std::lock_guard<std::mutex> lock(bin.mu);
+            std::vector<std::size_t> classes;
+            classes.reserve(bin.free_lists.size());
+            for (const auto &entry : bin.free_lists) {
+                classes.push_back(entry.first);
+            }
+            std::sort(classes.begin(), classes.end(),
+                      [](std::size_t a, std::size_t b) { return a > b; });
+            for (const std::size_t cls : classes) {
+                auto &free_list = bin.free_lists[cls];
+                while (bin.stats.cached_bytes > keep_bytes &&
+                       !free_list.empty())
+                {
+                    to_free.emplace_back(free_list.back(), cls);
+                    free_list.pop_back();
+                    bin.stats.cached_bytes -= cls;
+                }
+            }
+        }
+
+        std::size_t released = 0;
+        for (const auto &[ptr, cls] : to_free) {
+            free_noexcept(ptr, bin.context);
+            released += cls;
+        }
+        return released;
+    }
+};
+
+class USMPoolDeleter
+{
+public:
+    USMPoolDeleter() = delete;
+    USMPoolDeleter(const sycl::queue &q, int kind, std::size_t block_size)
+        : _context(q.get_context()), _device(q.get_device()), _kind(kind),
+          _block_size(block_size)
+    {
+    }
+
+    template <typename T> void operator()(T *ptr) const
+    {
+        USMPool::get().deallocate(ptr, _context, _device, _kind, _block_size);
+    }
+
+private:
+    ::sycl::context _context;
+    ::sycl::device _device;
+    int _kind;
+    std::size_t _block_size;
+};
+
+} // namespace detail
+
+/*! @brief Allocate from the pool. On success returns opaque smart pointer
+ *  which returns the block to the pool when released, and sets `usm_ptr`.
+ *  Returns `nullptr` if the pool is disabled, or can not serve the request.
+ */
+void *USMPool_MakeAllocation(DPCTLSyclQueueRef QRef,
+                             std::size_t nbytes,
+                             std::size_t alignment,
+                             int kind,
+                             void **usm_ptr)
+{
+    auto &pool = detail::USMPool::get();
+    if (!pool.is_enabled()) {
+        return nullptr;
+    }
+
+    sycl::queue *q_ptr = dpctl::syclinterface::unwrap<sycl::queue>(QRef);
+    std::size_t block_size = 0;
+    void *ptr = nullptr;
+    try {
+        ptr = pool.allocate(*q_ptr, nbytes, alignment, kind, block_size);
+    } catch (const std::exception &e) {
+        std::cout << "USM pool allocation caught an exception: " << e.what()
+                  << std::endl;
+        ptr = nullptr;
+    }
+    if (ptr == nullptr) {
+        return nullptr;
+    }
+
+    detail::USMPoolDeleter _deleter(*q_ptr, kind, block_size);
+    auto sptr = new std::shared_ptr<void>(ptr, std::move(_deleter));
+    *usm_ptr = ptr;
+
+    return reinterpret_cast<void *>(sptr);
+}
+
+int USMPool_IsEnabled() { return detail::USMPool::get().is_enabled(); }
+
+void USMPool_SetEnabled(int enabled)
+{
+    detail::USMPool::get().set_enabled(enabled != 0);
+}
+
+std::size_t USMPool_GetMaxCachedBytes()
+{
+    return detail::USMPool::get().get_max_cached_bytes();
+}
+
+void USMPool_SetMaxCachedBytes(std::size_t max_cached_bytes)
+{
+    detail::USMPool::get().set_max_cached_bytes(max_cached_bytes);
+}
+
+std::size_t USMPool_Trim(int kind) { return detail::USMPool::get().trim(kind); }
+
+void USMPool_GetStats(int kind,
+                      std::size_t *cached_bytes,
+                      std::size_t *in_use_bytes,
+                      std::size_t *n_hits,
+                      std::size_t *n_misses)
+{
+    const auto &stats = detail::USMPool::get().get_stats(kind);
+    *cached_bytes = stats.cached_bytes;
+    *in_use_bytes = stats.in_use_bytes;
+    *n_hits = stats.n_hits;
+    *n_misses = stats.n_misses;
+}
@@ -24,13 +24,25 @@ from ._program import (
     SyclKernel,
     SyclProgram,
     SyclProgramCompilationError,
+    clear_program_cache,
     create_program_from_source,
     create_program_from_spirv,
+    get_program_cache_dir,
+    get_program_cache_limits,
+    get_program_cache_stats,
+    set_program_cache_dir,
+    set_program_cache_limits,
 )
 
 __all__ = [
+    "clear_program_cache",
     "create_program_from_source",
     "create_program_from_spirv",
+    "get_program_cache_dir",
+    "get_program_cache_limits",
+    "get_program_cache_stats",
+    "set_program_cache_dir",
+    "set_program_cache_limits",
     "SyclKernel",
     "SyclProgram",
     "SyclProgramCompilationError",
@@ -25,9 +25,12 @@ a OpenCL source string or a SPIR-V binary file.
 
 """
 
+import os
+
 from libc.stdint cimport uint32_t
 
 from dpctl._backend cimport (  # noqa: E211, E402;
+    DPCTLCString_Delete,
     DPCTLKernel_Copy,
     DPCTLKernel_Delete,
     DPCTLKernel_GetCompileNumSubGroups,
@@ -41,9 +44,19 @@ from dpctl._backend cimport (  # noqa: E211, E402;
     DPCTLKernelBundle_Copy,
     DPCTLKernelBundle_CreateFromOCLSource,
     DPCTLKernelBundle_CreateFromSpirv,
+    DPCTLKernelBundle_ClearProgramCache,
     DPCTLKernelBundle_Delete,
     DPCTLKernelBundle_GetKernel,
+    DPCTLKernelBundle_GetProgramCacheDir,
+    DPCTLKernelBundle_GetProgramCacheDiskHits,
+    DPCTLKernelBundle_GetProgramCacheDiskLimit,
+    DPCTLKernelBundle_GetProgramCacheMemoryHits,
+    DPCTLKernelBundle_GetProgramCacheMemoryLimit,
+    DPCTLKernelBundle_GetProgramCacheMisses,
+    DPCTLKernelBundle_GetProgramCacheRejected,
     DPCTLKernelBundle_HasKernel,
+    DPCTLKernelBundle_SetProgramCacheDir,
+    DPCTLKernelBundle_SetProgramCacheLimits,
     DPCTLSyclContextRef,
     DPCTLSyclDeviceRef,
     DPCTLSyclKernelBundleRef,
@@ -51,8 +64,14 @@ from dpctl._backend cimport (  # noqa: E211, E402;
 )
 
 __all__ = [
+    "clear_program_cache",
     "create_program_from_source",
     "create_program_from_spirv",
+    "get_program_cache_dir",
+    "get_program_cache_limits",
+    "get_program_cache_stats",
+    "set_program_cache_dir",
+    "set_program_cache_limits",
     "SyclKernel",
     "SyclProgram",
     "SyclProgramCompilationError",
@@ -320,6 +339,110 @@ cpdef create_program_from_spirv(SyclQueue q, const unsigned char[:] IL,
     return SyclProgram._create(KBref)
 
 
+def set_program_cache_dir(path):
+    """
+        Sets the directory where compiled binaries of programs created by
+        :func:`create_program_from_source` and
+        :func:`create_program_from_spirv` are persisted.
+
+        Binaries are keyed by a hash of the program source or SPIR-V, the
+        compilation flags, the device and its driver version. Creating a
+        program whose binary is found in the cache skips its compilation.
+        The initial directory is taken from the environment variable
+        ``DPCTL_PROGRAM_CACHE_DIR``.
+
+        Parameters:
+            path (str, os.PathLike, None)
+                Path to the cache directory, created if it does not exist.
+                ``None`` disables persistent caching, binaries are then
+                only cached in memory for the lifetime of the process.
+    """
+    cdef bytes bPath
+    if path is None:
+        DPCTLKernelBundle_SetProgramCacheDir(NULL)
+    else:
+        bPath = os.fsencode(path)
+        DPCTLKernelBundle_SetProgramCacheDir(<const char*>bPath)
+
+
+def get_program_cache_dir():
+    """
+        Returns the directory of the persistent program binary cache.
+
+        Returns:
+            path (str, None)
+                Path to the cache directory, or ``None`` if persistent
+                caching is disabled.
+    """
+    cdef const char *cpath = DPCTLKernelBundle_GetProgramCacheDir()
+    if cpath is NULL:
+        return None
+    try:
+        path = os.fsdecode(<bytes>cpath)
+    finally:
+        DPCTLCString_Delete(cpath)
+    return path if path else None
+
+
+def set_program_cache_limits(*, memory=None, disk=None):
+    """
+        Sets limits on total size of program binaries cached in memory and
+        in the cache directory. Least recently used binaries in excess of a
+        limit are evicted.
+
+        Parameters:
+            memory (int, optional)
+                Limit for binaries kept in memory, in bytes. If ``None``,
+                the limit is not changed. Default: ``None``.
+            disk (int, optional)
+                Limit for binaries kept in the cache directory, in bytes.
+                If ``None``, the limit is not changed. Default: ``None``.
+
+        Raises:
+            ValueError
+                If a limit is negative.
+    """
+    cdef size_t mem_limit = DPCTLKernelBundle_GetProgramCacheMemoryLimit()
+    cdef size_t disk_limit = DPCTLKernelBundle_GetProgramCacheDiskLimit()
+    if memory is not None:
+        if memory < 0:
+            raise ValueError("Memory limit must be non-negative")
+        mem_limit = memory
+    if disk is not None:
+        if disk < 0:
+            raise ValueError("Disk limit must be non-negative")
+        disk_limit = disk
+    DPCTLKernelBundle_SetProgramCacheLimits(mem_limit, disk_limit)
+
+
+def get_program_cache_limits():
+    """
+        Returns limits on total size of program binaries cached in memory
+        and in the cache directory.
+
+        Returns:
+            limits (dict)
+                Dictionary with keys ``"memory"`` and ``"disk"`` mapping to
+                the respective limits in bytes.
+    """
+    return {
+        "memory": DPCTLKernelBundle_GetProgramCacheMemoryLimit(),
+        "disk": DPCTLKernelBundle_GetProgramCacheDiskLimit(),
+    }
+
+
+def clear_program_cache(*, disk=False):
+    """
+        Removes program binaries cached in memory.
+
+        Parameters:
+            disk (bool, optional)
+                If ``True``, binaries persisted in the cache directory are
+                removed too. Default: ``False``.
+    """
+    DPCTLKernelBundle_ClearProgramCache(bool(disk))
+
+
 cdef api DPCTLSyclKernelBundleRef SyclProgram_GetKernelBundleRef(
     SyclProgram pro
 ):
@@ -337,3 +460,25 @@ cdef api SyclProgram SyclProgram_Make(DPCTLSyclKernelBundleRef KBRef):
     """
     cdef DPCTLSyclKernelBundleRef copied_KBRef = DPCTLKernelBundle_Copy(KBRef)
     return SyclProgram._create(copied_KBRef)
+
+
+def get_program_cache_stats():
+    """
+        Returns counters of lookups of the program binary cache since the
+        process started.
+
+        Returns:
+            stats (dict)
+                Dictionary with keys ``"memory_hits"`` and ``"disk_hits"``
+                mapping to the numbers of binaries found in memory and in
+                the cache directory, ``"misses"`` mapping to the number of
+                programs whose binary was not found, and ``"rejected"``
+                mapping to the number of found binaries that the driver
+                rejected, so that the program was compiled instead.
+    """
+    return {
+        "memory_hits": DPCTLKernelBundle_GetProgramCacheMemoryHits(),
+        "disk_hits": DPCTLKernelBundle_GetProgramCacheDiskHits(),
+        "misses": DPCTLKernelBundle_GetProgramCacheMisses(),
+        "rejected": DPCTLKernelBundle_GetProgramCacheRejected(),
+    }
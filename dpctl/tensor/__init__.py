@@ -23,7 +23,15 @@
     [ArrayAPI] https://data-apis.org/array-api
 """
 
-from dpctl.tensor._copy_utils import asnumpy, astype, copy, from_numpy, to_numpy
+from dpctl.tensor._copy_utils import (
+    asnumpy,
+    astype,
+    copy,
+    from_numpy,
+    from_numpy_async,
+    to_numpy,
+    to_numpy_async,
+)
 from dpctl.tensor._ctors import (
     arange,
     asarray,
@@ -65,8 +73,11 @@ from dpctl.tensor._dldevice_conversions import (
 )
 from dpctl.tensor._dlpack import from_dlpack
 from dpctl.tensor._indexing_functions import (
+    PaddedArray,
     extract,
+    extract_deferred,
     nonzero,
+    nonzero_deferred,
     place,
     put,
     put_along_axis,
@@ -104,7 +115,13 @@ from dpctl.tensor._print import (
 )
 from dpctl.tensor._reshape import reshape
 from dpctl.tensor._search_functions import where
-from dpctl.tensor._statistical_functions import mean, std, var
+from dpctl.tensor._statistical_functions import (
+    bincount,
+    histogram,
+    mean,
+    std,
+    var,
+)
 from dpctl.tensor._usmarray import DLDeviceType, usm_ndarray
 from dpctl.tensor._utility_functions import all, any, diff
 
@@ -185,16 +202,21 @@ from ._elementwise_funcs import (
     tanh,
     trunc,
 )
+from ._fuse import fuse
 from ._reduction import (
     argmax,
     argmin,
     count_nonzero,
     logsumexp,
     max,
+    max_with_argmax,
     min,
+    minmax,
     prod,
     reduce_hypot,
+    segment_reduce,
     sum,
+    sum_and_sumsq,
 )
 from ._searchsorted import searchsorted
 from ._set_functions import (
@@ -237,10 +259,15 @@ __all__ = [
     "take",
     "put",
     "extract",
+    "extract_deferred",
     "place",
     "nonzero",
+    "nonzero_deferred",
+    "PaddedArray",
     "from_numpy",
+    "from_numpy_async",
     "to_numpy",
+    "to_numpy_async",
     "asnumpy",
     "from_dlpack",
     "tril",
@@ -355,6 +382,10 @@ __all__ = [
     "tile",
     "max",
     "min",
+    "minmax",
+    "max_with_argmax",
+    "sum_and_sumsq",
+    "segment_reduce",
     "argmax",
     "argmin",
     "prod",
@@ -368,6 +399,8 @@ __all__ = [
     "mean",
     "std",
     "var",
+    "bincount",
+    "histogram",
     "__array_api_version__",
     "__array_namespace_info__",
     "reciprocal",
@@ -394,4 +427,5 @@ __all__ = [
     "top_k",
     "dldevice_to_sycl_device",
     "sycl_device_to_dldevice",
+    "fuse",
 ]
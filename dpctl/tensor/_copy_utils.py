@@ -63,6 +63,43 @@ def _copy_to_numpy(ary):
     )
 
 
+def _copy_to_numpy_async(ary, repack=True):
+    if not isinstance(ary, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(ary)}")
+    if ary.size == 0:
+        # no data needs to be copied for zero sized array
+        return np.ndarray(ary.shape, dtype=ary.dtype), dpctl.SyclEvent()
+    q = ary.sycl_queue
+    _manager = dpctl.utils.SequentialOrderManager[q]
+    dep_evs = _manager.submitted_events
+    if ary.flags.c_contiguous:
+        order = "C"
+    elif ary.flags.f_contiguous:
+        order = "F"
+    else:
+        order = "C"
+        if repack:
+            # pack elements on the device, so that only
+            # ary.nbytes bytes are transferred to the host
+            packed = dpt.empty(
+                ary.shape, dtype=ary.dtype, usm_type="device", sycl_queue=q
+            )
+            ht_ev, pack_ev = ti._copy_usm_ndarray_into_usm_ndarray(
+                src=ary, dst=packed, sycl_queue=q, depends=dep_evs
+            )
+            _manager.add_event_pair(ht_ev, pack_ev)
+            ary = packed
+            dep_evs = [pack_ev]
+    hh = dpm.MemoryUSMHost(ary.nbytes, queue=q)
+    h_usm = dpt.usm_ndarray(ary.shape, dtype=ary.dtype, buffer=hh, order=order)
+    ht_ev, cpy_ev = ti._copy_usm_ndarray_into_usm_ndarray(
+        src=ary, dst=h_usm, sycl_queue=q, depends=dep_evs
+    )
+    _manager.add_event_pair(ht_ev, cpy_ev)
+    h = np.ndarray(ary.shape, dtype=ary.dtype, buffer=hh, order=order)
+    return h, cpy_ev
+
+
 def _copy_from_numpy(np_ary, usm_type="device", sycl_queue=None):
     "Copies numpy array `np_ary` into a new usm_ndarray"
     # This may perform a copy to meet stated requirements
@@ -82,6 +119,29 @@ def _copy_from_numpy(np_ary, usm_type="device", sycl_queue=None):
     return Xusm
 
 
+def _copy_from_numpy_async(np_ary, usm_type="device", sycl_queue=None):
+    """Copies numpy array `np_ary` into a new usm_ndarray through pinned
+    staging buffers without waiting for the copy to complete"""
+    Xnp = np.require(np_ary, requirements=["C", "A", "E"])
+    alloc_q = normalize_queue_device(sycl_queue=sycl_queue, device=None)
+    if alloc_q.sycl_device.has_aspect_fp64 is False:
+        # device can not read double precision data, cast on the host
+        if Xnp.dtype.char == "d":
+            Xnp = Xnp.astype(np.float32)
+        elif Xnp.dtype.char == "D":
+            Xnp = Xnp.astype(np.complex64)
+    Xusm = dpt.empty(
+        Xnp.shape, dtype=Xnp.dtype, usm_type=usm_type, sycl_queue=alloc_q
+    )
+    _manager = dpctl.utils.SequentialOrderManager[alloc_q]
+    dep_ev = _manager.submitted_events
+    ht_ev, cpy_ev = ti._copy_numpy_ndarray_into_usm_ndarray_async(
+        src=Xnp, dst=Xusm, sycl_queue=alloc_q, depends=dep_ev
+    )
+    _manager.add_event_pair(ht_ev, cpy_ev)
+    return Xusm
+
+
 def _copy_from_numpy_into(dst, np_ary):
     "Copies `np_ary` into `dst` of type :class:`dpctl.tensor.usm_ndarray"
     if not isinstance(np_ary, np.ndarray):
@@ -195,6 +255,46 @@ def asnumpy(usm_ary):
     return _copy_to_numpy(usm_ary)
 
 
+def to_numpy_async(usm_ary, /, *, repack=True):
+    """
+    to_numpy_async(usm_ary, repack=True)
+
+    Starts copying content of :class:`dpctl.tensor.usm_ndarray` instance
+    ``usm_ary`` into :class:`numpy.ndarray` instance of the same shape and
+    same data type, without waiting for the copy to complete.
+
+    The returned NumPy array is backed by USM-host (pinned) memory bound
+    to the context of ``usm_ary.sycl_queue``, and is C-contiguous unless
+    ``usm_ary`` is F-contiguous. Its content must not be accessed until
+    the returned event completes.
+
+    Args:
+        usm_ary (usm_ndarray):
+            Input array
+        repack (bool, optional):
+            If ``True``, elements of non-contiguous input array are first
+            packed into a contiguous temporary on the device, so that only
+            elements of ``usm_ary`` are transferred to the host. Otherwise
+            the device writes elements into host memory directly.
+            Default: ``True``
+    Returns:
+        Tuple[:class:`numpy.ndarray`, :class:`dpctl.SyclEvent`]:
+            NumPy array to be populated with content of ``usm_ary``, and
+            the event signaling completion of the copy
+
+    :Example:
+        .. code-block:: python
+
+            import dpctl.tensor as dpt
+
+            x = dpt.arange(10**6, dtype="f4")
+            x_np, ev = dpt.to_numpy_async(x)
+            # do other work, then
+            ev.wait()
+    """
+    return _copy_to_numpy_async(usm_ary, repack=repack)
+
+
 class Dummy:
     """
     Helper class with specified ``__sycl_usm_array_interface__`` attribute
@@ -204,6 +304,55 @@ class Dummy:
         self.__sycl_usm_array_interface__ = iface
 
 
+def from_numpy_async(
+    np_ary, /, *, device=None, usm_type="device", sycl_queue=None
+):
+    """
+    from_numpy_async(arg, device=None, usm_type="device", sycl_queue=None)
+
+    Creates :class:`dpctl.tensor.usm_ndarray` from instance of
+    :class:`numpy.ndarray` without waiting for data to be copied.
+
+    Data are copied in chunks through a pool of pinned USM-host staging
+    buffers, so that copying a chunk into a staging buffer overlaps with
+    the transfer of the preceding chunk to the device. Subsequent
+    operations on the returned array are ordered after the copy.
+
+    The input array must not be modified until the copy completes, e.g.
+    until ``dpctl.utils.SequentialOrderManager[q].wait()`` returns for the
+    queue ``q`` associated with the returned array.
+
+    Args:
+        arg:
+            Input convertible to :class:`numpy.ndarray`
+        device (object): array API specification of device where the
+            output array is created. Device can be specified by
+            a filter selector string, an instance of
+            :class:`dpctl.SyclDevice`, an instance of
+            :class:`dpctl.SyclQueue`, or an instance of
+            :class:`dpctl.tensor.Device`. If the value is ``None``,
+            returned array is created on the default-selected device.
+            Default: ``None``
+        usm_type (str): The requested USM allocation type for the
+            output array. Recognized values are ``"device"``,
+            ``"shared"``, or ``"host"``
+        sycl_queue (:class:`dpctl.SyclQueue`, optional):
+            A SYCL queue that determines output array allocation device
+            as well as execution placement of data movement operations.
+            The ``device`` and ``sycl_queue`` arguments
+            are equivalent. Only one of them should be specified. If both
+            are provided, they must be consistent and result in using the
+            same execution queue. Default: ``None``
+
+    The returned array is C-contiguous, and has the same shape and
+    data type as the input array, except that double precision data types
+    are cast to single precision ones if the target device does not
+    support them.
+    """
+    q = normalize_queue_device(sycl_queue=sycl_queue, device=device)
+    return _copy_from_numpy_async(np_ary, usm_type=usm_type, sycl_queue=q)
+
+
 def _copy_overlapping(dst, src):
     """Assumes src and dst have the same shape."""
     q = normalize_queue_device(sycl_queue=dst.sycl_queue)
@@ -749,9 +898,10 @@ def astype(
     return R
 
 
-def _extract_impl(ary, ary_mask, axis=0):
-    """Extract elements of ary by applying mask starting from slot
-    dimension axis"""
+def _get_mask_queue_usm_type(ary, ary_mask):
+    """Validates that mask is compatible with ary, and returns the mask
+    as usm_ndarray together with execution queue and usm type of the
+    result"""
     if not isinstance(ary, dpt.usm_ndarray):
         raise TypeError(
             f"Expecting type dpctl.tensor.usm_ndarray, got {type(ary)}"
@@ -779,6 +929,13 @@ def _extract_impl(ary, ary_mask, axis=0):
             "Expecting type dpctl.tensor.usm_ndarray or numpy.ndarray, got "
             f"{type(ary_mask)}"
         )
+    return ary_mask, exec_q, dst_usm_type
+
+
+def _extract_impl(ary, ary_mask, axis=0):
+    """Extract elements of ary by applying mask starting from slot
+    dimension axis"""
+    ary_mask, exec_q, dst_usm_type = _get_mask_queue_usm_type(ary, ary_mask)
     ary_nd = ary.ndim
     pp = normalize_axis_index(operator.index(axis), ary_nd)
     mask_nd = ary_mask.ndim
@@ -845,6 +1002,106 @@ def _nonzero_impl(ary):
     return res
 
 
+def _mask_count_async(ary_mask, cumsum, usm_type, exec_q):
+    """Submits computation of positions of non-zero mask elements into
+    cumsum, and returns 0-d array with their count without waiting for
+    the computation to complete"""
+    _manager = dpctl.utils.SequentialOrderManager[exec_q]
+    if cumsum.size == 0:
+        return dpt.zeros(
+            (), dtype=cumsum.dtype, usm_type=usm_type, sycl_queue=exec_q
+        )
+    dep_evs = _manager.submitted_events
+    hev, cs_ev = ti._mask_positions_async(
+        ary_mask, cumsum, sycl_queue=exec_q, depends=dep_evs
+    )
+    _manager.add_event_pair(hev, cs_ev)
+    # inclusive cumulative sum ends with the number of non-zero elements
+    return cumsum[-1]
+
+
+def _extract_deferred_impl(ary, ary_mask, axis=0):
+    """Extract elements of ary by applying mask starting from slot
+    dimension axis into array allocated for the case of all mask elements
+    being non-zero. Returns that array and 0-d array with the number of
+    extracted elements along the masked dimension. Nothing waits for the
+    count to be computed, elements past the count are unspecified."""
+    ary_mask, exec_q, dst_usm_type = _get_mask_queue_usm_type(ary, ary_mask)
+    ary_nd = ary.ndim
+    pp = normalize_axis_index(operator.index(axis), ary_nd)
+    mask_nd = ary_mask.ndim
+    if pp < 0 or pp + mask_nd > ary_nd:
+        raise ValueError(
+            "Parameter p is inconsistent with input array dimensions"
+        )
+    mask_nelems = ary_mask.size
+    cumsum_dt = dpt.int32 if mask_nelems < int32_t_max else dpt.int64
+    cumsum = dpt.empty(
+        mask_nelems,
+        dtype=cumsum_dt,
+        usm_type=dst_usm_type,
+        sycl_queue=exec_q,
+    )
+    count = _mask_count_async(ary_mask, cumsum, dst_usm_type, exec_q)
+    dst_shape = ary.shape[:pp] + (mask_nelems,) + ary.shape[pp + mask_nd :]
+    dst = dpt.empty(
+        dst_shape, dtype=ary.dtype, usm_type=dst_usm_type, sycl_queue=exec_q
+    )
+    if dst.size == 0:
+        return dst, count
+    _manager = dpctl.utils.SequentialOrderManager[exec_q]
+    dep_evs = _manager.submitted_events
+    hev, ev = ti._extract(
+        src=ary,
+        cumsum=cumsum,
+        axis_start=pp,
+        axis_end=pp + mask_nd,
+        dst=dst,
+        sycl_queue=exec_q,
+        depends=dep_evs,
+    )
+    _manager.add_event_pair(hev, ev)
+    return dst, count
+
+
+def _nonzero_deferred_impl(ary):
+    """Returns array of shape (ary.ndim, ary.size) whose leading columns
+    hold indices of non-zero elements of ary, and 0-d array with the
+    number of such columns, without waiting for the number to be
+    computed"""
+    if not isinstance(ary, dpt.usm_ndarray):
+        raise TypeError(
+            f"Expecting type dpctl.tensor.usm_ndarray, got {type(ary)}"
+        )
+    exec_q = ary.sycl_queue
+    usm_type = ary.usm_type
+    mask_nelems = ary.size
+    cumsum_dt = dpt.int32 if mask_nelems < int32_t_max else dpt.int64
+    cumsum = dpt.empty(
+        mask_nelems,
+        dtype=cumsum_dt,
+        usm_type=usm_type,
+        sycl_queue=exec_q,
+        order="C",
+    )
+    count = _mask_count_async(ary, cumsum, usm_type, exec_q)
+    indexes_dt = ti.default_device_index_type(exec_q.sycl_device)
+    indexes = dpt.empty(
+        (ary.ndim, mask_nelems),
+        dtype=indexes_dt,
+        usm_type=usm_type,
+        sycl_queue=exec_q,
+        order="C",
+    )
+    if mask_nelems == 0:
+        return indexes, count
+    _manager = dpctl.utils.SequentialOrderManager[exec_q]
+    dep_evs = _manager.submitted_events
+    hev, nz_ev = ti._nonzero(cumsum, indexes, ary.shape, exec_q, dep_evs)
+    _manager.add_event_pair(hev, nz_ev)
+    return indexes, count
+
+
 def _get_indices_queue_usm_type(inds, queue, usm_type):
     """
     Utility for validating indices are NumPy ndarray or usm_ndarray of integral
@@ -1049,10 +1306,23 @@ def _place_impl(ary, ary_mask, vals, axis=0):
     )
     exec_q = cumsum.sycl_queue
     _manager = dpctl.utils.SequentialOrderManager[exec_q]
-    dep_ev = _manager.submitted_events
-    mask_count = ti.mask_positions(
-        ary_mask, cumsum, sycl_queue=exec_q, depends=dep_ev
-    )
+    # position of masked dimension in vals aligned for broadcasting
+    vals_pp = vals.ndim - (ary_nd - mask_nd + 1) + pp
+    if vals_pp < 0 or vals.shape[vals_pp] == 1:
+        # vals are broadcast along the masked dimension, so validating
+        # their shape does not need the count of non-zero mask elements
+        if mask_nelems > 0:
+            dep_ev = _manager.submitted_events
+            hev, cs_ev = ti._mask_positions_async(
+                ary_mask, cumsum, sycl_queue=exec_q, depends=dep_ev
+            )
+            _manager.add_event_pair(hev, cs_ev)
+        mask_count = mask_nelems
+    else:
+        dep_ev = _manager.submitted_events
+        mask_count = ti.mask_positions(
+            ary_mask, cumsum, sycl_queue=exec_q, depends=dep_ev
+        )
     expected_vals_shape = (
         ary.shape[:pp] + (mask_count,) + ary.shape[pp + mask_nd :]
     )
@@ -1077,7 +1347,103 @@ def _place_impl(ary, ary_mask, vals, axis=0):
     return
 
 
-def _put_multi_index(ary, inds, p, vals, mode=0):
+_put_reduce_ops = {"add": 1, "mul": 2, "max": 3, "min": 4}
+
+
+def _get_put_reduce_op(reduce):
+    """
+    Returns code of reduction operation `reduce` of put functions, or 0 if
+    `reduce` is `None`.
+    """
+    if reduce is None:
+        return 0
+    if not isinstance(reduce, str) or reduce not in _put_reduce_ops:
+        raise ValueError(
+            "`reduce` must be one of "
+            f"{', '.join(map(repr, _put_reduce_ops))} or None, "
+            f"got {reduce!r}"
+        )
+    return _put_reduce_ops[reduce]
+
+
+def _put_reduce_by_sorting(ary, inds, p, rhs, mode, reduce_op, exec_q):
+    """
+    Combines elements of `ary` at indices `inds` with values `rhs` using
+    reduction `reduce_op`, without atomic operations. Values are sorted by
+    the position they update, and values updating the same position are
+    reduced by a segmented scan, before being combined with `ary`.
+    """
+    op = {1: dpt.add, 2: dpt.multiply, 3: dpt.maximum, 4: dpt.minimum}[
+        reduce_op
+    ]
+    ind_dt = ti.default_device_index_type(exec_q.sycl_device)
+    # linear position in `ary` of the element each value updates
+    pos = dpt.arange(
+        ary.size, dtype=ind_dt, usm_type=rhs.usm_type, sycl_queue=exec_q
+    )
+    pos = _take_multi_index(dpt.reshape(pos, ary.shape), inds, p, mode=mode)
+    pos = dpt.reshape(pos, (pos.size,))
+    vals = dpt.reshape(rhs, (rhs.size,))
+
+    order = dpt.argsort(pos, stable=True)
+    pos = dpt.take(pos, order)
+    vals = dpt.take(vals, order)
+
+    # inclusive segmented scan by recursive doubling: after it, the last
+    # value of each run of equal positions is the reduction of the run
+    n = pos.size
+    shift = 1
+    while shift < n:
+        same = pos[shift:] == pos[:-shift]
+        tail = dpt.where(same, op(vals[:-shift], vals[shift:]), vals[shift:])
+        vals = dpt.concat((vals[:shift], tail))
+        shift *= 2
+    is_last = dpt.concat(
+        (
+            pos[:-1] != pos[1:],
+            dpt.ones(1, dtype="?", usm_type=pos.usm_type, sycl_queue=exec_q),
+        )
+    )
+    pos = pos[is_last]
+    vals = vals[is_last]
+
+    c_contig = ary.flags.c_contiguous
+    # reshape of C-contiguous array is a view, otherwise a copy
+    ary_flat = dpt.reshape(ary, (ary.size,))
+    dpt.put(ary_flat, pos, op(dpt.take(ary_flat, pos), vals))
+    if not c_contig:
+        ary[...] = dpt.reshape(ary_flat, ary.shape)
+
+
+def _put_reduce_impl(ary, inds, p, rhs, mode, reduce_op, exec_q):
+    """
+    Combines elements of `ary` at indices `inds` along axes starting at `p`
+    with values `rhs` using reduction `reduce_op`, accumulating values at
+    duplicate indices. Uses atomic operations where supported.
+    """
+    if rhs.size == 0:
+        return
+    if ti._put_reduce_atomic_supported(
+        ary.dtype, reduce_op, ary.usm_type, exec_q
+    ):
+        _manager = dpctl.utils.SequentialOrderManager[exec_q]
+        dep_ev = _manager.submitted_events
+        hev, put_ev = ti._put(
+            dst=ary,
+            ind=inds,
+            val=rhs,
+            axis_start=p,
+            mode=mode,
+            sycl_queue=exec_q,
+            depends=dep_ev,
+            reduce_op=reduce_op,
+        )
+        _manager.add_event_pair(hev, put_ev)
+    else:
+        _put_reduce_by_sorting(ary, inds, p, rhs, mode, reduce_op, exec_q)
+
+
+def _put_multi_index(ary, inds, p, vals, mode=0, reduce_op=0):
     if not isinstance(ary, dpt.usm_ndarray):
         raise TypeError(
             f"Expecting type dpctl.tensor.usm_ndarray, got {type(ary)}"
@@ -1135,6 +1501,9 @@ def _put_multi_index(ary, inds, p, vals, mode=0):
     else:
         rhs = dpt.astype(vals, ary.dtype)
     rhs = dpt.broadcast_to(rhs, expected_vals_shape)
+    if reduce_op:
+        _put_reduce_impl(ary, inds, p, rhs, mode, reduce_op, exec_q)
+        return
     _manager = dpctl.utils.SequentialOrderManager[exec_q]
     dep_ev = _manager.submitted_events
     hev, put_ev = ti._put(
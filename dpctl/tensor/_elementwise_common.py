@@ -27,6 +27,7 @@ from dpctl.tensor._usmarray import _is_object_with_buffer_protocol as _is_buffer
 from dpctl.utils import ExecutionPlacementError, SequentialOrderManager
 
 from ._copy_utils import _empty_like_orderK, _empty_like_pair_orderK
+from ._fuse import _FusedNode
 from ._type_utils import (
     WeakBooleanType,
     WeakComplexType,
@@ -177,6 +178,12 @@ class UnaryElementwiseFunc:
         return types
 
     def __call__(self, x, /, *, out=None, order="K"):
+        if isinstance(x, _FusedNode):
+            if out is not None:
+                raise TypeError(
+                    "Keyword `out` is not supported in fused expressions"
+                )
+            return _FusedNode._unary(self, x)
         if not isinstance(x, dpt.usm_ndarray):
             raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
 
@@ -549,6 +556,12 @@ class BinaryElementwiseFunc:
         return types
 
     def __call__(self, o1, o2, /, *, out=None, order="K"):
+        if isinstance(o1, _FusedNode) or isinstance(o2, _FusedNode):
+            if out is not None:
+                raise TypeError(
+                    "Keyword `out` is not supported in fused expressions"
+                )
+            return _FusedNode._binary(self, o1, o2)
         if order not in ["K", "C", "F", "A"]:
             order = "K"
         q1, o1_usm_type = _get_queue_usm_type(o1)
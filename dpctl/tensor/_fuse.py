@@ -0,0 +1,394 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2025 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import functools
+import numbers
+import struct
+
+import dpctl
+import dpctl.tensor as dpt
+import dpctl.tensor._tensor_elementwise_impl as tei
+import dpctl.tensor._tensor_impl as ti
+from dpctl.tensor._manipulation_functions import _broadcast_shape_impl
+from dpctl.utils import ExecutionPlacementError, SequentialOrderManager
+
+from ._copy_utils import _empty_like_orderK
+
+# operation codes of the fused expression kernel,
+# see libtensor/include/kernels/elementwise_functions/fused.hpp
+_LOAD_INPUT = 0
+_LOAD_SCALAR = 1
+_fused_opcodes = {
+    "negative": 2,
+    "abs": 3,
+    "exp": 4,
+    "expm1": 5,
+    "log": 6,
+    "log1p": 7,
+    "sqrt": 8,
+    "square": 9,
+    "sin": 10,
+    "cos": 11,
+    "tanh": 12,
+    "add": 13,
+    "subtract": 14,
+    "multiply": 15,
+    "divide": 16,
+    "maximum": 17,
+    "minimum": 18,
+}
+
+
+class _FusedNode:
+    """
+    Node of an expression graph recorded while tracing function passed
+    to :func:`dpctl.tensor.fuse`.
+
+    Leaf nodes are arguments of the fused function (``kind == "input"``),
+    arrays captured by the traced function (``kind == "array"``), or Python
+    scalars (``kind == "scalar"``). Other nodes are applications of
+    elementwise functions (``kind == "op"``).
+    """
+
+    __slots__ = ("kind", "value", "fn", "args")
+
+    def __init__(self, kind, value=None, fn=None, args=()):
+        self.kind = kind
+        self.value = value
+        self.fn = fn
+        self.args = args
+
+    @staticmethod
+    def _as_node(o):
+        if isinstance(o, _FusedNode):
+            return o
+        if isinstance(o, dpt.usm_ndarray):
+            return _FusedNode("array", value=o)
+        if isinstance(o, numbers.Number):
+            return _FusedNode("scalar", value=o)
+        raise TypeError(
+            f"Unsupported operand of fused expression of type {type(o)}"
+        )
+
+    @staticmethod
+    def _unary(fn, x):
+        return _FusedNode("op", fn=fn, args=(x,))
+
+    @staticmethod
+    def _binary(fn, o1, o2):
+        args = (_FusedNode._as_node(o1), _FusedNode._as_node(o2))
+        return _FusedNode("op", fn=fn, args=args)
+
+    def __add__(self, other):
+        return _FusedNode._binary(dpt.add, self, other)
+
+    def __radd__(self, other):
+        return _FusedNode._binary(dpt.add, other, self)
+
+    def __sub__(self, other):
+        return _FusedNode._binary(dpt.subtract, self, other)
+
+    def __rsub__(self, other):
+        return _FusedNode._binary(dpt.subtract, other, self)
+
+    def __mul__(self, other):
+        return _FusedNode._binary(dpt.multiply, self, other)
+
+    def __rmul__(self, other):
+        return _FusedNode._binary(dpt.multiply, other, self)
+
+    def __truediv__(self, other):
+        return _FusedNode._binary(dpt.divide, self, other)
+
+    def __rtruediv__(self, other):
+        return _FusedNode._binary(dpt.divide, other, self)
+
+    def __pow__(self, other):
+        if isinstance(other, numbers.Number) and other == 2:
+            return _FusedNode._unary(dpt.square, self)
+        return _FusedNode._binary(dpt.pow, self, other)
+
+    def __rpow__(self, other):
+        return _FusedNode._binary(dpt.pow, other, self)
+
+    def __neg__(self):
+        return _FusedNode._unary(dpt.negative, self)
+
+    def __pos__(self):
+        return self
+
+    def __abs__(self):
+        return _FusedNode._unary(dpt.abs, self)
+
+    def __bool__(self):
+        raise TypeError(
+            "Fused expressions can not be used in conditional statements"
+        )
+
+
+def _collect_arrays(root, args):
+    """Returns arrays read by the expression: arguments followed by
+    captured arrays"""
+    arrays = list(args)
+    captured = dict()
+    stack = [root]
+    while stack:
+        node = stack.pop()
+        if node.kind == "array":
+            key = id(node.value)
+            if key not in captured:
+                captured[key] = len(arrays)
+                arrays.append(node.value)
+        elif node.kind == "op":
+            stack.extend(node.args)
+    return arrays, captured
+
+
+def _compile_program(root, captured):
+    """
+    Encode expression as a program for a stack machine, or return `None`
+    if expression uses operations fused kernel does not implement.
+    """
+    program = []
+    scalars = []
+    scalar_ids = dict()
+
+    def _emit(node, depth):
+        if node.kind == "input":
+            program.append((_LOAD_INPUT, node.value))
+            return depth + 1
+        if node.kind == "array":
+            program.append((_LOAD_INPUT, captured[id(node.value)]))
+            return depth + 1
+        if node.kind == "scalar":
+            v = node.value
+            if isinstance(v, (bool, complex)) or not isinstance(
+                v, numbers.Real
+            ):
+                raise NotImplementedError
+            v = float(v)
+            # key by bit pattern, since -0.0 == 0.0 but they differ in sign
+            key = struct.pack("d", v)
+            if key not in scalar_ids:
+                scalar_ids[key] = len(scalars)
+                scalars.append(v)
+            program.append((_LOAD_SCALAR, scalar_ids[key]))
+            return depth + 1
+        opcode = _fused_opcodes.get(node.fn.name_, None)
+        if opcode is None:
+            raise NotImplementedError
+        max_depth = depth
+        for i, arg in enumerate(node.args):
+            max_depth = max(max_depth, _emit(arg, depth + i))
+        program.append((opcode, 0))
+        return max_depth
+
+    try:
+        max_depth = _emit(root, 0)
+    except NotImplementedError:
+        return None
+    if (
+        max_depth > tei._fused_max_stack_depth
+        or len(program) > tei._fused_max_instructions
+        or len(scalars) > tei._fused_max_scalars
+    ):
+        return None
+    return program, scalars
+
+
+def _evaluate_eagerly(node, args, out=None):
+    """Evaluate expression by calling elementwise functions one by one"""
+    memo = dict()
+
+    def _eval(n):
+        key = id(n)
+        if key in memo:
+            return memo[key]
+        if n.kind == "input":
+            res = args[n.value]
+        elif n.kind in ("array", "scalar"):
+            res = n.value
+        else:
+            res = n.fn(*(_eval(a) for a in n.args))
+        memo[key] = res
+        return res
+
+    if node.kind == "op":
+        res_args = tuple(_eval(a) for a in node.args)
+        return node.fn(*res_args, out=out)
+    res = _eval(node)
+    if not isinstance(res, dpt.usm_ndarray):
+        raise TypeError("Fused expression must depend on an array")
+    if out is None:
+        return dpt.copy(res)
+    out[...] = res
+    return out
+
+
+def _fused_call(fn, args, out):
+    if not all(isinstance(a, dpt.usm_ndarray) for a in args):
+        raise TypeError(
+            "Arguments of fused function are expected to be "
+            "`dpctl.tensor.usm_ndarray` instances"
+        )
+    inputs = tuple(_FusedNode("input", value=i) for i in range(len(args)))
+    root = _FusedNode._as_node(fn(*inputs))
+    if root.kind != "op":
+        return _evaluate_eagerly(root, args, out=out)
+
+    arrays, captured = _collect_arrays(root, args)
+    if not arrays:
+        raise TypeError("Fused expression must depend on an array")
+    exec_q = dpctl.utils.get_execution_queue([a.sycl_queue for a in arrays])
+    if exec_q is None:
+        raise ExecutionPlacementError(
+            "Execution placement can not be unambiguously inferred "
+            "from input arguments."
+        )
+    res_dt = arrays[0].dtype
+    compiled = None
+    if (
+        len(arrays) <= tei._fused_max_inputs
+        and all(a.dtype == res_dt for a in arrays)
+        and tei._fused_elementwise_supports_dtype(res_dt)
+    ):
+        compiled = _compile_program(root, captured)
+    if compiled is None:
+        return _evaluate_eagerly(root, args, out=out)
+    program, scalars = compiled
+
+    try:
+        res_shape = _broadcast_shape_impl([a.shape for a in arrays])
+    except ValueError:
+        raise ValueError(
+            "operands could not be broadcast together with shapes "
+            + " ".join(str(a.shape) for a in arrays)
+        )
+    res_usm_type = dpctl.utils.get_coerced_usm_type(
+        [a.usm_type for a in arrays]
+    )
+
+    orig_out = out
+    if out is not None:
+        if not isinstance(out, dpt.usm_ndarray):
+            raise TypeError(
+                f"output array must be of usm_ndarray type, got {type(out)}"
+            )
+        if not out.flags.writable:
+            raise ValueError("provided `out` array is read-only")
+        if out.shape != res_shape:
+            raise ValueError(
+                "The shape of input and output arrays are inconsistent. "
+                f"Expected output shape is {res_shape}, got {out.shape}"
+            )
+        if out.dtype != res_dt:
+            raise ValueError(
+                f"Output array of type {res_dt} is needed, got {out.dtype}"
+            )
+        if dpctl.utils.get_execution_queue((exec_q, out.sycl_queue)) is None:
+            raise ExecutionPlacementError(
+                "Input and output allocation queues are not compatible"
+            )
+        for a in arrays:
+            if ti._array_overlap(a, out) and not (
+                a.shape == res_shape and ti._same_logical_tensors(a, out)
+            ):
+                out = dpt.empty_like(out)
+                break
+    else:
+        a0 = arrays[0]
+        if a0.shape == res_shape and a0.usm_type == res_usm_type:
+            out = _empty_like_orderK(a0, res_dt)
+        else:
+            out = dpt.empty(
+                res_shape,
+                dtype=res_dt,
+                usm_type=res_usm_type,
+                sycl_queue=exec_q,
+            )
+
+    srcs = [
+        a if a.shape == res_shape else dpt.broadcast_to(a, res_shape)
+        for a in arrays
+    ]
+    _manager = SequentialOrderManager[exec_q]
+    dep_evs = _manager.submitted_events
+    ht_ev, comp_ev = tei._fused_elementwise(
+        srcs=srcs,
+        dst=out,
+        program=program,
+        scalars=scalars,
+        sycl_queue=exec_q,
+        depends=dep_evs,
+    )
+    _manager.add_event_pair(ht_ev, comp_ev)
+
+    if not (orig_out is None or orig_out is out):
+        ht_copy_ev, cpy_ev = ti._copy_usm_ndarray_into_usm_ndarray(
+            src=out, dst=orig_out, sycl_queue=exec_q, depends=[comp_ev]
+        )
+        _manager.add_event_pair(ht_copy_ev, cpy_ev)
+        out = orig_out
+
+    return out
+
+
+def fuse(fn):
+    """fuse(fn)
+
+    Returns a function evaluating elementwise expression defined by `fn`
+    in a single pass over memory.
+
+    Function `fn` is traced with placeholder arguments every time the
+    returned function is called. It may combine its arguments, arrays it
+    captures, and Python scalars using arithmetic operators and
+    element-wise functions of :mod:`dpctl.tensor`.
+
+    If all arrays have the same real floating-point data type, and the
+    expression only uses ``add``, ``subtract``, ``multiply``, ``divide``,
+    ``maximum``, ``minimum``, ``negative``, ``abs``, ``exp``, ``expm1``,
+    ``log``, ``log1p``, ``sqrt``, ``square``, ``sin``, ``cos``, or
+    ``tanh``, the expression is evaluated by a single kernel which reads
+    every input and writes the output once, without allocating
+    temporaries. Otherwise, the expression is evaluated by calling
+    element-wise functions one by one.
+
+    Args:
+        fn (callable):
+            Function of arrays composed of element-wise operations.
+
+    Returns:
+        callable:
+            Function with the same positional arguments as `fn`, and an
+            optional keyword argument `out`.
+
+    :Example:
+        .. code-block:: python
+
+            import dpctl.tensor as dpt
+
+            fma = dpt.fuse(lambda a, b, c: a * b + c)
+            x = dpt.ones(10**6, dtype="f4")
+            r = fma(x, x, x)
+    """
+    if not callable(fn):
+        raise TypeError(f"Expected a callable, got {type(fn)}")
+
+    @functools.wraps(fn)
+    def _fused(*args, out=None):
+        return _fused_call(fn, args, out)
+
+    return _fused
@@ -22,9 +22,13 @@ import dpctl.tensor._tensor_impl as ti
 import dpctl.utils
 
 from ._copy_utils import (
+    _extract_deferred_impl,
     _extract_impl,
+    _get_put_reduce_op,
+    _nonzero_deferred_impl,
     _nonzero_impl,
     _put_multi_index,
+    _put_reduce_impl,
     _take_multi_index,
 )
 from ._numpy_helper import normalize_axis_index
@@ -173,8 +177,8 @@ def take(x, indices, /, *, axis=None, out=None, mode="wrap"):
     return out
 
 
-def put(x, indices, vals, /, *, axis=None, mode="wrap"):
-    """put(x, indices, vals, axis=None, mode="wrap")
+def put(x, indices, vals, /, *, axis=None, mode="wrap", reduce=None):
+    """put(x, indices, vals, axis=None, mode="wrap", reduce=None)
 
     Puts values into an array along a given axis at given indices.
 
@@ -200,14 +204,22 @@ def put(x, indices, vals, /, *, axis=None, mode="wrap"):
             - ``"clip"``: clips indices to (``0 <= i < n``).
 
             Default: ``"wrap"``.
+        reduce (str, optional):
+            If ``None``, values overwrite elements of ``x``. Otherwise,
+            elements of ``x`` are combined with all values put at their
+            positions, including values at duplicate indices, using the
+            operation ``"add"``, ``"mul"``, ``"max"`` or ``"min"``. Device
+            atomic operations are used for 32- and 64-bit data types when
+            supported. Order in which values are combined is unspecified.
+            Default: ``None``.
 
     .. note::
 
-        If input array ``indices`` contains duplicates, a race condition
-        occurs, and the value written into corresponding positions in ``x``
-        may vary from run to run. Preserving sequential semantics in handing
-        the duplicates to achieve deterministic behavior requires additional
-        work, e.g.
+        If input array ``indices`` contains duplicates and ``reduce`` is
+        ``None``, a race condition occurs, and the value written into
+        corresponding positions in ``x`` may vary from run to run.
+        Preserving sequential semantics in handing the duplicates to
+        achieve deterministic behavior requires additional work, e.g.
 
         :Example:
 
@@ -277,6 +289,7 @@ def put(x, indices, vals, /, *, axis=None, mode="wrap"):
     vals_usm_type = dpctl.utils.get_coerced_usm_type(usm_types_)
 
     mode = _get_indexing_mode(mode)
+    reduce_op = _get_put_reduce_op(reduce)
 
     x_ndim = x.ndim
     if axis is None:
@@ -314,6 +327,10 @@ def put(x, indices, vals, /, *, axis=None, mode="wrap"):
         rhs = dpt.astype(vals, x.dtype)
     rhs = dpt.broadcast_to(rhs, val_shape)
 
+    if reduce_op:
+        _put_reduce_impl(x, (indices,), axis, rhs, mode, reduce_op, exec_q)
+        return
+
     _manager = dpctl.utils.SequentialOrderManager[exec_q]
     deps_ev = _manager.submitted_events
     hev, put_ev = ti._put(
@@ -462,6 +479,172 @@ def nonzero(arr):
     return _nonzero_impl(arr)
 
 
+class PaddedArray:
+    """PaddedArray(padded, count, axis)
+
+    Result of a boolean selection whose size is only known on the device.
+
+    Leading ``count`` entries of array ``padded`` along dimension ``axis``
+    hold the result, remaining entries are unspecified. Array ``padded``
+    is allocated for the case of all elements being selected, so that
+    the selection is computed without waiting for the device.
+
+    Instances are returned by :func:`dpctl.tensor.extract_deferred` and
+    :func:`dpctl.tensor.nonzero_deferred`, and may be passed back to them
+    in place of the condition array.
+    """
+
+    def __init__(self, padded, count, axis):
+        self._padded = padded
+        self._count = count
+        self._axis = axis
+        self._view = None
+
+    @property
+    def padded(self):
+        """Array holding the result followed by unspecified entries"""
+        return self._padded
+
+    @property
+    def count(self):
+        """Zero-dimensional array with the number of valid entries along
+        :attr:`axis`, computed asynchronously"""
+        return self._count
+
+    @property
+    def axis(self):
+        """Dimension of :attr:`padded` along which entries are padded"""
+        return self._axis
+
+    @property
+    def valid_mask(self):
+        """Boolean array which is ``True`` for valid entries along
+        :attr:`axis`, computed without waiting for the device"""
+        ext = self._padded.shape[self._axis]
+        ind = dpt.arange(
+            ext,
+            dtype=self._count.dtype,
+            usm_type=self._padded.usm_type,
+            sycl_queue=self._padded.sycl_queue,
+        )
+        return dpt.less(ind, self._count)
+
+    def view(self):
+        """view()
+
+        Returns the valid part of :attr:`padded`. The first call waits
+        for :attr:`count` to be computed, later calls reuse the result.
+        """
+        if self._view is None:
+            n = int(self._count)
+            sl = (slice(None),) * self._axis + (slice(0, n),)
+            self._view = self._padded[sl]
+        return self._view
+
+    def __len__(self):
+        return len(self.view())
+
+    def __repr__(self):
+        return (
+            f"PaddedArray(padded={self._padded!r}, count={self._count!r}, "
+            f"axis={self._axis})"
+        )
+
+
+def _unpad_condition(condition):
+    """Returns condition array of a PaddedArray with padding entries
+    masked out"""
+    if condition.padded.ndim != 1:
+        raise ValueError(
+            "Only one-dimensional PaddedArray can be used as condition"
+        )
+    return dpt.logical_and(condition.padded, condition.valid_mask)
+
+
+def extract_deferred(condition, arr):
+    """extract_deferred(condition, arr)
+
+    Returns the elements of an array that satisfy the condition, without
+    waiting for the device to determine how many there are.
+
+    Unlike :func:`dpctl.tensor.extract`, the number of selected elements
+    is not copied to the host. The result is stored in an array of size
+    ``arr.size`` whose leading elements hold the selected values, and the
+    number of selected elements stays on the device.
+
+    Args:
+        condition (Union[usm_ndarray, PaddedArray]):
+            An array whose non-zero or ``True`` entries indicate the
+            element of ``arr`` to extract. A one-dimensional
+            ``PaddedArray`` is treated as its padded array with the
+            padding entries excluded.
+        arr (Union[usm_ndarray, PaddedArray]):
+            Input array of the same size as ``condition``. For a
+            ``PaddedArray``, elements are selected from its padded array.
+
+    Returns:
+        PaddedArray:
+            Rank 1 result of selection, padded to size ``arr.size``.
+    """
+    if isinstance(condition, PaddedArray):
+        condition = _unpad_condition(condition)
+    if isinstance(arr, PaddedArray):
+        arr = arr.padded
+    if not isinstance(condition, dpt.usm_ndarray):
+        raise TypeError(
+            "Expecting dpctl.tensor.usm_ndarray type, " f"got {type(condition)}"
+        )
+    if not isinstance(arr, dpt.usm_ndarray):
+        raise TypeError(
+            "Expecting dpctl.tensor.usm_ndarray type, " f"got {type(arr)}"
+        )
+    exec_q = dpctl.utils.get_execution_queue(
+        (
+            condition.sycl_queue,
+            arr.sycl_queue,
+        )
+    )
+    if exec_q is None:
+        raise dpctl.utils.ExecutionPlacementError
+    if condition.shape != arr.shape:
+        raise ValueError("Arrays are not of the same size")
+    padded, count = _extract_deferred_impl(arr, condition)
+    return PaddedArray(padded, count, 0)
+
+
+def nonzero_deferred(arr):
+    """nonzero_deferred(arr)
+
+    Return the indices of non-zero elements, without waiting for the
+    device to determine how many there are.
+
+    Unlike :func:`dpctl.tensor.nonzero`, the number of non-zero elements
+    is not copied to the host. Indices are stored in a matrix of shape
+    ``(arr.ndim, arr.size)``, whose leading columns hold indices of
+    non-zero elements in row-major, C-style order.
+
+    Args:
+        arr (Union[usm_ndarray, PaddedArray]):
+            Input array, which has non-zero array rank. A one-dimensional
+            ``PaddedArray`` is treated as its padded array with the
+            padding entries excluded.
+
+    Returns:
+        PaddedArray:
+            Index matrix padded along axis 1 to size ``arr.size``.
+    """
+    if isinstance(arr, PaddedArray):
+        arr = _unpad_condition(arr)
+    if not isinstance(arr, dpt.usm_ndarray):
+        raise TypeError(
+            "Expecting dpctl.tensor.usm_ndarray type, " f"got {type(arr)}"
+        )
+    if arr.ndim == 0:
+        raise ValueError("Array of positive rank is expected")
+    padded, count = _nonzero_deferred_impl(arr)
+    return PaddedArray(padded, count, 1)
+
+
 def _range(sh_i, i, nd, q, usm_t, dt):
     ind = dpt.arange(sh_i, dtype=dt, usm_type=usm_t, sycl_queue=q)
     ind.shape = tuple(sh_i if i == j else 1 for j in range(nd))
@@ -545,7 +728,7 @@ def take_along_axis(x, indices, /, *, axis=-1, mode="wrap"):
     return _take_multi_index(x, _ind, 0, mode=mode_i)
 
 
-def put_along_axis(x, indices, vals, /, *, axis=-1, mode="wrap"):
+def put_along_axis(x, indices, vals, /, *, axis=-1, mode="wrap", reduce=None):
     """
     Puts elements into an array at the one-dimensional indices specified by
     ``indices`` along a provided ``axis``.
@@ -573,14 +756,19 @@ def put_along_axis(x, indices, vals, /, *, axis=-1, mode="wrap"):
             - ``"clip"``: clips indices to (``0 <= i < n``).
 
             Default: ``"wrap"``.
+        reduce (str, optional):
+            If ``None``, values overwrite elements of ``x``. Otherwise,
+            elements of ``x`` are combined with all values put at their
+            positions using the operation ``"add"``, ``"mul"``, ``"max"``
+            or ``"min"``, as in :func:`dpctl.tensor.put`. Default: ``None``.
 
     .. note::
 
-        If input array ``indices`` contains duplicates, a race condition
-        occurs, and the value written into corresponding positions in ``x``
-        may vary from run to run. Preserving sequential semantics in handing
-        the duplicates to achieve deterministic behavior requires additional
-        work.
+        If input array ``indices`` contains duplicates and ``reduce`` is
+        ``None``, a race condition occurs, and the value written into
+        corresponding positions in ``x`` may vary from run to run.
+        Preserving sequential semantics in handing the duplicates to
+        achieve deterministic behavior requires additional work.
     """
     if not isinstance(x, dpt.usm_ndarray):
         raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
@@ -609,6 +797,7 @@ def put_along_axis(x, indices, vals, /, *, axis=-1, mode="wrap"):
         )
     out_usm_type = dpctl.utils.get_coerced_usm_type(usm_types_)
     mode_i = _get_indexing_mode(mode)
+    reduce_op = _get_put_reduce_op(reduce)
     indexes_dt = (
         dpt.uint64
         if indices.dtype == dpt.uint64
@@ -622,4 +811,4 @@ def put_along_axis(x, indices, vals, /, *, axis=-1, mode="wrap"):
         )
         for i in range(x_nd)
     )
-    return _put_multi_index(x, _ind, 0, vals, mode=mode_i)
+    return _put_multi_index(x, _ind, 0, vals, mode=mode_i, reduce_op=reduce_op)
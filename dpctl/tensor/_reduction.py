@@ -816,3 +816,295 @@ def count_nonzero(x, /, *, axis=None, keepdims=False, out=None):
         keepdims=keepdims,
         out=out,
     )
+
+
+def _two_output_reduction_over_axis(
+    x, axis, keepdims, res_dt1, res_dt2, _reduction_fn, allow_empty=True
+):
+    """Computes two reductions of ``x`` by streaming it once, returns
+    tuple of results of types ``res_dt1`` and ``res_dt2``"""
+    nd = x.ndim
+    if axis is None:
+        axis = tuple(range(nd))
+        perm = list(axis)
+        arr = x
+    else:
+        if not isinstance(axis, (tuple, list)):
+            axis = (axis,)
+        axis = normalize_axis_tuple(axis, nd, "axis")
+        perm = [i for i in range(nd) if i not in axis] + list(axis)
+        arr = dpt.permute_dims(x, perm)
+    red_nd = len(axis)
+    if not allow_empty and any(
+        [arr.shape[i] == 0 for i in range(-red_nd, 0)]
+    ):
+        raise ValueError("reduction cannot be performed over zero-size axes")
+    res_shape = arr.shape[: nd - red_nd]
+    q = x.sycl_queue
+    res_usm_type = x.usm_type
+    if red_nd == 0:
+        # reduce over a trailing dimension of unit size
+        arr = dpt.expand_dims(arr, axis=-1)
+
+    res1 = dpt.empty(
+        res_shape, dtype=res_dt1, usm_type=res_usm_type, sycl_queue=q
+    )
+    res2 = dpt.empty(
+        res_shape, dtype=res_dt2, usm_type=res_usm_type, sycl_queue=q
+    )
+    _manager = SequentialOrderManager[q]
+    dep_evs = _manager.submitted_events
+    ht_e, red_e = _reduction_fn(
+        arr,
+        red_nd if red_nd > 0 else 1,
+        res1,
+        res2,
+        sycl_queue=q,
+        depends=dep_evs,
+    )
+    _manager.add_event_pair(ht_e, red_e)
+
+    if keepdims:
+        res_shape = res_shape + (1,) * red_nd
+        inv_perm = sorted(range(nd), key=lambda d: perm[d])
+        res1 = dpt.permute_dims(dpt.reshape(res1, res_shape), inv_perm)
+        res2 = dpt.permute_dims(dpt.reshape(res2, res_shape), inv_perm)
+    return res1, res2
+
+
+def minmax(x, /, *, axis=None, keepdims=False):
+    """
+    Calculates the minimum and the maximum values of the input array ``x``
+    in a single pass over its elements.
+
+    Args:
+        x (usm_ndarray):
+            input array.
+        axis (Optional[int, Tuple[int, ...]]):
+            axis or axes along which minima and maxima must be computed. If
+            a tuple of unique integers, they are computed over multiple axes.
+            If ``None``, they are computed over the entire array.
+            Default: ``None``.
+        keepdims (Optional[bool]):
+            if ``True``, the reduced axes (dimensions) are included in the
+            results as singleton dimensions. Default: ``False``.
+
+    Returns:
+        Tuple[usm_ndarray, usm_ndarray]:
+            arrays containing the minima and the maxima, equal to results of
+            :func:`dpctl.tensor.min` and :func:`dpctl.tensor.max`. The
+            returned arrays have the same data type as ``x``.
+    """
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    return _two_output_reduction_over_axis(
+        x,
+        axis,
+        keepdims,
+        x.dtype,
+        x.dtype,
+        tri._minmax_over_axis,
+        allow_empty=False,
+    )
+
+
+def sum_and_sumsq(x, /, *, axis=None, dtype=None, keepdims=False):
+    """
+    Calculates the sum of elements of the input array ``x`` and the sum of
+    their squares in a single pass over the elements.
+
+    Args:
+        x (usm_ndarray):
+            input array.
+        axis (Optional[int, Tuple[int, ...]]):
+            axis or axes along which sums must be computed. If a tuple
+            of unique integers, sums are computed over multiple axes.
+            If ``None``, sums are computed over the entire array.
+            Default: ``None``.
+        dtype (Optional[dtype]):
+            data type of the returned arrays, in which the sums are also
+            accumulated. If ``None``, it is chosen as for
+            :func:`dpctl.tensor.sum`. Default: ``None``.
+        keepdims (Optional[bool]):
+            if ``True``, the reduced axes (dimensions) are included in the
+            results as singleton dimensions. Default: ``False``.
+
+    Returns:
+        Tuple[usm_ndarray, usm_ndarray]:
+            arrays containing the sums of elements and the sums of their
+            squares, both computed in the returned data type.
+    """
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    q = x.sycl_queue
+    inp_dt = x.dtype
+    if dtype is None:
+        res_dt = _default_accumulation_dtype(inp_dt, q)
+    else:
+        res_dt = dpt.dtype(dtype)
+        res_dt = _to_device_supported_dtype(res_dt, q.sycl_device)
+    if not tri._sum_and_sumsq_over_axis_dtype_supported(inp_dt, res_dt):
+        if not tri._sum_and_sumsq_over_axis_dtype_supported(res_dt, res_dt):
+            raise TypeError(
+                f"Accumulation in data type {res_dt} is not supported"
+            )
+        x = dpt.astype(x, res_dt)
+    return _two_output_reduction_over_axis(
+        x, axis, keepdims, res_dt, res_dt, tri._sum_and_sumsq_over_axis
+    )
+
+
+def max_with_argmax(x, /, *, axis=None, keepdims=False):
+    """
+    Calculates the maximum values of the input array ``x`` along a specified
+    axis, together with indices of their first occurrences, in a single pass
+    over the elements.
+
+    Args:
+        x (usm_ndarray):
+            input array.
+        axis (Optional[int]):
+            axis along which to search. If ``None``, the maximum value of the
+            flattened array and its index are returned.
+            Default: ``None``.
+        keepdims (Optional[bool]):
+            if ``True``, the reduced axes (dimensions) are included in the
+            results as singleton dimensions. Default: ``False``.
+
+    Returns:
+        Tuple[usm_ndarray, usm_ndarray]:
+            arrays containing the maxima, equal to results of
+            :func:`dpctl.tensor.max`, and indices of their first occurrences,
+            equal to results of :func:`dpctl.tensor.argmax`. The array of
+            indices has the default array index data type for the device of
+            ``x``.
+    """
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    if not (axis is None or isinstance(axis, int)):
+        raise TypeError(
+            f"'axis' argument expected to have type 'int' "
+            r"or be `None`, "
+            f"got type {type(axis)}"
+        )
+    index_dt = ti.default_device_index_type(x.sycl_device)
+    return _two_output_reduction_over_axis(
+        x,
+        axis,
+        keepdims,
+        x.dtype,
+        index_dt,
+        tri._max_with_argmax_over_axis,
+        allow_empty=False,
+    )
+
+
+_segment_reduce_ops = {
+    "sum": 0,
+    "prod": 1,
+    "min": 2,
+    "max": 3,
+    "argmin": 4,
+    "argmax": 5,
+    "logsumexp": 6,
+}
+
+
+def segment_reduce(x, offsets, op, /):
+    """
+    Reduces segments of the vector ``x`` delimited by offsets in the
+    compressed sparse row (CSR) format.
+
+    Segment ``i`` consists of elements ``x[offsets[i]:offsets[i + 1]]``,
+    so that ``offsets.size - 1`` segments are reduced.
+
+    Args:
+        x (usm_ndarray):
+            input vector.
+        offsets (usm_ndarray):
+            non-decreasing vector of integer offsets of segments, with
+            elements in the range ``[0, x.size]``. Segments are clamped to
+            that range.
+        op (str):
+            reduction to compute over each segment, one of ``"sum"``,
+            ``"prod"``, ``"min"``, ``"max"``, ``"argmin"``, ``"argmax"``
+            and ``"logsumexp"``.
+
+    Returns:
+        usm_ndarray:
+            a vector with one element per segment.
+
+            * For ``"sum"`` and ``"prod"``, the result has the data type
+              of :func:`dpctl.tensor.sum` and :func:`dpctl.tensor.prod`.
+            * For ``"logsumexp"``, the result has the data type of
+              :func:`dpctl.tensor.logsumexp`.
+            * For ``"min"`` and ``"max"``, the result has the data type of
+              ``x``.
+            * For ``"argmin"`` and ``"argmax"``, the result has the default
+              array index data type for the device of ``x`` and contains
+              indices into ``x`` of the first occurrences of extrema.
+
+            Empty segments are assigned the identity of the reduction, or
+            ``-1`` for ``"argmin"`` and ``"argmax"``.
+    """
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    if not isinstance(offsets, dpt.usm_ndarray):
+        raise TypeError(
+            f"Expected dpctl.tensor.usm_ndarray, got {type(offsets)}"
+        )
+    if op not in _segment_reduce_ops:
+        raise ValueError(
+            f"Unrecognized reduction {op}, expected one of "
+            f"{list(_segment_reduce_ops)}"
+        )
+    if x.ndim != 1:
+        raise ValueError("Input array must be a vector")
+    if offsets.ndim != 1 or offsets.size == 0:
+        raise ValueError("Offsets must be a non-empty vector")
+    if offsets.dtype.kind not in "iu":
+        raise TypeError(
+            f"Offsets must have integral data type, got {offsets.dtype}"
+        )
+    q = dpctl.utils.get_execution_queue((x.sycl_queue, offsets.sycl_queue))
+    if q is None:
+        raise ExecutionPlacementError(
+            "Execution placement can not be unambiguously inferred "
+            "from input arguments."
+        )
+    res_usm_type = dpctl.utils.get_coerced_usm_type(
+        (x.usm_type, offsets.usm_type)
+    )
+
+    if op in ("sum", "prod"):
+        x_dt = _default_accumulation_dtype(x.dtype, q)
+    elif op == "logsumexp":
+        x_dt = _default_accumulation_dtype_fp_types(x.dtype, q)
+    else:
+        x_dt = x.dtype
+    if op in ("argmin", "argmax"):
+        res_dt = ti.default_device_index_type(q.sycl_device)
+    else:
+        res_dt = x_dt
+
+    if x.dtype != x_dt:
+        x = dpt.astype(x, x_dt)
+    if offsets.dtype != dpt.int64 or not offsets.flags.c_contiguous:
+        offsets = dpt.astype(offsets, dpt.int64, order="C")
+
+    nseg = offsets.size - 1
+    res = dpt.empty(nseg, dtype=res_dt, usm_type=res_usm_type, sycl_queue=q)
+    if nseg == 0:
+        return res
+    _manager = SequentialOrderManager[q]
+    dep_evs = _manager.submitted_events
+    ht_e, red_e = tri._segment_reduce(
+        src=x,
+        offsets=offsets,
+        dst=res,
+        reduction_op=_segment_reduce_ops[op],
+        sycl_queue=q,
+        depends=dep_evs,
+    )
+    _manager.add_event_pair(ht_e, red_e)
+    return res
@@ -33,6 +33,8 @@ from ._tensor_sorting_impl import (
     _argsort_ascending,
     _searchsorted_left,
     _sort_ascending,
+    _unique,
+    _unique_dtype_supported,
 )
 
 __all__ = [
@@ -63,6 +65,64 @@ class UniqueInverseResult(NamedTuple):
     inverse_indices: dpt.usm_ndarray
 
 
+def _unique_impl(fx, exec_q, with_counts=False, with_inverse=False):
+    """
+    Computes unique elements of non-empty vector `fx`, and optionally their
+    counts and inverse indices, by a single native routine which submits
+    all work without waiting for it. The number of unique elements is
+    written into a device scalar, which is read once all work has been
+    enqueued.
+
+    Returns a tuple `(values, counts, inverse)`, with `None` in place of
+    arrays not requested, or `None` if the native routine does not support
+    data type of `fx`.
+    """
+    ind_dt = default_device_index_type(exec_q)
+    if ind_dt != dpt.int64 or not _unique_dtype_supported(fx.dtype.num):
+        return None
+    x_usm_type = fx.usm_type
+    _manager = du.SequentialOrderManager[exec_q]
+    dep_evs = _manager.submitted_events
+    if fx.flags.c_contiguous:
+        src = fx
+    else:
+        src = dpt.empty_like(fx, order="C")
+        ht_ev, copy_ev = _copy_usm_ndarray_into_usm_ndarray(
+            src=fx, dst=src, sycl_queue=exec_q, depends=dep_evs
+        )
+        _manager.add_event_pair(ht_ev, copy_ev)
+        dep_evs = [copy_ev]
+    n = src.size
+    vals = dpt.empty_like(src)
+    counts = None
+    if with_counts:
+        counts = dpt.empty(
+            n, dtype=ind_dt, usm_type=x_usm_type, sycl_queue=exec_q
+        )
+    inv = None
+    if with_inverse:
+        inv = dpt.empty(n, dtype=ind_dt, usm_type=x_usm_type, sycl_queue=exec_q)
+    n_uniques = dpt.empty(1, dtype=dpt.int64, sycl_queue=exec_q)
+    ht_ev, un_ev = _unique(
+        src=src,
+        values=vals,
+        counts=counts,
+        inverse=inv,
+        n_uniques=n_uniques,
+        sycl_queue=exec_q,
+        depends=dep_evs,
+    )
+    _manager.add_event_pair(ht_ev, un_ev)
+    # size of result is needed to construct output arrays, read it
+    # after all work has been submitted
+    nu = int(n_uniques[0])
+    if nu < n:
+        vals = dpt.copy(vals[:nu])
+        if counts is not None:
+            counts = dpt.copy(counts[:nu])
+    return vals, counts, inv
+
+
 def unique_values(x: dpt.usm_ndarray) -> dpt.usm_ndarray:
     """unique_values(x)
 
@@ -86,6 +146,9 @@ def unique_values(x: dpt.usm_ndarray) -> dpt.usm_ndarray:
         fx = dpt.reshape(x, (x.size,), order="C")
     if fx.size == 0:
         return fx
+    res = _unique_impl(fx, exec_q)
+    if res is not None:
+        return res[0]
     s = dpt.empty_like(fx, order="C")
     _manager = du.SequentialOrderManager[exec_q]
     dep_evs = _manager.submitted_events
@@ -181,6 +244,9 @@ def unique_counts(x: dpt.usm_ndarray) -> UniqueCountsResult:
     ind_dt = default_device_index_type(exec_q)
     if fx.size == 0:
         return UniqueCountsResult(fx, dpt.empty_like(fx, dtype=ind_dt))
+    res = _unique_impl(fx, exec_q, with_counts=True)
+    if res is not None:
+        return UniqueCountsResult(res[0], res[1])
     s = dpt.empty_like(fx, order="C")
 
     _manager = du.SequentialOrderManager[exec_q]
@@ -316,6 +382,9 @@ def unique_inverse(x):
     unsorting_ids = dpt.empty_like(sorting_ids, dtype=ind_dt, order="C")
     if fx.size == 0:
         return UniqueInverseResult(fx, dpt.reshape(unsorting_ids, x.shape))
+    res = _unique_impl(fx, exec_q, with_inverse=True)
+    if res is not None:
+        return UniqueInverseResult(res[0], dpt.reshape(res[2], x.shape))
 
     _manager = du.SequentialOrderManager[exec_q]
     dep_evs = _manager.submitted_events
@@ -14,15 +14,68 @@
 #  See the License for the specific language governing permissions and
 #  limitations under the License.
 
+import math
+import operator
+
 import dpctl.tensor as dpt
 import dpctl.tensor._tensor_elementwise_impl as tei
 import dpctl.tensor._tensor_impl as ti
 import dpctl.tensor._tensor_reductions_impl as tri
 import dpctl.utils as du
+from dpctl.utils import ExecutionPlacementError
 
 from ._numpy_helper import normalize_axis_tuple
 
 
+def _welford_var_impl(x, axis, correction, keepdims, take_sqrt):
+    """
+    Computes variance, or standard deviation if `take_sqrt` is `True`, in a
+    single pass over `x`. Returns `None` if the reduction is not supported
+    natively.
+    """
+    nd = x.ndim
+    if axis is None:
+        axis = tuple(range(nd))
+    if not isinstance(axis, (tuple, list)):
+        axis = (axis,)
+    axis = normalize_axis_tuple(axis, nd, "axis")
+    red_nd = len(axis)
+    if red_nd == 0:
+        return None
+    q = x.sycl_queue
+    inp_dt = x.dtype
+    res_dt = (
+        inp_dt
+        if inp_dt.kind == "f"
+        else dpt.dtype(ti.default_device_fp_type(q))
+    )
+    if not tri._var_over_axis_dtype_supported(inp_dt, res_dt):
+        return None
+    perm = [i for i in range(nd) if i not in axis] + list(axis)
+    arr2 = dpt.permute_dims(x, perm)
+    res_shape = arr2.shape[: nd - red_nd]
+    res = dpt.empty(res_shape, dtype=res_dt, usm_type=x.usm_type, sycl_queue=q)
+
+    _manager = du.SequentialOrderManager[q]
+    dep_evs = _manager.submitted_events
+    impl_fn = tri._std_over_axis if take_sqrt else tri._var_over_axis
+    ht_e, r_e = impl_fn(
+        src=arr2,
+        trailing_dims_to_reduce=red_nd,
+        dst=res,
+        correction=float(correction),
+        sycl_queue=q,
+        depends=dep_evs,
+    )
+    _manager.add_event_pair(ht_e, r_e)
+
+    if keepdims:
+        res_shape = res_shape + (1,) * red_nd
+        inv_perm = sorted(range(nd), key=lambda d: perm[d])
+        res = dpt.permute_dims(dpt.reshape(res, res_shape), inv_perm)
+    return res
+
+
 def _var_impl(x, axis, correction, keepdims):
     nd = x.ndim
     if axis is None:
@@ -305,7 +358,9 @@ def var(x, axis=None, correction=0.0, keepdims=False):
     if x.dtype.kind == "c":
         raise ValueError("`var` does not support complex types")
 
-    res, _ = _var_impl(x, axis, correction, keepdims)
+    res = _welford_var_impl(x, axis, correction, keepdims, False)
+    if res is None:
+        res, _ = _var_impl(x, axis, correction, keepdims)
     return res
 
 
@@ -357,6 +412,10 @@ def std(x, axis=None, correction=0.0, keepdims=False):
     if x.dtype.kind == "c":
         raise ValueError("`std` does not support complex types")
 
+    res = _welford_var_impl(x, axis, correction, keepdims, True)
+    if res is not None:
+        return res
+
     exec_q = x.sycl_queue
     _manager = du.SequentialOrderManager[exec_q]
     res, deps = _var_impl(x, axis, correction, keepdims)
@@ -365,3 +424,249 @@ def std(x, axis=None, correction=0.0, keepdims=False):
     )
     _manager.add_event_pair(ht_ev, sqrt_ev)
     return res
+
+
+def _histogram_weights(x, weights):
+    """
+    Validates `weights` of elements of `x`. Returns weights as a vector, or
+    `None`, and the data type of bins accumulating them.
+    """
+    q = x.sycl_queue
+    if weights is None:
+        return None, dpt.dtype(ti.default_device_index_type(q))
+    if not isinstance(weights, dpt.usm_ndarray):
+        raise TypeError(
+            f"Expected dpctl.tensor.usm_ndarray, got {type(weights)}"
+        )
+    if weights.shape != x.shape:
+        raise ValueError("`weights` must have the same shape as the input")
+    if du.get_execution_queue((q, weights.sycl_queue)) is None:
+        raise ExecutionPlacementError(
+            "Execution placement can not be unambiguously inferred "
+            "from input arguments."
+        )
+    w_dt = weights.dtype
+    if w_dt.kind in "biu":
+        res_dt = dpt.dtype(ti.default_device_fp_type(q))
+    elif w_dt == dpt.float16:
+        res_dt = dpt.dtype(dpt.float32)
+    else:
+        res_dt = w_dt
+    if weights.ndim != 1:
+        weights = dpt.reshape(weights, (weights.size,))
+    return weights, res_dt
+
+
+def _accumulate_bins(impl_fn, x, weights, res_dt, nbins, usm_type, **kw):
+    """
+    Accumulates elements of vector `x`, or their `weights`, into `nbins`
+    bins of data type `res_dt` using `impl_fn`.
+    """
+    q = x.sycl_queue
+    if res_dt.kind == "c":
+        # bins are updated atomically, accumulate real and imaginary parts
+        # of weights separately
+        real_dt = dpt.float32 if res_dt == dpt.complex64 else dpt.float64
+        re = _accumulate_bins(
+            impl_fn, x, dpt.real(weights), real_dt, nbins, usm_type, **kw
+        )
+        im = _accumulate_bins(
+            impl_fn, x, dpt.imag(weights), real_dt, nbins, usm_type, **kw
+        )
+        res = dpt.astype(re, res_dt)
+        res.imag[...] = im
+        return res
+    if weights is not None and weights.dtype != res_dt:
+        weights = dpt.astype(weights, res_dt)
+    res = dpt.empty(nbins, dtype=res_dt, usm_type=usm_type, sycl_queue=q)
+    _manager = du.SequentialOrderManager[q]
+    dep_evs = _manager.submitted_events
+    ht_ev, ev = impl_fn(
+        src=x,
+        weights=weights,
+        dst=res,
+        sycl_queue=q,
+        depends=dep_evs,
+        **kw,
+    )
+    _manager.add_event_pair(ht_ev, ev)
+    return res
+
+
+def bincount(x, /, weights=None, *, minlength=0):
+    """bincount(x, weights=None, minlength=0)
+
+    Counts the number of occurrences of each value in the input array `x`
+    of non-negative integers, in a single pass over its elements.
+
+    Args:
+        x (usm_ndarray):
+            input one-dimensional array with integral data type.
+        weights (Optional[usm_ndarray]):
+            weights of elements of `x`, an array with the same shape as
+            `x`. If given, bins accumulate weights of elements instead of
+            counting them. Accumulating weights in `float64` requires
+            support of 64-bit atomic operations by the device, `ValueError`
+            is raised otherwise. Default: `None`.
+        minlength (int):
+            minimal number of bins of the result. Default: `0`.
+    Returns:
+        usm_ndarray:
+            a one-dimensional array with `max(minlength, dpt.max(x) + 1)`
+            bins. Bin `i` holds the number of occurrences of `i` in `x`, or
+            the sum of their weights.
+
+            Without weights, the returned array has the default index data
+            type for the device where `x` is allocated. Weights with boolean
+            or integral data types are accumulated in the default floating
+            point data type, `float16` weights in `float32`, and other
+            weights in their own data type.
+    """
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    if x.ndim != 1:
+        raise ValueError("`bincount` expects a one-dimensional input array")
+    if x.dtype.kind not in "iu":
+        raise TypeError(
+            "`bincount` expects an input array with integral data type"
+        )
+    minlength = operator.index(minlength)
+    if minlength < 0:
+        raise ValueError("`minlength` must be non-negative")
+    weights, res_dt = _histogram_weights(x, weights)
+    usm_types = [x.usm_type]
+    if weights is not None:
+        usm_types.append(weights.usm_type)
+    res_usm_type = du.get_coerced_usm_type(usm_types)
+
+    nbins = minlength
+    if x.size > 0:
+        x_min, x_max = dpt.minmax(x)
+        if int(x_min) < 0:
+            raise ValueError("`bincount` expects non-negative input values")
+        nbins = max(nbins, int(x_max) + 1)
+    if nbins == 0:
+        return dpt.empty(
+            0, dtype=res_dt, usm_type=res_usm_type, sycl_queue=x.sycl_queue
+        )
+    return _accumulate_bins(
+        tri._bincount, x, weights, res_dt, nbins, res_usm_type
+    )
+
+
+def histogram(x, /, bins=10, *, range=None, weights=None):
+    """histogram(x, bins=10, range=None, weights=None)
+
+    Computes the histogram of elements of the input array `x`, in a single
+    pass over its elements.
+
+    Args:
+        x (usm_ndarray):
+            input array with real-valued data type. The histogram is
+            computed over the flattened array.
+        bins (Union[int, usm_ndarray]):
+            if an integer, the number of equal-width bins over `range`. If
+            an array, a one-dimensional array of monotonically increasing
+            bin edges, including the rightmost edge. Default: `10`.
+        range (Optional[Tuple[float, float]]):
+            lower and upper range of equal-width bins. If `None`, the range
+            is `(dpt.min(x), dpt.max(x))`. Ignored if `bins` is an array.
+            Default: `None`.
+        weights (Optional[usm_ndarray]):
+            weights of elements of `x`, an array with the same shape as
+            `x`. If given, bins accumulate weights of elements instead of
+            counting them. Accumulating weights in `float64` requires
+            support of 64-bit atomic operations by the device, `ValueError`
+            is raised otherwise. Default: `None`.
+    Returns:
+        Tuple[usm_ndarray, usm_ndarray]:
+            values of the histogram and bin edges. All bins but the last
+            one are half-open, the last bin also includes its right edge.
+            Elements outside of the bins and NaNs are not counted.
+
+            Without weights, the histogram has the default index data type
+            for the device where `x` is allocated, weights are accumulated
+            in data types as in :func:`dpctl.tensor.bincount`. Bin edges
+            have the data type of `x` if it is a real floating point data
+            type, and the default floating point data type otherwise.
+    """
+    if not isinstance(x, dpt.usm_ndarray):
+        raise TypeError(f"Expected dpctl.tensor.usm_ndarray, got {type(x)}")
+    q = x.sycl_queue
+    x_dt = x.dtype
+    if x_dt.kind == "c":
+        raise TypeError("`histogram` does not support complex types")
+    if x_dt.kind in "biu":
+        x_dt = dpt.dtype(ti.default_device_fp_type(q))
+    elif x_dt == dpt.float16:
+        x_dt = dpt.dtype(dpt.float32)
+    weights, res_dt = _histogram_weights(x, weights)
+    if x.ndim != 1:
+        x = dpt.reshape(x, (x.size,))
+    usm_types = [x.usm_type]
+    if weights is not None:
+        usm_types.append(weights.usm_type)
+
+    if isinstance(bins, dpt.usm_ndarray):
+        if bins.ndim != 1 or bins.size < 2:
+            raise ValueError(
+                "`bins` must be a one-dimensional array of at least two edges"
+            )
+        if du.get_execution_queue((q, bins.sycl_queue)) is None:
+            raise ExecutionPlacementError(
+                "Execution placement can not be unambiguously inferred "
+                "from input arguments."
+            )
+        usm_types.append(bins.usm_type)
+        res_usm_type = du.get_coerced_usm_type(usm_types)
+        nbins = bins.size - 1
+        edges = dpt.astype(bins, x_dt, order="C")
+        if nbins > 1 and bool(dpt.any(edges[1:] < edges[:-1])):
+            raise ValueError("`bins` must increase monotonically")
+        uniform_range = None
+    else:
+        try:
+            nbins = operator.index(bins)
+        except TypeError:
+            raise TypeError(
+                "`bins` must be an integer or a usm_ndarray of bin edges"
+            )
+        if nbins < 1:
+            raise ValueError("`bins` must be positive")
+        res_usm_type = du.get_coerced_usm_type(usm_types)
+        if range is not None:
+            first, last = (float(v) for v in range)
+        elif x.size > 0:
+            x_min, x_max = dpt.minmax(x)
+            first, last = float(x_min), float(x_max)
+        else:
+            first, last = 0.0, 1.0
+        if first > last:
+            raise ValueError("Lower end of `range` must not exceed its upper")
+        if not (math.isfinite(first) and math.isfinite(last)):
+            raise ValueError(f"Range [{first}, {last}] is not finite")
+        if first == last:
+            first, last = first - 0.5, last + 0.5
+        edges = dpt.linspace(
+            first,
+            last,
+            num=nbins + 1,
+            dtype=x_dt,
+            usm_type=res_usm_type,
+            sycl_queue=q,
+        )
+        uniform_range = (first, last)
+
+    if x.dtype != x_dt:
+        x = dpt.astype(x, x_dt)
+    hist = _accumulate_bins(
+        tri._histogram,
+        x,
+        weights,
+        res_dt,
+        nbins,
+        res_usm_type,
+        edges=edges,
+        uniform_range=uniform_range,
+    )
+    return hist, edges
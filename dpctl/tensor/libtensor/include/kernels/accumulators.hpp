@@ -23,6 +23,7 @@
 //===---------------------------------------------------------------------===//
 
 #pragma once
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -32,6 +33,7 @@
 #include <vector>
 
 #include "dpctl_tensor_types.hpp"
+#include "utils/kernel_launch_cache.hpp"
 #include "utils/offset_utils.hpp"
 #include "utils/sycl_alloc_utils.hpp"
 #include "utils/sycl_utils.hpp"
@@ -553,6 +555,310 @@ inclusive_scan_base_step(sycl::queue &exec_q,
     }
 }
 
+// Single-pass scan with decoupled look-back
+
+template <typename inputT,
+          typename outputT,
+          nwiT n_wi,
+          typename IterIndexerT,
+          typename InpIndexerT,
+          typename OutIndexerT,
+          typename TransformerT,
+          typename ScanOpT,
+          bool include_initial>
+class inclusive_scan_lookback_krn;
+
+namespace detail
+{
+
+// status of a tile in decoupled look-back scan
+static constexpr std::uint32_t lookback_tile_invalid = 0;
+static constexpr std::uint32_t lookback_tile_aggregate = 1;
+static constexpr std::uint32_t lookback_tile_prefix = 2;
+
+} // end of namespace detail
+
+/*! @brief Whether device supports memory orders and scopes of atomic
+ *         operations needed by decoupled look-back scan */
+inline bool device_supports_lookback_scan(const sycl::device &dev)
+{
+    const auto &orders = dev.get_info<
+        sycl::info::device::atomic_memory_order_capabilities>();
+    const auto &scopes = dev.get_info<
+        sycl::info::device::atomic_memory_scope_capabilities>();
+
+    auto has_order = [&orders](sycl::memory_order o) {
+        return std::find(orders.begin(), orders.end(), o) != orders.end();
+    };
+    const bool has_acq_rel =
+        has_order(sycl::memory_order::acq_rel) ||
+        (has_order(sycl::memory_order::acquire) &&
+         has_order(sycl::memory_order::release));
+    const bool has_device_scope =
+        std::find(scopes.begin(), scopes.end(), sycl::memory_scope::device) !=
+        scopes.end();
+
+    return has_acq_rel && has_device_scope;
+}
+
+/*! @brief Whether inclusive scan of `iter_nelems` rows of `acc_nelems`
+ *         elements should be computed by the single-pass decoupled look-back
+ *         scan, i.e. whether rows span more than one tile of `chunk_size`
+ *         elements and the device supports the algorithm */
+inline bool use_lookback_scan(const sycl::queue &exec_q,
+                              std::size_t iter_nelems,
+                              std::size_t acc_nelems,
+                              std::size_t chunk_size)
+{
+    if (acc_nelems <= chunk_size) {
+        return false;
+    }
+    const std::size_t n_tiles =
+        iter_nelems * ceiling_quotient(acc_nelems, chunk_size);
+    if (n_tiles >= std::numeric_limits<std::uint32_t>::max()) {
+        return false;
+    }
+
+    // multi-pass scan is preferable on CPU, where work-groups waiting for
+    // predecessors occupy threads of a pool
+    const sycl::device &dev = exec_q.get_device();
+    return !dev.has(sycl::aspect::cpu) && device_supports_lookback_scan(dev);
+}
+
+/*
+ * Computes inclusive scan of each of `iter_nelems` rows of `acc_nelems`
+ * elements by a single kernel.
+ *
+ * Rows are split into tiles of `wg_size * n_wi` elements, each processed by
+ * a work-group. Tiles are assigned to work-groups in the order in which
+ * work-groups start, so that every tile only waits for tiles already being
+ * processed. A work-group scans its tile, publishes the tile aggregate, and
+ * then combines aggregates, or inclusive prefixes when available, of
+ * preceding tiles of the same row. Once found, the inclusive prefix of the
+ * tile is published for subsequent tiles. Input is read and output is
+ * written once, instead of the additional passes over partial scans made
+ * by `inclusive_scan_iter`.
+ */
+template <typename inputT,
+          typename outputT,
+          nwiT n_wi,
+          typename IterIndexerT,
+          typename InpIndexerT,
+          typename OutIndexerT,
+          typename TransformerT,
+          typename ScanOpT,
+          bool include_initial>
+sycl::event
+inclusive_scan_lookback(sycl::queue &exec_q,
+                        const std::uint32_t wg_size,
+                        const std::size_t iter_nelems,
+                        const std::size_t acc_nelems,
+                        const inputT *input,
+                        outputT *output,
+                        const std::size_t s0,
+                        const std::size_t s1,
+                        const IterIndexerT &iter_indexer,
+                        const InpIndexerT &inp_indexer,
+                        const OutIndexerT &out_indexer,
+                        const TransformerT &transformer,
+                        std::vector<sycl::event> &host_tasks,
+                        const std::vector<sycl::event> &depends = {})
+{
+    static constexpr ScanOpT scan_op{};
+    static constexpr outputT identity =
+        su_ns::Identity<ScanOpT, outputT>::value;
+
+    const std::size_t chunk_size = static_cast<std::size_t>(wg_size) * n_wi;
+    const std::size_t tiles_per_row = ceiling_quotient(acc_nelems, chunk_size);
+    const std::size_t n_tiles = iter_nelems * tiles_per_row;
+
+    using dpctl::tensor::alloc_utils::smart_malloc_device;
+
+    // tile status flags followed by counter of started tiles
+    auto status_owner = smart_malloc_device<std::uint32_t>(n_tiles + 1, exec_q);
+    std::uint32_t *status = status_owner.get();
+    std::uint32_t *tile_counter = status + n_tiles;
+
+    // tile aggregates followed by inclusive prefixes of tiles
+    auto values_owner = smart_malloc_device<outputT>(2 * n_tiles, exec_q);
+    outputT *aggregates = values_owner.get();
+    outputT *prefixes = aggregates + n_tiles;
+
+    sycl::event init_ev = exec_q.fill<std::uint32_t>(
+        status, detail::lookback_tile_invalid, n_tiles + 1, depends);
+
+    sycl::event scan_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(init_ev);
+
+        using slmT = sycl::local_accessor<outputT, 1>;
+        slmT slm_tile(sycl::range<1>(chunk_size), cgh);
+        slmT slm_iscan_tmp(sycl::range<1>(wg_size), cgh);
+
+        const sycl::nd_range<1> ndRange{sycl::range<1>(n_tiles * wg_size),
+                                        sycl::range<1>(wg_size)};
+
+        using KernelName =
+            inclusive_scan_lookback_krn<inputT, outputT, n_wi, IterIndexerT,
+                                        InpIndexerT, OutIndexerT, TransformerT,
+                                        ScanOpT, include_initial>;
+
+        cgh.parallel_for<KernelName>(ndRange, [=](sycl::nd_item<1> it) {
+            const std::uint32_t lid = it.get_local_id(0);
+            const auto &wg = it.get_group();
+
+            using AtomicFlagRefT =
+                sycl::atomic_ref<std::uint32_t, sycl::memory_order::relaxed,
+                                 sycl::memory_scope::device,
+                                 sycl::access::address_space::global_space>;
+
+            std::uint32_t tile_id = 0;
+            if (lid == 0) {
+                AtomicFlagRefT counter_ref(*tile_counter);
+                tile_id = counter_ref.fetch_add(std::uint32_t(1));
+            }
+            tile_id = sycl::group_broadcast(wg, tile_id, 0);
+
+            const std::size_t iter_gid = tile_id / tiles_per_row;
+            const std::size_t tile_in_row = tile_id - iter_gid * tiles_per_row;
+            const std::size_t tile_start = tile_in_row * chunk_size;
+
+            const auto &iter_offsets = iter_indexer(iter_gid);
+            const auto &inp_iter_offset = iter_offsets.get_first_offset();
+            const auto &out_iter_offset = iter_offsets.get_second_offset();
+
+            // load tile with consecutive work-items reading consecutive
+            // elements, then have each work-item scan n_wi consecutive ones
+#pragma unroll
+            for (nwiT m_wi = 0; m_wi < n_wi; ++m_wi) {
+                const std::size_t j = m_wi * wg_size + lid;
+                const std::size_t i = tile_start + j;
+                if constexpr (!include_initial) {
+                    slm_tile[j] =
+                        (i < acc_nelems)
+                            ? transformer(input[inp_iter_offset +
+                                                inp_indexer(s0 + s1 * i)])
+                            : identity;
+                }
+                else {
+                    // shift input to the left by a single element relative to
+                    // output
+                    slm_tile[j] =
+                        (i < acc_nelems && i > 0)
+                            ? transformer(input[inp_iter_offset +
+                                                inp_indexer((s0 + s1 * i) - 1)])
+                            : identity;
+                }
+            }
+            sycl::group_barrier(wg);
+
+            std::array<outputT, n_wi> local_iscan;
+#pragma unroll
+            for (nwiT m_wi = 0; m_wi < n_wi; ++m_wi) {
+                local_iscan[m_wi] = slm_tile[lid * n_wi + m_wi];
+            }
+#pragma unroll
+            for (nwiT m_wi = 1; m_wi < n_wi; ++m_wi) {
+                local_iscan[m_wi] =
+                    scan_op(local_iscan[m_wi], local_iscan[m_wi - 1]);
+            }
+
+            outputT wg_iscan_val;
+            if constexpr (can_use_inclusive_scan_over_group<ScanOpT,
+                                                            outputT>::value)
+            {
+                wg_iscan_val = sycl::inclusive_scan_over_group(
+                    wg, local_iscan.back(), scan_op, identity);
+            }
+            else {
+                wg_iscan_val = su_ns::custom_inclusive_scan_over_group(
+                    wg, it.get_sub_group(), slm_iscan_tmp, local_iscan.back(),
+                    identity, scan_op);
+                // ensure all finished reading from SLM, to avoid race condition
+                // with subsequent writes into SLM
+                sycl::group_barrier(wg);
+            }
+
+            slm_iscan_tmp[(lid + 1) % wg_size] = wg_iscan_val;
+            sycl::group_barrier(wg);
+            const outputT modifier = (lid == 0) ? identity : slm_iscan_tmp[lid];
+            // the last work-item holds the aggregate of the tile
+            const outputT tile_aggregate = slm_iscan_tmp[0];
+            sycl::group_barrier(wg);
+
+            if (lid == 0) {
+                outputT exclusive_prefix = identity;
+                if (tile_in_row == 0) {
+                    prefixes[tile_id] = tile_aggregate;
+                    AtomicFlagRefT flag_ref(status[tile_id]);
+                    flag_ref.store(detail::lookback_tile_prefix,
+                                   sycl::memory_order::release);
+                }
+                else {
+                    aggregates[tile_id] = tile_aggregate;
+                    {
+                        AtomicFlagRefT flag_ref(status[tile_id]);
+                        flag_ref.store(detail::lookback_tile_aggregate,
+                                       sycl::memory_order::release);
+                    }
+
+                    // first tile of every row publishes its prefix, so
+                    // look-back never crosses into the preceding row
+                    std::size_t pred_id = tile_id - 1;
+                    while (true) {
+                        AtomicFlagRefT pred_ref(status[pred_id]);
+                        std::uint32_t pred_status;
+                        do {
+                            pred_status =
+                                pred_ref.load(sycl::memory_order::acquire);
+                        } while (pred_status == detail::lookback_tile_invalid);
+
+                        if (pred_status == detail::lookback_tile_prefix) {
+                            exclusive_prefix =
+                                scan_op(prefixes[pred_id], exclusive_prefix);
+                            break;
+                        }
+                        exclusive_prefix =
+                            scan_op(aggregates[pred_id], exclusive_prefix);
+                        --pred_id;
+                    }
+
+                    prefixes[tile_id] =
+                        scan_op(exclusive_prefix, tile_aggregate);
+                    AtomicFlagRefT flag_ref(status[tile_id]);
+                    flag_ref.store(detail::lookback_tile_prefix,
+                                   sycl::memory_order::release);
+                }
+                slm_iscan_tmp[0] = exclusive_prefix;
+            }
+            sycl::group_barrier(wg);
+
+            const outputT tile_prefix = slm_iscan_tmp[0];
+            const outputT wi_prefix = scan_op(tile_prefix, modifier);
+#pragma unroll
+            for (nwiT m_wi = 0; m_wi < n_wi; ++m_wi) {
+                slm_tile[lid * n_wi + m_wi] =
+                    scan_op(wi_prefix, local_iscan[m_wi]);
+            }
+            sycl::group_barrier(wg);
+
+#pragma unroll
+            for (nwiT m_wi = 0; m_wi < n_wi; ++m_wi) {
+                const std::size_t j = m_wi * wg_size + lid;
+                const std::size_t i = tile_start + j;
+                if (i < acc_nelems) {
+                    output[out_iter_offset + out_indexer(i)] = slm_tile[j];
+                }
+            }
+        });
+    });
+
+    sycl::event free_ev = dpctl::tensor::alloc_utils::async_smart_free(
+        exec_q, {scan_ev}, status_owner, values_owner);
+    host_tasks.push_back(free_ev);
+
+    return scan_ev;
+}
+
 template <typename outputT, nwiT n_wi, typename ScanOpT>
 class inclusive_scan_1d_iter_chunk_update_krn;
 
@@ -567,16 +873,11 @@ sycl::event update_local_chunks_1d(sycl::queue &exec_q,
                                    std::size_t chunk_size,
                                    const sycl::event &dependent_event)
 {
-    const auto &ctx = exec_q.get_context();
-    const auto &dev = exec_q.get_device();
-
-    const auto &kernel_id = sycl::get_kernel_id<UpdateKernelName>();
-    auto kb = sycl::get_kernel_bundle<sycl::bundle_state::executable>(
-        ctx, {dev}, {kernel_id});
-    auto krn = kb.get_kernel(kernel_id);
+    using dpctl::tensor::sycl_utils::get_kernel_launch_info;
+    const auto &launch_info = get_kernel_launch_info<UpdateKernelName>(exec_q);
+    const auto &kb = launch_info.bundle;
 
-    const std::uint32_t sg_size = krn.template get_info<
-        sycl::info::kernel_device_specific::max_sub_group_size>(dev);
+    const std::uint32_t sg_size = launch_info.max_sub_group_size;
 
     // output[ chunk_size * (i + 1) + j] += temp[i]
     sycl::event update_event = exec_q.submit([&](sycl::handler &cgh) {
@@ -652,6 +953,17 @@ sycl::event inclusive_scan_iter_1d(sycl::queue &exec_q,
     using NoOpIndexerT = dpctl::tensor::offset_utils::NoOpIndexer;
     static constexpr NoOpIndexerT _no_op_indexer{};
 
+    if (use_lookback_scan(exec_q, _iter_nelems, n_elems,
+                          static_cast<std::size_t>(wg_size) * n_wi))
+    {
+        return inclusive_scan_lookback<inputT, outputT, n_wi, IterIndexerT,
+                                       IndexerT, NoOpIndexerT, TransformerT,
+                                       ScanOpT, include_initial>(
+            exec_q, wg_size, _iter_nelems, n_elems, input, output, s0, s1,
+            _no_op_iter_indexer, indexer, _no_op_indexer, transformer,
+            host_tasks, depends);
+    }
+
     std::size_t n_groups;
     sycl::event inc_scan_phase1_ev =
         inclusive_scan_base_step<inputT, outputT, n_wi, IterIndexerT, IndexerT,
@@ -818,17 +1130,10 @@ sycl::event final_update_local_chunks(sycl::queue &exec_q,
                                       const OutIndexerT &out_indexer,
                                       sycl::event dependent_event)
 {
-    const auto &kernel_id = sycl::get_kernel_id<UpdateKernelName>();
+    using dpctl::tensor::sycl_utils::get_kernel_launch_info;
+    const auto &launch_info = get_kernel_launch_info<UpdateKernelName>(exec_q);
 
-    auto const &ctx = exec_q.get_context();
-    auto const &dev = exec_q.get_device();
-    auto kb = sycl::get_kernel_bundle<sycl::bundle_state::executable>(
-        ctx, {dev}, {kernel_id});
-
-    auto krn = kb.get_kernel(kernel_id);
-
-    const std::uint32_t sg_size = krn.template get_info<
-        sycl::info::kernel_device_specific::max_sub_group_size>(dev);
+    const std::uint32_t sg_size = launch_info.max_sub_group_size;
 
     static constexpr nwiT updates_per_wi = n_wi;
     const std::size_t updates_per_sg = sg_size * updates_per_wi;
@@ -943,6 +1248,17 @@ sycl::event inclusive_scan_iter(sycl::queue &exec_q,
             InpIterIndexerT, OutIterIndexerT>;
     const IterIndexerT iter_indexer{inp_iter_indexer, out_iter_indexer};
 
+    if (use_lookback_scan(exec_q, iter_nelems, acc_nelems,
+                          static_cast<std::size_t>(wg_size) * n_wi))
+    {
+        return inclusive_scan_lookback<inputT, outputT, n_wi, IterIndexerT,
+                                       InpIndexerT, OutIndexerT, TransformerT,
+                                       ScanOpT, include_initial>(
+            exec_q, wg_size, iter_nelems, acc_nelems, input, output, s0, s1,
+            iter_indexer, inp_indexer, out_indexer, transformer, host_tasks,
+            depends);
+    }
+
     std::size_t acc_groups;
     sycl::event inc_scan_phase1_ev =
         inclusive_scan_base_step<inputT, outputT, n_wi, IterIndexerT,
@@ -1188,13 +1504,24 @@ typedef std::size_t (*cumsum_val_contig_impl_fn_ptr_t)(
     std::vector<sycl::event> &,
     const std::vector<sycl::event> &);
 
+typedef sycl::event (*cumsum_val_contig_async_impl_fn_ptr_t)(
+    sycl::queue &,
+    std::size_t,
+    const char *,
+    char *,
+    std::vector<sycl::event> &,
+    const std::vector<sycl::event> &);
+
+/*! @brief Submits computation of cumulative sum of transformed `mask`
+ *         elements, and returns its event without waiting for the total */
 template <typename maskT, typename cumsumT, typename transformerT>
-std::size_t cumsum_val_contig_impl(sycl::queue &q,
-                                   std::size_t n_elems,
-                                   const char *mask,
-                                   char *cumsum,
-                                   std::vector<sycl::event> &host_tasks,
-                                   const std::vector<sycl::event> &depends = {})
+sycl::event
+cumsum_val_contig_async_impl(sycl::queue &q,
+                             std::size_t n_elems,
+                             const char *mask,
+                             char *cumsum,
+                             std::vector<sycl::event> &host_tasks,
+                             const std::vector<sycl::event> &depends = {})
 {
     const maskT *mask_data_ptr = reinterpret_cast<const maskT *>(mask);
     cumsumT *cumsum_data_ptr = reinterpret_cast<cumsumT *>(cumsum);
@@ -1231,6 +1558,23 @@ std::size_t cumsum_val_contig_impl(sycl::queue &q,
             q, wg_size, n_elems, mask_data_ptr, cumsum_data_ptr, s0, s1,
             flat_indexer, transformer, host_tasks, depends);
     }
+
+    return comp_ev;
+}
+
+template <typename maskT, typename cumsumT, typename transformerT>
+std::size_t cumsum_val_contig_impl(sycl::queue &q,
+                                   std::size_t n_elems,
+                                   const char *mask,
+                                   char *cumsum,
+                                   std::vector<sycl::event> &host_tasks,
+                                   const std::vector<sycl::event> &depends = {})
+{
+    sycl::event comp_ev =
+        cumsum_val_contig_async_impl<maskT, cumsumT, transformerT>(
+            q, n_elems, mask, cumsum, host_tasks, depends);
+
+    cumsumT *cumsum_data_ptr = reinterpret_cast<cumsumT *>(cumsum);
     cumsumT *last_elem = cumsum_data_ptr + (n_elems - 1);
 
     auto host_usm_owner =
@@ -1273,6 +1617,30 @@ template <typename fnT, typename T> struct MaskPositionsContigFactoryForInt64
     }
 };
 
+template <typename fnT, typename T>
+struct MaskPositionsContigAsyncFactoryForInt32
+{
+    fnT get()
+    {
+        using cumsumT = std::int32_t;
+        fnT fn = cumsum_val_contig_async_impl<T, cumsumT,
+                                              NonZeroIndicator<T, cumsumT>>;
+        return fn;
+    }
+};
+
+template <typename fnT, typename T>
+struct MaskPositionsContigAsyncFactoryForInt64
+{
+    fnT get()
+    {
+        using cumsumT = std::int64_t;
+        fnT fn = cumsum_val_contig_async_impl<T, cumsumT,
+                                              NonZeroIndicator<T, cumsumT>>;
+        return fn;
+    }
+};
+
 template <typename fnT, typename T> struct Cumsum1DContigFactory
 {
     fnT get()
@@ -1299,16 +1667,29 @@ typedef std::size_t (*cumsum_val_strided_impl_fn_ptr_t)(
     std::vector<sycl::event> &,
     const std::vector<sycl::event> &);
 
+typedef sycl::event (*cumsum_val_strided_async_impl_fn_ptr_t)(
+    sycl::queue &,
+    std::size_t,
+    const char *,
+    int,
+    const ssize_t *,
+    char *,
+    std::vector<sycl::event> &,
+    const std::vector<sycl::event> &);
+
+/*! @brief Submits computation of cumulative sum of transformed elements of
+ *         strided `mask`, and returns its event without waiting for the
+ *         total */
 template <typename maskT, typename cumsumT, typename transformerT>
-std::size_t
-cumsum_val_strided_impl(sycl::queue &q,
-                        std::size_t n_elems,
-                        const char *mask,
-                        int nd,
-                        const ssize_t *shape_strides,
-                        char *cumsum,
-                        std::vector<sycl::event> &host_tasks,
-                        const std::vector<sycl::event> &depends = {})
+sycl::event
+cumsum_val_strided_async_impl(sycl::queue &q,
+                              std::size_t n_elems,
+                              const char *mask,
+                              int nd,
+                              const ssize_t *shape_strides,
+                              char *cumsum,
+                              std::vector<sycl::event> &host_tasks,
+                              const std::vector<sycl::event> &depends = {})
 {
     const maskT *mask_data_ptr = reinterpret_cast<const maskT *>(mask);
     cumsumT *cumsum_data_ptr = reinterpret_cast<cumsumT *>(cumsum);
@@ -1346,6 +1727,25 @@ cumsum_val_strided_impl(sycl::queue &q,
             strided_indexer, transformer, host_tasks, depends);
     }
 
+    return comp_ev;
+}
+
+template <typename maskT, typename cumsumT, typename transformerT>
+std::size_t
+cumsum_val_strided_impl(sycl::queue &q,
+                        std::size_t n_elems,
+                        const char *mask,
+                        int nd,
+                        const ssize_t *shape_strides,
+                        char *cumsum,
+                        std::vector<sycl::event> &host_tasks,
+                        const std::vector<sycl::event> &depends = {})
+{
+    sycl::event comp_ev =
+        cumsum_val_strided_async_impl<maskT, cumsumT, transformerT>(
+            q, n_elems, mask, nd, shape_strides, cumsum, host_tasks, depends);
+
+    cumsumT *cumsum_data_ptr = reinterpret_cast<cumsumT *>(cumsum);
     cumsumT *last_elem = cumsum_data_ptr + (n_elems - 1);
 
     auto host_usm_owner =
@@ -1388,6 +1788,30 @@ template <typename fnT, typename T> struct MaskPositionsStridedFactoryForInt64
     }
 };
 
+template <typename fnT, typename T>
+struct MaskPositionsStridedAsyncFactoryForInt32
+{
+    fnT get()
+    {
+        using cumsumT = std::int32_t;
+        fnT fn = cumsum_val_strided_async_impl<T, cumsumT,
+                                               NonZeroIndicator<T, cumsumT>>;
+        return fn;
+    }
+};
+
+template <typename fnT, typename T>
+struct MaskPositionsStridedAsyncFactoryForInt64
+{
+    fnT get()
+    {
+        using cumsumT = std::int64_t;
+        fnT fn = cumsum_val_strided_async_impl<T, cumsumT,
+                                               NonZeroIndicator<T, cumsumT>>;
+        return fn;
+    }
+};
+
 template <typename fnT, typename T> struct Cumsum1DStridedFactory
 {
     fnT get()
@@ -287,6 +287,9 @@ typedef sycl::event (*clip_strided_impl_fn_ptr_t)(
     ssize_t,
     const std::vector<sycl::event> &);
 
+/*! @brief Submits strided kernel for `clip`. For `nd <= max_inline_nd`
+ *  `shape_strides` must be host accessible, and is copied into kernel
+ *  functor at submission, otherwise it must be kernel accessible USM. */
 template <typename T>
 sycl::event clip_strided_impl(sycl::queue &q,
                               std::size_t nelems,
@@ -310,15 +313,31 @@ sycl::event clip_strided_impl(sycl::queue &q,
     sycl::event clip_ev = q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends);
 
-        const FourOffsets_StridedIndexer indexer{
-            nd, x_offset, min_offset, max_offset, dst_offset, shape_strides};
+        if (nd <= max_inline_nd) {
+            using IndexerT = FourOffsets_InlineStridedIndexer<max_inline_nd>;
+            const IndexerT indexer{nd,         x_offset,   min_offset,
+                                   max_offset, dst_offset, shape_strides};
 
-        using KernelName = clip_strided_kernel<T, FourOffsets_StridedIndexer>;
-        using Impl = ClipStridedFunctor<T, FourOffsets_StridedIndexer>;
+            using KernelName = clip_strided_kernel<T, IndexerT>;
+            using Impl = ClipStridedFunctor<T, IndexerT>;
 
-        cgh.parallel_for<KernelName>(
-            sycl::range<1>(nelems),
-            Impl(x_tp, min_tp, max_tp, dst_tp, indexer));
+            cgh.parallel_for<KernelName>(
+                sycl::range<1>(nelems),
+                Impl(x_tp, min_tp, max_tp, dst_tp, indexer));
+        }
+        else {
+            const FourOffsets_StridedIndexer indexer{
+                nd,         x_offset,   min_offset,
+                max_offset, dst_offset, shape_strides};
+
+            using KernelName =
+                clip_strided_kernel<T, FourOffsets_StridedIndexer>;
+            using Impl = ClipStridedFunctor<T, FourOffsets_StridedIndexer>;
+
+            cgh.parallel_for<KernelName>(
+                sycl::range<1>(nelems),
+                Impl(x_tp, min_tp, max_tp, dst_tp, indexer));
+        }
     });
 
     return clip_ev;
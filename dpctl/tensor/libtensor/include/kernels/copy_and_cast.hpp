@@ -23,11 +23,14 @@
 //===----------------------------------------------------------------------===//
 
 #pragma once
+#include <algorithm>
 #include <complex>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <sycl/sycl.hpp>
 #include <type_traits>
+#include <vector>
 
 #include "dpctl_tensor_types.hpp"
 #include "kernels/alignment.hpp"
@@ -70,6 +73,7 @@ class copy_cast_from_host_kernel;
 template <typename srcT, typename dstT, typename IndexerT>
 class copy_cast_from_host_contig_kernel;
 
+
 template <typename srcTy, typename dstTy> class Caster
 {
 public:
@@ -130,9 +134,11 @@ typedef sycl::event (*copy_and_cast_generic_fn_ptr_t)(
  `dst` usm_ndarray while casting from `srcTy` to `dstTy`.
 
    Both arrays have array dimensionality specified via argument `nd`. The
- `shape_and_strides` is kernel accessible USM array of length `3*nd`, where the
- first `nd` elements encode common shape, second `nd` elements contain strides
- of `src` array, and the trailing `nd` elements contain strides of `dst` array.
+ `shape_and_strides` is an array of length `3*nd`, where the first `nd`
+ elements encode common shape, second `nd` elements contain strides of `src`
+ array, and the trailing `nd` elements contain strides of `dst` array. For
+ `nd <= max_inline_nd` the array must be host accessible, and is copied into
+ the kernel functor at submission, otherwise it must be kernel accessible USM.
  `src_p` and `dst_p` represent pointers into respective arrays, but the start of
  iteration begins at offset of `src_offset` elements for `src` array and at
  offset `dst_offset` elements for `dst` array. Kernel is submitted to sycl queue
@@ -142,8 +148,8 @@ typedef sycl::event (*copy_and_cast_generic_fn_ptr_t)(
    @param  nelems  Number of elements to cast and copy.
    @param  nd      Array dimensionality, i.e. number of indices needed to
  identify an element of each array.
-   @param  shape_and_strides  Kernel accessible USM pointer to packed shape and
- strides.
+   @param  shape_and_strides  Pointer to packed shape and strides, host
+ accessible if `nd <= max_inline_nd`, kernel accessible USM otherwise.
    @param  src_p   Kernel accessible USM pointer for the source array
    @param  src_offset  Offset to the beginning of iteration in number of
  elements of source array from `src_p`.
@@ -178,17 +184,31 @@ copy_and_cast_generic_impl(sycl::queue &q,
         cgh.depends_on(depends);
         cgh.depends_on(additional_depends);
 
-        const TwoOffsets_StridedIndexer indexer{nd, src_offset, dst_offset,
-                                                shape_and_strides};
         const srcTy *src_tp = reinterpret_cast<const srcTy *>(src_p);
         dstTy *dst_tp = reinterpret_cast<dstTy *>(dst_p);
 
-        cgh.parallel_for<class copy_cast_generic_kernel<
-            srcTy, dstTy, TwoOffsets_StridedIndexer>>(
-            sycl::range<1>(nelems),
-            GenericCopyFunctor<srcTy, dstTy, Caster<srcTy, dstTy>,
-                               TwoOffsets_StridedIndexer>(src_tp, dst_tp,
-                                                          indexer));
+        if (nd <= max_inline_nd) {
+            using IndexerT = TwoOffsets_InlineStridedIndexer<max_inline_nd>;
+            const IndexerT indexer{nd, src_offset, dst_offset,
+                                   shape_and_strides};
+
+            cgh.parallel_for<
+                class copy_cast_generic_kernel<srcTy, dstTy, IndexerT>>(
+                sycl::range<1>(nelems),
+                GenericCopyFunctor<srcTy, dstTy, Caster<srcTy, dstTy>,
+                                   IndexerT>(src_tp, dst_tp, indexer));
+        }
+        else {
+            const TwoOffsets_StridedIndexer indexer{nd, src_offset, dst_offset,
+                                                    shape_and_strides};
+
+            cgh.parallel_for<class copy_cast_generic_kernel<
+                srcTy, dstTy, TwoOffsets_StridedIndexer>>(
+                sycl::range<1>(nelems),
+                GenericCopyFunctor<srcTy, dstTy, Caster<srcTy, dstTy>,
+                                   TwoOffsets_StridedIndexer>(src_tp, dst_tp,
+                                                              indexer));
+        }
     });
 
     return copy_and_cast_ev;
@@ -761,6 +781,104 @@ struct CopyAndCastFromHostContigFactory
     }
 };
 
+typedef sycl::event (*copy_from_host_staged_fn_ptr_t)(
+    sycl::queue &,
+    std::size_t,                 /* nelems */
+    const char *,                /* host_src_p */
+    char *,                      /* dst_p */
+    const std::vector<char *> &, /* staging buffers */
+    std::size_t,                 /* staging buffer size in bytes */
+    const std::vector<sycl::event> &);
+
+/*!
+ * @brief Function to copy from contiguous host memory with elements of type
+ * `Ty` into contiguous USM allocation with elements of the same type
+ * through USM-host staging buffers, without synchronizing with the host.
+ *
+ * Source is processed in chunks filling a staging buffer. Chunks are
+ * copied into staging buffers by host tasks, and are copied into the
+ * destination on the device, so that filling a staging buffer overlaps
+ * with copying of chunks staged in other buffers. The source memory
+ * must remain valid and unmodified until the returned event completes.
+ * Casting, if needed, is expected to be done on the host beforehand.
+ *
+ * @param q  The queue where the routine should be executed.
+ * @param nelems Number of elements to copy.
+ * @param host_src_p  Host pointer to the first element of the source.
+ * @param dst_p  USM pointer to the first element of the destination.
+ * @param staging  USM-host buffers bound to the context of `q`.
+ * @param staging_nbytes  Size of every staging buffer in bytes.
+ * @param depends  List of events to wait for before writing into the
+ * destination, if any.
+ *
+ * @return Event signaling completion of the copy.
+ * @ingroup CopyAndCastKernels
+ */
+template <typename Ty>
+sycl::event copy_from_host_staged_impl(sycl::queue &q,
+                                       std::size_t nelems,
+                                       const char *host_src_p,
+                                       char *dst_p,
+                                       const std::vector<char *> &staging,
+                                       std::size_t staging_nbytes,
+                                       const std::vector<sycl::event> &depends)
+{
+    dpctl::tensor::type_utils::validate_type_for_device<Ty>(q);
+
+    const Ty *src_tp = reinterpret_cast<const Ty *>(host_src_p);
+    Ty *dst_tp = reinterpret_cast<Ty *>(dst_p);
+
+    const std::size_t n_staging = staging.size();
+    const std::size_t chunk_nelems = staging_nbytes / sizeof(Ty);
+    const std::size_t n_chunks = (nelems + chunk_nelems - 1) / chunk_nelems;
+
+    // events signaling the last use of each staging buffer
+    std::vector<sycl::event> staging_evs(n_staging);
+
+    for (std::size_t chunk_id = 0; chunk_id < n_chunks; ++chunk_id) {
+        const std::size_t buf_id = chunk_id % n_staging;
+        const std::size_t offset = chunk_id * chunk_nelems;
+        const std::size_t count = std::min(chunk_nelems, nelems - offset);
+
+        const Ty *src_chunk_tp = src_tp + offset;
+        Ty *stage_tp = reinterpret_cast<Ty *>(staging[buf_id]);
+        Ty *dst_chunk_tp = dst_tp + offset;
+
+        sycl::event fill_ev = q.submit([&](sycl::handler &cgh) {
+            // staging buffer must no longer be read by the device
+            cgh.depends_on(staging_evs[buf_id]);
+            cgh.host_task([=]() {
+                std::memcpy(stage_tp, src_chunk_tp, count * sizeof(Ty));
+            });
+        });
+
+        std::vector<sycl::event> copy_deps(depends);
+        copy_deps.push_back(fill_ev);
+        staging_evs[buf_id] =
+            q.memcpy(dst_chunk_tp, stage_tp, count * sizeof(Ty), copy_deps);
+    }
+
+    // every chunk precedes the last use of its staging buffer
+    return q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(staging_evs);
+        cgh.ext_oneapi_barrier();
+    });
+}
+
+/*!
+ * @brief Factory to get function pointer of type `fnT` for given NumPy array
+ * data type `T`, also the data type of the destination.
+ * @defgroup CopyAndCastKernels
+ */
+template <typename fnT, typename T> struct CopyFromHostStagedFactory
+{
+    fnT get()
+    {
+        fnT f = copy_from_host_staged_impl<T>;
+        return f;
+    }
+};
+
 // =============== Copying for reshape ================== //
 
 template <typename Ty, typename SrcIndexerT, typename DstIndexerT>
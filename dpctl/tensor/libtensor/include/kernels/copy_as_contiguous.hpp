@@ -31,6 +31,7 @@
 
 #include "dpctl_tensor_types.hpp"
 #include "kernels/alignment.hpp"
+#include "utils/kernel_launch_cache.hpp"
 #include "utils/offset_utils.hpp"
 #include "utils/sycl_utils.hpp"
 #include "utils/type_utils.hpp"
@@ -153,17 +154,11 @@ sycl::event submit_c_contiguous_copy(sycl::queue &exec_q,
 
     static constexpr std::size_t preferred_lws = 256;
 
-    const auto &kernel_id = sycl::get_kernel_id<KernelName>();
+    using dpctl::tensor::sycl_utils::get_kernel_launch_info;
+    const auto &launch_info = get_kernel_launch_info<KernelName>(exec_q);
+    const auto &kb = launch_info.bundle;
 
-    auto const &ctx = exec_q.get_context();
-    auto const &dev = exec_q.get_device();
-    auto kb = sycl::get_kernel_bundle<sycl::bundle_state::executable>(
-        ctx, {dev}, {kernel_id});
-
-    auto krn = kb.get_kernel(kernel_id);
-
-    const std::uint32_t max_sg_size = krn.template get_info<
-        sycl::info::kernel_device_specific::max_sub_group_size>(dev);
+    const std::uint32_t max_sg_size = launch_info.max_sub_group_size;
 
     const std::size_t lws =
         ((preferred_lws + max_sg_size - 1) / max_sg_size) * max_sg_size;
@@ -349,6 +349,9 @@ sycl::event unary_contig_impl(sycl::queue &exec_q,
     return comp_ev;
 }
 
+/*! @brief Submits strided unary kernel. For `nd <= max_inline_nd`
+ *  `shape_and_strides` must be host accessible, and is copied into kernel
+ *  functor at submission, otherwise it must be kernel accessible USM. */
 template <typename argTy,
           template <typename T>
           class UnaryOutputType,
@@ -373,18 +376,35 @@ unary_strided_impl(sycl::queue &exec_q,
         cgh.depends_on(additional_depends);
 
         using resTy = typename UnaryOutputType<argTy>::value_type;
-        using IndexerT =
-            typename dpctl::tensor::offset_utils::TwoOffsets_StridedIndexer;
-
-        const IndexerT indexer{nd, arg_offset, res_offset, shape_and_strides};
 
         const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_p);
         resTy *res_tp = reinterpret_cast<resTy *>(res_p);
 
-        using Impl = StridedFunctorT<argTy, resTy, IndexerT>;
+        using dpctl::tensor::offset_utils::max_inline_nd;
+        if (nd <= max_inline_nd) {
+            using IndexerT = typename dpctl::tensor::offset_utils::
+                TwoOffsets_InlineStridedIndexer<max_inline_nd>;
+
+            const IndexerT indexer{nd, arg_offset, res_offset,
+                                   shape_and_strides};
+
+            using Impl = StridedFunctorT<argTy, resTy, IndexerT>;
+
+            cgh.parallel_for<kernel_name<argTy, resTy, IndexerT>>(
+                {nelems}, Impl(arg_tp, res_tp, indexer));
+        }
+        else {
+            using IndexerT =
+                typename dpctl::tensor::offset_utils::TwoOffsets_StridedIndexer;
+
+            const IndexerT indexer{nd, arg_offset, res_offset,
+                                   shape_and_strides};
+
+            using Impl = StridedFunctorT<argTy, resTy, IndexerT>;
 
-        cgh.parallel_for<kernel_name<argTy, resTy, IndexerT>>(
-            {nelems}, Impl(arg_tp, res_tp, indexer));
+            cgh.parallel_for<kernel_name<argTy, resTy, IndexerT>>(
+                {nelems}, Impl(arg_tp, res_tp, indexer));
+        }
     });
     return comp_ev;
 }
@@ -841,6 +861,9 @@ sycl::event binary_contig_impl(sycl::queue &exec_q,
     return comp_ev;
 }
 
+/*! @brief Submits strided binary kernel. For `nd <= max_inline_nd`
+ *  `shape_and_strides` must be host accessible, and is copied into kernel
+ *  functor at submission, otherwise it must be kernel accessible USM. */
 template <typename argTy1,
           typename argTy2,
           template <typename T1, typename T2>
@@ -869,20 +892,37 @@ binary_strided_impl(sycl::queue &exec_q,
 
         using resTy = typename BinaryOutputType<argTy1, argTy2>::value_type;
 
-        using IndexerT =
-            typename dpctl::tensor::offset_utils::ThreeOffsets_StridedIndexer;
-
-        const IndexerT indexer{nd, arg1_offset, arg2_offset, res_offset,
-                               shape_and_strides};
-
         const argTy1 *arg1_tp = reinterpret_cast<const argTy1 *>(arg1_p);
         const argTy2 *arg2_tp = reinterpret_cast<const argTy2 *>(arg2_p);
         resTy *res_tp = reinterpret_cast<resTy *>(res_p);
 
-        using Impl = BinaryStridedFunctorT<argTy1, argTy2, resTy, IndexerT>;
+        using dpctl::tensor::offset_utils::max_inline_nd;
+        if (nd <= max_inline_nd) {
+            using IndexerT = typename dpctl::tensor::offset_utils::
+                ThreeOffsets_InlineStridedIndexer<max_inline_nd>;
+
+            const IndexerT indexer{nd, arg1_offset, arg2_offset, res_offset,
+                                   shape_and_strides};
+
+            using Impl =
+                BinaryStridedFunctorT<argTy1, argTy2, resTy, IndexerT>;
 
-        cgh.parallel_for<kernel_name<argTy1, argTy2, resTy, IndexerT>>(
-            {nelems}, Impl(arg1_tp, arg2_tp, res_tp, indexer));
+            cgh.parallel_for<kernel_name<argTy1, argTy2, resTy, IndexerT>>(
+                {nelems}, Impl(arg1_tp, arg2_tp, res_tp, indexer));
+        }
+        else {
+            using IndexerT = typename dpctl::tensor::offset_utils::
+                ThreeOffsets_StridedIndexer;
+
+            const IndexerT indexer{nd, arg1_offset, arg2_offset, res_offset,
+                                   shape_and_strides};
+
+            using Impl =
+                BinaryStridedFunctorT<argTy1, argTy2, resTy, IndexerT>;
+
+            cgh.parallel_for<kernel_name<argTy1, argTy2, resTy, IndexerT>>(
+                {nelems}, Impl(arg1_tp, arg2_tp, res_tp, indexer));
+        }
     });
     return comp_ev;
 }
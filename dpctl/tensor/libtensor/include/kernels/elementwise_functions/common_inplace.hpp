@@ -364,6 +364,9 @@ binary_inplace_contig_impl(sycl::queue &exec_q,
     return comp_ev;
 }
 
+/*! @brief Submits strided in-place binary kernel. For `nd <= max_inline_nd`
+ *  `shape_and_strides` must be host accessible, and is copied into kernel
+ *  functor at submission, otherwise it must be kernel accessible USM. */
 template <typename argTy,
           typename resTy,
           template <typename T1, typename T2, typename IndT>
@@ -386,18 +389,34 @@ binary_inplace_strided_impl(sycl::queue &exec_q,
         cgh.depends_on(depends);
         cgh.depends_on(additional_depends);
 
-        using IndexerT =
-            typename dpctl::tensor::offset_utils::TwoOffsets_StridedIndexer;
-
-        const IndexerT indexer{nd, rhs_offset, lhs_offset, shape_and_strides};
-
         const argTy *arg_tp = reinterpret_cast<const argTy *>(rhs_p);
         resTy *res_tp = reinterpret_cast<resTy *>(lhs_p);
 
-        using Impl = BinaryInplaceStridedFunctorT<argTy, resTy, IndexerT>;
+        using dpctl::tensor::offset_utils::max_inline_nd;
+        if (nd <= max_inline_nd) {
+            using IndexerT = typename dpctl::tensor::offset_utils::
+                TwoOffsets_InlineStridedIndexer<max_inline_nd>;
+
+            const IndexerT indexer{nd, rhs_offset, lhs_offset,
+                                   shape_and_strides};
+
+            using Impl = BinaryInplaceStridedFunctorT<argTy, resTy, IndexerT>;
+
+            cgh.parallel_for<kernel_name<argTy, resTy, IndexerT>>(
+                {nelems}, Impl(arg_tp, res_tp, indexer));
+        }
+        else {
+            using IndexerT =
+                typename dpctl::tensor::offset_utils::TwoOffsets_StridedIndexer;
+
+            const IndexerT indexer{nd, rhs_offset, lhs_offset,
+                                   shape_and_strides};
 
-        cgh.parallel_for<kernel_name<argTy, resTy, IndexerT>>(
-            {nelems}, Impl(arg_tp, res_tp, indexer));
+            using Impl = BinaryInplaceStridedFunctorT<argTy, resTy, IndexerT>;
+
+            cgh.parallel_for<kernel_name<argTy, resTy, IndexerT>>(
+                {nelems}, Impl(arg_tp, res_tp, indexer));
+        }
     });
     return comp_ev;
 }
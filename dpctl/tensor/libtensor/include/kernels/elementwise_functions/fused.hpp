@@ -0,0 +1,464 @@
+//=== fused.hpp - Fused elementwise expressions          ------  *-C++-*--/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===---------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels evaluating expressions composed of elementwise
+/// functions in a single pass over memory. Expression is encoded as a short
+/// program for a stack machine, which is interpreted for every element by
+/// applying operator functors of individual elementwise functions.
+//===---------------------------------------------------------------------===//
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <sycl/sycl.hpp>
+#include <type_traits>
+#include <vector>
+
+#include "kernels/dpctl_tensor_types.hpp"
+#include "kernels/elementwise_functions/abs.hpp"
+#include "kernels/elementwise_functions/add.hpp"
+#include "kernels/elementwise_functions/cos.hpp"
+#include "kernels/elementwise_functions/exp.hpp"
+#include "kernels/elementwise_functions/expm1.hpp"
+#include "kernels/elementwise_functions/log.hpp"
+#include "kernels/elementwise_functions/log1p.hpp"
+#include "kernels/elementwise_functions/maximum.hpp"
+#include "kernels/elementwise_functions/minimum.hpp"
+#include "kernels/elementwise_functions/multiply.hpp"
+#include "kernels/elementwise_functions/negative.hpp"
+#include "kernels/elementwise_functions/sin.hpp"
+#include "kernels/elementwise_functions/sqrt.hpp"
+#include "kernels/elementwise_functions/square.hpp"
+#include "kernels/elementwise_functions/subtract.hpp"
+#include "kernels/elementwise_functions/tanh.hpp"
+#include "kernels/elementwise_functions/true_divide.hpp"
+#include "utils/offset_utils.hpp"
+#include "utils/type_dispatch_building.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+namespace fused
+{
+
+using dpctl::tensor::ssize_t;
+namespace td_ns = dpctl::tensor::type_dispatch;
+
+/*! @brief Operation codes of fused expression programs. Values must be kept
+ *         in sync with `dpctl/tensor/_fuse.py`. */
+enum class FusedOpCode : std::uint8_t
+{
+    load_input = 0,
+    load_scalar = 1,
+    // unary operations
+    negative = 2,
+    abs = 3,
+    exp = 4,
+    expm1 = 5,
+    log = 6,
+    log1p = 7,
+    sqrt = 8,
+    square = 9,
+    sin = 10,
+    cos = 11,
+    tanh = 12,
+    // binary operations
+    add = 13,
+    subtract = 14,
+    multiply = 15,
+    divide = 16,
+    maximum = 17,
+    minimum = 18,
+    // sentinel
+    num_opcodes = 19,
+};
+
+struct FusedInstruction
+{
+    std::uint8_t opcode;
+    std::uint8_t arg;
+};
+
+static constexpr std::size_t max_fused_inputs = 8;
+static constexpr std::size_t max_fused_instructions = 64;
+static constexpr std::size_t max_fused_scalars = 16;
+static constexpr std::size_t max_fused_stack_depth = 16;
+
+/*! @brief Fused expression program, passed to kernels by value */
+template <typename T> struct FusedProgram
+{
+    std::array<FusedInstruction, max_fused_instructions> code;
+    std::array<T, max_fused_scalars> scalars;
+    std::uint32_t n_instructions;
+    std::uint32_t n_inputs;
+};
+
+/*! @brief Evaluate program for one element given values of inputs */
+template <typename T>
+T evaluate_fused_program(const FusedProgram<T> &prog, const T *vals)
+{
+    T stack[max_fused_stack_depth];
+    std::uint32_t sp = 0;
+
+    for (std::uint32_t i = 0; i < prog.n_instructions; ++i) {
+        const FusedInstruction &ins = prog.code[i];
+        switch (static_cast<FusedOpCode>(ins.opcode)) {
+        case FusedOpCode::load_input:
+            stack[sp++] = vals[ins.arg];
+            break;
+        case FusedOpCode::load_scalar:
+            stack[sp++] = prog.scalars[ins.arg];
+            break;
+        case FusedOpCode::negative:
+            stack[sp - 1] = negative::NegativeFunctor<T, T>{}(stack[sp - 1]);
+            break;
+        case FusedOpCode::abs:
+            stack[sp - 1] = abs::AbsFunctor<T, T>{}(stack[sp - 1]);
+            break;
+        case FusedOpCode::exp:
+            stack[sp - 1] = exp::ExpFunctor<T, T>{}(stack[sp - 1]);
+            break;
+        case FusedOpCode::expm1:
+            stack[sp - 1] = expm1::Expm1Functor<T, T>{}(stack[sp - 1]);
+            break;
+        case FusedOpCode::log:
+            stack[sp - 1] = log::LogFunctor<T, T>{}(stack[sp - 1]);
+            break;
+        case FusedOpCode::log1p:
+            stack[sp - 1] = log1p::Log1pFunctor<T, T>{}(stack[sp - 1]);
+            break;
+        case FusedOpCode::sqrt:
+            stack[sp - 1] = sqrt::SqrtFunctor<T, T>{}(stack[sp - 1]);
+            break;
+        case FusedOpCode::square:
+            stack[sp - 1] = square::SquareFunctor<T, T>{}(stack[sp - 1]);
+            break;
+        case FusedOpCode::sin:
+            stack[sp - 1] = sin::SinFunctor<T, T>{}(stack[sp - 1]);
+            break;
+        case FusedOpCode::cos:
+            stack[sp - 1] = cos::CosFunctor<T, T>{}(stack[sp - 1]);
+            break;
+        case FusedOpCode::tanh:
+            stack[sp - 1] = tanh::TanhFunctor<T, T>{}(stack[sp - 1]);
+            break;
+        case FusedOpCode::add:
+            --sp;
+            stack[sp - 1] =
+                add::AddFunctor<T, T, T>{}(stack[sp - 1], stack[sp]);
+            break;
+        case FusedOpCode::subtract:
+            --sp;
+            stack[sp - 1] =
+                subtract::SubtractFunctor<T, T, T>{}(stack[sp - 1], stack[sp]);
+            break;
+        case FusedOpCode::multiply:
+            --sp;
+            stack[sp - 1] =
+                multiply::MultiplyFunctor<T, T, T>{}(stack[sp - 1], stack[sp]);
+            break;
+        case FusedOpCode::divide:
+            --sp;
+            stack[sp - 1] = true_divide::TrueDivideFunctor<T, T, T>{}(
+                stack[sp - 1], stack[sp]);
+            break;
+        case FusedOpCode::maximum:
+            --sp;
+            stack[sp - 1] =
+                maximum::MaximumFunctor<T, T, T>{}(stack[sp - 1], stack[sp]);
+            break;
+        case FusedOpCode::minimum:
+            --sp;
+            stack[sp - 1] =
+                minimum::MinimumFunctor<T, T, T>{}(stack[sp - 1], stack[sp]);
+            break;
+        default:
+            break;
+        }
+    }
+
+    return stack[0];
+}
+
+/*! @brief Indexer computing offsets of all inputs and of the output.
+ *
+ *  `packed_shape_strides` holds `nd` elements of the common shape followed
+ *  by `nd` strides of each of `n_arrays` arrays, output last. Kept by value
+ *  if `by_value` is true, otherwise it must be a kernel accessible pointer.
+ */
+template <bool by_value> class FusedStridedIndexer;
+
+template <> class FusedStridedIndexer<true>
+{
+private:
+    static constexpr std::size_t capacity =
+        dpctl::tensor::offset_utils::max_inline_nd * (max_fused_inputs + 2);
+
+    int nd;
+    int n_arrays;
+    std::array<ssize_t, capacity> shape_strides;
+
+public:
+    FusedStridedIndexer(int nd_,
+                        int n_arrays_,
+                        const ssize_t *packed_shape_strides)
+        : nd(nd_), n_arrays(n_arrays_), shape_strides{}
+    {
+        const int n = nd * (n_arrays + 1);
+        for (int i = 0; i < n; ++i) {
+            shape_strides[i] = packed_shape_strides[i];
+        }
+    }
+
+    void operator()(ssize_t gid, ssize_t *offsets) const
+    {
+        compute_offsets(gid, offsets, nd, n_arrays, shape_strides.data());
+    }
+
+    static void compute_offsets(ssize_t gid,
+                                ssize_t *offsets,
+                                int nd,
+                                int n_arrays,
+                                const ssize_t *shape_strides)
+    {
+        for (int k = 0; k < n_arrays; ++k) {
+            offsets[k] = 0;
+        }
+        ssize_t rem = gid;
+        for (int d = nd - 1; d >= 0; --d) {
+            const ssize_t si = shape_strides[d];
+            const ssize_t q = rem / si;
+            const ssize_t r = rem - q * si;
+            for (int k = 0; k < n_arrays; ++k) {
+                offsets[k] += r * shape_strides[(k + 1) * nd + d];
+            }
+            rem = q;
+        }
+    }
+};
+
+template <> class FusedStridedIndexer<false>
+{
+private:
+    int nd;
+    int n_arrays;
+    const ssize_t *shape_strides;
+
+public:
+    FusedStridedIndexer(int nd_,
+                        int n_arrays_,
+                        const ssize_t *packed_shape_strides)
+        : nd(nd_), n_arrays(n_arrays_), shape_strides(packed_shape_strides)
+    {
+    }
+
+    void operator()(ssize_t gid, ssize_t *offsets) const
+    {
+        FusedStridedIndexer<true>::compute_offsets(gid, offsets, nd, n_arrays,
+                                                   shape_strides);
+    }
+};
+
+template <typename T> class FusedContigFunctor
+{
+private:
+    std::array<const T *, max_fused_inputs> inputs;
+    T *dst = nullptr;
+    FusedProgram<T> prog;
+
+public:
+    FusedContigFunctor(const std::array<const T *, max_fused_inputs> &inputs_,
+                       T *dst_,
+                       const FusedProgram<T> &prog_)
+        : inputs(inputs_), dst(dst_), prog(prog_)
+    {
+    }
+
+    void operator()(sycl::id<1> id) const
+    {
+        const std::size_t i = id[0];
+
+        // every input is read exactly once
+        T vals[max_fused_inputs];
+        for (std::uint32_t k = 0; k < prog.n_inputs; ++k) {
+            vals[k] = inputs[k][i];
+        }
+        dst[i] = evaluate_fused_program<T>(prog, vals);
+    }
+};
+
+template <typename T, typename IndexerT> class FusedStridedFunctor
+{
+private:
+    std::array<const T *, max_fused_inputs> inputs;
+    T *dst = nullptr;
+    FusedProgram<T> prog;
+    IndexerT indexer;
+
+public:
+    FusedStridedFunctor(const std::array<const T *, max_fused_inputs> &inputs_,
+                        T *dst_,
+                        const FusedProgram<T> &prog_,
+                        const IndexerT &indexer_)
+        : inputs(inputs_), dst(dst_), prog(prog_), indexer(indexer_)
+    {
+    }
+
+    void operator()(sycl::id<1> id) const
+    {
+        ssize_t offsets[max_fused_inputs + 1];
+        indexer(static_cast<ssize_t>(id[0]), offsets);
+
+        T vals[max_fused_inputs];
+        for (std::uint32_t k = 0; k < prog.n_inputs; ++k) {
+            vals[k] = inputs[k][offsets[k]];
+        }
+        dst[offsets[prog.n_inputs]] = evaluate_fused_program<T>(prog, vals);
+    }
+};
+
+/*! @brief Types supported by fused expression kernels */
+template <typename T> struct FusedOutputType
+{
+    using value_type =
+        typename std::disjunction<td_ns::TypeMapResultEntry<T, sycl::half>,
+                                  td_ns::TypeMapResultEntry<T, float>,
+                                  td_ns::TypeMapResultEntry<T, double>,
+                                  td_ns::DefaultResultEntry<void>>::result_type;
+
+    static constexpr bool is_defined = !std::is_same_v<value_type, void>;
+};
+
+typedef sycl::event (*fused_elementwise_impl_fn_ptr_t)(
+    sycl::queue &,
+    std::size_t,
+    int,
+    const ssize_t *,
+    const std::vector<const char *> &,
+    char *,
+    const std::vector<FusedInstruction> &,
+    const std::vector<double> &,
+    const std::vector<sycl::event> &);
+
+template <typename T> class fused_contig_kernel;
+template <typename T, typename IndexerT> class fused_strided_kernel;
+
+/*!
+ * @brief Evaluate fused expression program.
+ *
+ * @param exec_q  Execution queue
+ * @param nelems  Number of elements of the output
+ * @param nd      Dimensionality of iteration space, zero if all arrays are
+ *                C-contiguous, or all arrays are F-contiguous
+ * @param packed_shape_strides  Common shape followed by strides of inputs and
+ *                of the output. For `nd <= max_inline_nd` it must be host
+ *                accessible, and is copied into kernel functor at
+ *                submission, otherwise it must be kernel accessible USM.
+ * @param input_ps  Data pointers of inputs
+ * @param dst_p     Data pointer of the output
+ * @param code      Program instructions, validated by the caller
+ * @param scalars   Values of scalar constants referenced by the program
+ * @param depends   Events to wait on before the kernel starts
+ */
+template <typename T>
+sycl::event fused_elementwise_impl(sycl::queue &exec_q,
+                                   std::size_t nelems,
+                                   int nd,
+                                   const ssize_t *packed_shape_strides,
+                                   const std::vector<const char *> &input_ps,
+                                   char *dst_p,
+                                   const std::vector<FusedInstruction> &code,
+                                   const std::vector<double> &scalars,
+                                   const std::vector<sycl::event> &depends)
+{
+    FusedProgram<T> prog{};
+    prog.n_instructions = static_cast<std::uint32_t>(code.size());
+    prog.n_inputs = static_cast<std::uint32_t>(input_ps.size());
+    for (std::size_t i = 0; i < code.size(); ++i) {
+        prog.code[i] = code[i];
+    }
+    for (std::size_t i = 0; i < scalars.size(); ++i) {
+        prog.scalars[i] = static_cast<T>(scalars[i]);
+    }
+
+    std::array<const T *, max_fused_inputs> inputs{};
+    for (std::size_t k = 0; k < input_ps.size(); ++k) {
+        inputs[k] = reinterpret_cast<const T *>(input_ps[k]);
+    }
+    T *dst_tp = reinterpret_cast<T *>(dst_p);
+
+    const int n_arrays = static_cast<int>(input_ps.size()) + 1;
+
+    sycl::event comp_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        if (nd == 0) {
+            using Impl = FusedContigFunctor<T>;
+
+            cgh.parallel_for<fused_contig_kernel<T>>(
+                {nelems}, Impl(inputs, dst_tp, prog));
+        }
+        else if (nd <= dpctl::tensor::offset_utils::max_inline_nd) {
+            using IndexerT = FusedStridedIndexer<true>;
+            const IndexerT indexer{nd, n_arrays, packed_shape_strides};
+
+            using Impl = FusedStridedFunctor<T, IndexerT>;
+
+            cgh.parallel_for<fused_strided_kernel<T, IndexerT>>(
+                {nelems}, Impl(inputs, dst_tp, prog, indexer));
+        }
+        else {
+            using IndexerT = FusedStridedIndexer<false>;
+            const IndexerT indexer{nd, n_arrays, packed_shape_strides};
+
+            using Impl = FusedStridedFunctor<T, IndexerT>;
+
+            cgh.parallel_for<fused_strided_kernel<T, IndexerT>>(
+                {nelems}, Impl(inputs, dst_tp, prog, indexer));
+        }
+    });
+
+    return comp_ev;
+}
+
+template <typename fnT, typename T> struct FusedElementwiseFactory
+{
+    fnT get()
+    {
+        if constexpr (!FusedOutputType<T>::is_defined) {
+            fnT fn = nullptr;
+            return fn;
+        }
+        else {
+            fnT fn = fused_elementwise_impl<T>;
+            return fn;
+        }
+    }
+};
+
+} // namespace fused
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
@@ -0,0 +1,625 @@
+//=== histogram.hpp - Implementation of histogram kernels   ---*-C++-*--/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels for tensor histogram and bincount operations.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <sycl/sycl.hpp>
+#include <type_traits>
+#include <vector>
+
+#include "dpctl_tensor_types.hpp"
+#include "utils/sycl_alloc_utils.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+namespace histogram
+{
+
+using dpctl::tensor::ssize_t;
+
+/*! @brief Maps non-negative integer `v` to bin `v` */
+template <typename T> struct BincountBinner
+{
+    std::size_t nbins;
+
+    bool operator()(const T &v, std::size_t &bin) const
+    {
+        if constexpr (std::is_signed_v<T>) {
+            if (v < T(0)) {
+                return false;
+            }
+        }
+        const std::size_t b = static_cast<std::size_t>(v);
+        if (b >= nbins) {
+            return false;
+        }
+        bin = b;
+        return true;
+    }
+};
+
+/*! @brief Maps `v` to bin `i` such that `edges[i] <= v < edges[i + 1]`,
+ *  the last bin also includes its right edge. Edges must be sorted in
+ *  ascending order, values outside of the edges and NaNs are ignored. */
+template <typename T> struct EdgesBinner
+{
+    const T *edges;
+    std::size_t nbins;
+
+    bool operator()(const T &v, std::size_t &bin) const
+    {
+        if (!(v >= edges[0] && v <= edges[nbins])) {
+            return false;
+        }
+        // invariant: edges[lo] <= v < edges[hi]
+        std::size_t lo = 0;
+        std::size_t hi = nbins;
+        if (v == edges[nbins]) {
+            bin = nbins - 1;
+            return true;
+        }
+        while (hi - lo > 1) {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            if (edges[mid] <= v) {
+                lo = mid;
+            }
+            else {
+                hi = mid;
+            }
+        }
+        bin = lo;
+        return true;
+    }
+};
+
+/*! @brief Maps `v` to a bin of equally spaced edges, computing the bin
+ *  directly, and correcting for round-off by comparing with its edges */
+template <typename T> struct UniformBinner
+{
+    const T *edges;
+    std::size_t nbins;
+    // number of bins per unit of length
+    T norm;
+
+    bool operator()(const T &v, std::size_t &bin) const
+    {
+        const T first = edges[0];
+        const T last = edges[nbins];
+        if (!(v >= first && v <= last)) {
+            return false;
+        }
+        std::size_t b = static_cast<std::size_t>((v - first) * norm);
+        b = std::min(b, nbins - 1);
+        if (v < edges[b]) {
+            --b;
+        }
+        else if (b + 1 < nbins && v >= edges[b + 1]) {
+            ++b;
+        }
+        bin = b;
+        return true;
+    }
+};
+
+/*! @brief Accumulates weights of elements into bins privatized in local
+ *  memory of the work-group, then merges them into the result.
+ *
+ *  If `merge_with_atomics` is true, bins are added to `out` using atomic
+ *  operations, otherwise each work-group stores its bins into its row of
+ *  `out`, to be summed by a separate kernel.
+ */
+template <typename xT,
+          typename resT,
+          typename BinnerT,
+          typename LocalAccessorT,
+          bool merge_with_atomics>
+class PrivatizedHistogramFunctor
+{
+private:
+    const xT *x_ = nullptr;
+    ssize_t x_stride_ = 1;
+    const resT *w_ = nullptr;
+    ssize_t w_stride_ = 1;
+    std::size_t n_ = 0;
+    BinnerT binner_;
+    LocalAccessorT local_bins_;
+    std::size_t nbins_ = 0;
+    resT *out_ = nullptr;
+
+public:
+    PrivatizedHistogramFunctor(const xT *x,
+                               ssize_t x_stride,
+                               const resT *w,
+                               ssize_t w_stride,
+                               std::size_t n,
+                               const BinnerT &binner,
+                               const LocalAccessorT &local_bins,
+                               std::size_t nbins,
+                               resT *out)
+        : x_(x), x_stride_(x_stride), w_(w), w_stride_(w_stride), n_(n),
+          binner_(binner), local_bins_(local_bins), nbins_(nbins), out_(out)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        const std::size_t lid = it.get_local_id(0);
+        const std::size_t lws = it.get_local_range(0);
+        auto wg = it.get_group();
+
+        for (std::size_t b = lid; b < nbins_; b += lws) {
+            local_bins_[b] = resT(0);
+        }
+        sycl::group_barrier(wg);
+
+        const std::size_t gws = it.get_global_range(0);
+        for (std::size_t i = it.get_global_id(0); i < n_; i += gws) {
+            std::size_t bin = 0;
+            const ssize_t x_offset = static_cast<ssize_t>(i) * x_stride_;
+            if (binner_(x_[x_offset], bin)) {
+                const resT w = (w_ == nullptr)
+                                   ? resT(1)
+                                   : w_[static_cast<ssize_t>(i) * w_stride_];
+                sycl::atomic_ref<resT, sycl::memory_order::relaxed,
+                                 sycl::memory_scope::work_group,
+                                 sycl::access::address_space::local_space>
+                    bin_ref(local_bins_[bin]);
+                bin_ref += w;
+            }
+        }
+        sycl::group_barrier(wg);
+
+        if constexpr (merge_with_atomics) {
+            for (std::size_t b = lid; b < nbins_; b += lws) {
+                const resT v = local_bins_[b];
+                if (v != resT(0)) {
+                    sycl::atomic_ref<resT, sycl::memory_order::relaxed,
+                                     sycl::memory_scope::device,
+                                     sycl::access::address_space::global_space>
+                        res_ref(out_[b]);
+                    res_ref += v;
+                }
+            }
+        }
+        else {
+            resT *partial_bins = out_ + it.get_group_linear_id() * nbins_;
+            for (std::size_t b = lid; b < nbins_; b += lws) {
+                partial_bins[b] = local_bins_[b];
+            }
+        }
+    }
+};
+
+/*! @brief Accumulates weights of elements directly into bins in global
+ *  memory, used when bins do not fit into local memory */
+template <typename xT, typename resT, typename BinnerT>
+class GlobalAtomicHistogramFunctor
+{
+private:
+    const xT *x_ = nullptr;
+    ssize_t x_stride_ = 1;
+    const resT *w_ = nullptr;
+    ssize_t w_stride_ = 1;
+    std::size_t n_ = 0;
+    BinnerT binner_;
+    resT *out_ = nullptr;
+
+public:
+    GlobalAtomicHistogramFunctor(const xT *x,
+                                 ssize_t x_stride,
+                                 const resT *w,
+                                 ssize_t w_stride,
+                                 std::size_t n,
+                                 const BinnerT &binner,
+                                 resT *out)
+        : x_(x), x_stride_(x_stride), w_(w), w_stride_(w_stride), n_(n),
+          binner_(binner), out_(out)
+    {
+    }
+
+    void operator()(sycl::id<1> id) const
+    {
+        const std::size_t i = id[0];
+        if (i >= n_) {
+            return;
+        }
+        std::size_t bin = 0;
+        if (binner_(x_[static_cast<ssize_t>(i) * x_stride_], bin)) {
+            const resT w = (w_ == nullptr)
+                               ? resT(1)
+                               : w_[static_cast<ssize_t>(i) * w_stride_];
+            sycl::atomic_ref<resT, sycl::memory_order::relaxed,
+                             sycl::memory_scope::device,
+                             sycl::access::address_space::global_space>
+                res_ref(out_[bin]);
+            res_ref += w;
+        }
+    }
+};
+
+template <typename xT,
+          typename resT,
+          typename BinnerT,
+          bool merge_with_atomics>
+class histogram_privatized_krn;
+
+template <typename xT, typename resT, typename BinnerT>
+class histogram_global_atomic_krn;
+
+template <typename resT> class histogram_merge_partials_krn;
+
+template <typename countT, typename resT> class histogram_widen_counts_krn;
+
+template <typename xT, typename resT, typename BinnerT>
+sycl::event narrow_count_histogram_impl(sycl::queue &exec_q,
+                                        std::size_t n,
+                                        const xT *x,
+                                        ssize_t x_stride,
+                                        const BinnerT &binner,
+                                        std::size_t nbins,
+                                        resT *out,
+                                        const std::vector<sycl::event> &);
+
+/*! @brief Returns true if `nbins` bins of type `resT` fit into local memory
+ *  of the device, leaving room for use by the runtime */
+template <typename resT>
+bool histogram_bins_fit_local_memory(const sycl::device &dev,
+                                     std::size_t nbins)
+{
+    const std::size_t local_mem_size =
+        dev.get_info<sycl::info::device::local_mem_size>();
+    return nbins * sizeof(resT) <= local_mem_size / 2;
+}
+
+/*! @brief Sums `n_partials` rows of `nbins` partial bins into `out` */
+template <typename resT>
+sycl::event merge_partial_bins(sycl::queue &exec_q,
+                               std::size_t n_partials,
+                               std::size_t nbins,
+                               const resT *partials,
+                               resT *out,
+                               const std::vector<sycl::event> &depends)
+{
+    return exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        using KernelName = histogram_merge_partials_krn<resT>;
+        cgh.parallel_for<KernelName>(
+            sycl::range<1>(nbins), [=](sycl::id<1> id) {
+                const std::size_t b = id[0];
+                resT acc(0);
+                for (std::size_t p = 0; p < n_partials; ++p) {
+                    acc += partials[p * nbins + b];
+                }
+                out[b] = acc;
+            });
+    });
+}
+
+/*!
+ * @brief Computes histogram of `n` elements of strided vector `x`,
+ * weighted by elements of strided vector `w` if `w` is not null, into
+ * contiguous vector `out` with `nbins` elements.
+ *
+ * Bins are privatized in local memory of each work-group when they fit
+ * there. Privatized bins are merged into `out` with atomic operations if
+ * `out_supports_atomics` is true, and summed by a separate kernel
+ * otherwise. Bins which do not fit into local memory are updated in
+ * global memory atomically, using a temporary allocation if `out` does not
+ * support atomics.
+ *
+ * Unweighted 64-bit counts are accumulated with 32-bit counters on devices
+ * without support of 64-bit atomic operations.
+ */
+template <typename xT, typename resT, typename BinnerT>
+sycl::event histogram_impl(sycl::queue &exec_q,
+                           std::size_t n,
+                           const xT *x,
+                           ssize_t x_stride,
+                           const resT *w,
+                           ssize_t w_stride,
+                           const BinnerT &binner,
+                           std::size_t nbins,
+                           resT *out,
+                           bool out_supports_atomics,
+                           const std::vector<sycl::event> &depends)
+{
+    if (n == 0) {
+        return exec_q.fill<resT>(out, resT(0), nbins, depends);
+    }
+
+    const sycl::device &dev = exec_q.get_device();
+
+    if constexpr (std::is_integral_v<resT> && sizeof(resT) == 8) {
+        if (w == nullptr && !dev.has(sycl::aspect::atomic64)) {
+            return narrow_count_histogram_impl<xT, resT, BinnerT>(
+                exec_q, n, x, x_stride, binner, nbins, out, depends);
+        }
+    }
+
+    if (histogram_bins_fit_local_memory<resT>(dev, nbins)) {
+        const std::size_t max_wg_size =
+            dev.get_info<sycl::info::device::max_work_group_size>();
+        const std::size_t wg_size = std::min<std::size_t>(max_wg_size, 256);
+        const std::size_t n_cus =
+            dev.get_info<sycl::info::device::max_compute_units>();
+
+        // each work-group processes several elements per work-item to
+        // amortize initialization and merging of its bins
+        static constexpr std::size_t elems_per_wi = 16;
+        const std::size_t elems_per_wg = wg_size * elems_per_wi;
+        std::size_t n_groups = (n + elems_per_wg - 1) / elems_per_wg;
+        n_groups = std::min(n_groups, std::max<std::size_t>(1, 4 * n_cus));
+
+        const sycl::nd_range<1> ndRange{sycl::range<1>(n_groups * wg_size),
+                                        sycl::range<1>(wg_size)};
+
+        using LocalAccessorT = sycl::local_accessor<resT, 1>;
+
+        if (out_supports_atomics) {
+            sycl::event fill_ev =
+                exec_q.fill<resT>(out, resT(0), nbins, depends);
+
+            return exec_q.submit([&](sycl::handler &cgh) {
+                cgh.depends_on(fill_ev);
+
+                LocalAccessorT local_bins(sycl::range<1>(nbins), cgh);
+
+                using KernelName =
+                    histogram_privatized_krn<xT, resT, BinnerT, true>;
+                using Impl =
+                    PrivatizedHistogramFunctor<xT, resT, BinnerT,
+                                               LocalAccessorT, true>;
+
+                cgh.parallel_for<KernelName>(
+                    ndRange, Impl(x, x_stride, w, w_stride, n, binner,
+                                  local_bins, nbins, out));
+            });
+        }
+
+        // tree merge: each work-group writes out its bins, which are then
+        // summed by a separate kernel
+        auto partials_owner =
+            dpctl::tensor::alloc_utils::smart_malloc_device<resT>(
+                n_groups * nbins, exec_q);
+        resT *partials = partials_owner.get();
+
+        sycl::event partials_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(depends);
+
+            LocalAccessorT local_bins(sycl::range<1>(nbins), cgh);
+
+            using KernelName =
+                histogram_privatized_krn<xT, resT, BinnerT, false>;
+            using Impl = PrivatizedHistogramFunctor<xT, resT, BinnerT,
+                                                    LocalAccessorT, false>;
+
+            cgh.parallel_for<KernelName>(
+                ndRange, Impl(x, x_stride, w, w_stride, n, binner, local_bins,
+                              nbins, partials));
+        });
+
+        sycl::event merge_ev = merge_partial_bins<resT>(
+            exec_q, n_groups, nbins, partials, out, {partials_ev});
+
+        return dpctl::tensor::alloc_utils::async_smart_free(
+            exec_q, {merge_ev}, partials_owner);
+    }
+
+    using KernelName = histogram_global_atomic_krn<xT, resT, BinnerT>;
+    using Impl = GlobalAtomicHistogramFunctor<xT, resT, BinnerT>;
+
+    if (out_supports_atomics) {
+        sycl::event fill_ev = exec_q.fill<resT>(out, resT(0), nbins, depends);
+
+        return exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(fill_ev);
+            cgh.parallel_for<KernelName>(
+                sycl::range<1>(n),
+                Impl(x, x_stride, w, w_stride, n, binner, out));
+        });
+    }
+
+    // atomic operations on USM device allocations are always supported
+    auto tmp_owner =
+        dpctl::tensor::alloc_utils::smart_malloc_device<resT>(nbins, exec_q);
+    resT *tmp = tmp_owner.get();
+
+    sycl::event fill_ev = exec_q.fill<resT>(tmp, resT(0), nbins, depends);
+    sycl::event hist_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(fill_ev);
+        cgh.parallel_for<KernelName>(
+            sycl::range<1>(n), Impl(x, x_stride, w, w_stride, n, binner, tmp));
+    });
+    sycl::event copy_ev = exec_q.copy<resT>(tmp, out, nbins, {hist_ev});
+
+    return dpctl::tensor::alloc_utils::async_smart_free(exec_q, {copy_ev},
+                                                        tmp_owner);
+}
+
+/*!
+ * @brief Counts `n` elements of strided vector `x` into contiguous vector
+ * `out` with `nbins` elements using 32-bit counters.
+ *
+ * Elements are processed in chunks small enough for 32-bit counts not to
+ * overflow, counts of each chunk are added to `out`. Used on devices without
+ * support of 64-bit atomic operations.
+ */
+template <typename xT, typename resT, typename BinnerT>
+sycl::event narrow_count_histogram_impl(sycl::queue &exec_q,
+                                        std::size_t n,
+                                        const xT *x,
+                                        ssize_t x_stride,
+                                        const BinnerT &binner,
+                                        std::size_t nbins,
+                                        resT *out,
+                                        const std::vector<sycl::event> &depends)
+{
+    using countT = std::uint32_t;
+    static constexpr std::size_t max_chunk_size =
+        std::numeric_limits<countT>::max();
+
+    // atomic operations on USM device allocations are always supported
+    auto counts_owner =
+        dpctl::tensor::alloc_utils::smart_malloc_device<countT>(nbins, exec_q);
+    countT *counts = counts_owner.get();
+
+    std::vector<sycl::event> chunk_deps = depends;
+    sycl::event widen_ev;
+    for (std::size_t chunk_start = 0; chunk_start < n;
+         chunk_start += max_chunk_size)
+    {
+        const std::size_t chunk_size =
+            std::min(max_chunk_size, n - chunk_start);
+        const xT *x_chunk = x + static_cast<ssize_t>(chunk_start) * x_stride;
+        const bool first_chunk = (chunk_start == 0);
+
+        sycl::event count_ev = histogram_impl<xT, countT, BinnerT>(
+            exec_q, chunk_size, x_chunk, x_stride, nullptr, 1, binner, nbins,
+            counts, true, chunk_deps);
+
+        widen_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(count_ev);
+
+            using KernelName = histogram_widen_counts_krn<countT, resT>;
+            cgh.parallel_for<KernelName>(
+                sycl::range<1>(nbins), [=](sycl::id<1> id) {
+                    const std::size_t b = id[0];
+                    const resT c = static_cast<resT>(counts[b]);
+                    out[b] = (first_chunk) ? c : out[b] + c;
+                });
+        });
+        chunk_deps = {widen_ev};
+    }
+
+    return dpctl::tensor::alloc_utils::async_smart_free(exec_q, {widen_ev},
+                                                        counts_owner);
+}
+
+typedef sycl::event (*bincount_fn_ptr_t)(sycl::queue &,
+                                         std::size_t,
+                                         const char *,
+                                         ssize_t,
+                                         const char *,
+                                         ssize_t,
+                                         std::size_t,
+                                         char *,
+                                         bool,
+                                         const std::vector<sycl::event> &);
+
+/*! @brief Counts occurrences of each non-negative integer in `x`, weighted
+ *  by `w` if it is not null, into `nbins` bins of `out` */
+template <typename xT, typename resT>
+sycl::event bincount_impl(sycl::queue &exec_q,
+                          std::size_t n,
+                          const char *x_p,
+                          ssize_t x_stride,
+                          const char *w_p,
+                          ssize_t w_stride,
+                          std::size_t nbins,
+                          char *out_p,
+                          bool out_supports_atomics,
+                          const std::vector<sycl::event> &depends)
+{
+    const xT *x = reinterpret_cast<const xT *>(x_p);
+    const resT *w = reinterpret_cast<const resT *>(w_p);
+    resT *out = reinterpret_cast<resT *>(out_p);
+
+    using BinnerT = BincountBinner<xT>;
+    const BinnerT binner{nbins};
+
+    return histogram_impl<xT, resT, BinnerT>(exec_q, n, x, x_stride, w,
+                                             w_stride, binner, nbins, out,
+                                             out_supports_atomics, depends);
+}
+
+typedef sycl::event (*histogram_fn_ptr_t)(sycl::queue &,
+                                          std::size_t,
+                                          const char *,
+                                          ssize_t,
+                                          const char *,
+                                          ssize_t,
+                                          const char *,
+                                          std::size_t,
+                                          bool,
+                                          double,
+                                          char *,
+                                          bool,
+                                          const std::vector<sycl::event> &);
+
+/*! @brief Computes histogram of `x`, weighted by `w` if it is not null,
+ *  over `nbins` bins delimited by `nbins + 1` sorted `edges`.
+ *
+ *  If `uniform` is true, edges are equally spaced and `norm` is the number
+ *  of bins per unit of length, used to compute bins without searching.
+ */
+template <typename xT, typename resT>
+sycl::event histogram_by_edges_impl(sycl::queue &exec_q,
+                                    std::size_t n,
+                                    const char *x_p,
+                                    ssize_t x_stride,
+                                    const char *w_p,
+                                    ssize_t w_stride,
+                                    const char *edges_p,
+                                    std::size_t nbins,
+                                    bool uniform,
+                                    double norm,
+                                    char *out_p,
+                                    bool out_supports_atomics,
+                                    const std::vector<sycl::event> &depends)
+{
+    const xT *x = reinterpret_cast<const xT *>(x_p);
+    const resT *w = reinterpret_cast<const resT *>(w_p);
+    const xT *edges = reinterpret_cast<const xT *>(edges_p);
+    resT *out = reinterpret_cast<resT *>(out_p);
+
+    if (uniform) {
+        using BinnerT = UniformBinner<xT>;
+        const BinnerT binner{edges, nbins, static_cast<xT>(norm)};
+
+        return histogram_impl<xT, resT, BinnerT>(
+            exec_q, n, x, x_stride, w, w_stride, binner, nbins, out,
+            out_supports_atomics, depends);
+    }
+    else {
+        using BinnerT = EdgesBinner<xT>;
+        const BinnerT binner{edges, nbins};
+
+        return histogram_impl<xT, resT, BinnerT>(
+            exec_q, n, x, x_stride, w, w_stride, binner, nbins, out,
+            out_supports_atomics, depends);
+    }
+}
+
+} // namespace histogram
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
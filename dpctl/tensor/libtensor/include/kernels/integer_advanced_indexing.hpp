@@ -27,12 +27,14 @@
 #include <complex>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <sycl/sycl.hpp>
 #include <type_traits>
 
 #include "dpctl_tensor_types.hpp"
 #include "utils/indexing_utils.hpp"
 #include "utils/offset_utils.hpp"
+#include "utils/sycl_utils.hpp"
 #include "utils/type_utils.hpp"
 
 namespace dpctl
@@ -192,12 +194,106 @@ sycl::event take_impl(sycl::queue &q,
     return take_ev;
 }
 
+/*! @brief Overwrites the destination element with the value */
+template <typename T> struct PutAssign
+{
+    void operator()(T &dst, const T &val) const { dst = val; }
+};
+
+namespace detail
+{
+
+template <typename T>
+using put_atomic_ref_t =
+    sycl::atomic_ref<T,
+                     sycl::memory_order::relaxed,
+                     sycl::memory_scope::device,
+                     sycl::access::address_space::global_space>;
+
+/*! @brief Atomically replaces `dst` with `op(dst, val)` */
+template <typename T, typename BinOpT>
+void put_atomic_update(T &dst, const T &val, const BinOpT &op)
+{
+    put_atomic_ref_t<T> dst_ref(dst);
+    T expected = dst_ref.load();
+    while (!dst_ref.compare_exchange_weak(expected, op(expected, val))) {
+    }
+}
+
+} // namespace detail
+
+/*! @brief Atomically adds the value to the destination element */
+template <typename T> struct PutAtomicAdd
+{
+    void operator()(T &dst, const T &val) const
+    {
+        detail::put_atomic_ref_t<T> dst_ref(dst);
+        dst_ref += val;
+    }
+};
+
+/*! @brief Atomically multiplies the destination element by the value */
+template <typename T> struct PutAtomicMultiply
+{
+    void operator()(T &dst, const T &val) const
+    {
+        detail::put_atomic_update(dst, val, std::multiplies<T>{});
+    }
+};
+
+/*! @brief Atomically replaces the destination element with its maximum
+ *  with the value, propagating NaNs */
+template <typename T> struct PutAtomicMax
+{
+    void operator()(T &dst, const T &val) const
+    {
+        if constexpr (std::is_integral_v<T>) {
+            detail::put_atomic_ref_t<T> dst_ref(dst);
+            dst_ref.fetch_max(val);
+        }
+        else {
+            using dpctl::tensor::sycl_utils::Maximum;
+            detail::put_atomic_update(dst, val, Maximum<T>{});
+        }
+    }
+};
+
+/*! @brief Atomically replaces the destination element with its minimum
+ *  with the value, propagating NaNs */
+template <typename T> struct PutAtomicMin
+{
+    void operator()(T &dst, const T &val) const
+    {
+        if constexpr (std::is_integral_v<T>) {
+            detail::put_atomic_ref_t<T> dst_ref(dst);
+            dst_ref.fetch_min(val);
+        }
+        else {
+            using dpctl::tensor::sycl_utils::Minimum;
+            detail::put_atomic_update(dst, val, Minimum<T>{});
+        }
+    }
+};
+
+/*! @brief Types supported by atomic put with reduction */
+template <typename T> struct PutAtomicUpdateTypeSupport
+{
+    static constexpr bool is_defined =
+        std::disjunction<std::is_same<T, std::int32_t>,
+                         std::is_same<T, std::uint32_t>,
+                         std::is_same<T, std::int64_t>,
+                         std::is_same<T, std::uint64_t>,
+                         std::is_same<T, float>,
+                         std::is_same<T, double>>::value;
+};
+
 template <typename ProjectorT,
           typename OrthogIndexer,
           typename IndicesIndexer,
           typename AxesIndexer,
           typename T,
-          typename indT>
+          typename indT,
+          typename UpdaterT = PutAssign<T>>
 class PutFunctor
 {
 private:
@@ -257,7 +353,8 @@ public:
 
         val_offset += axes_strider(i_along);
 
-        dst[dst_offset] = val[val_offset];
+        static constexpr UpdaterT updater{};
+        updater(dst[dst_offset], val[val_offset]);
     }
 };
 
@@ -266,7 +363,8 @@ template <typename ProjectorT,
           typename IndicesIndexer,
           typename AxesIndexer,
           typename T,
-          typename indT>
+          typename indT,
+          typename UpdaterT>
 class put_kernel;
 
 typedef sycl::event (*put_fn_ptr_t)(sycl::queue &,
@@ -286,7 +384,10 @@ typedef sycl::event (*put_fn_ptr_t)(sycl::queue &,
                                     const ssize_t *,
                                     const std::vector<sycl::event> &);
 
-template <typename ProjectorT, typename Ty, typename indT>
+template <typename ProjectorT,
+          typename Ty,
+          typename indT,
+          typename UpdaterT = PutAssign<Ty>>
 sycl::event put_impl(sycl::queue &q,
                      std::size_t orthog_nelems,
                      std::size_t ind_nelems,
@@ -324,14 +425,14 @@ sycl::event put_impl(sycl::queue &q,
 
         using KernelName =
             put_kernel<ProjectorT, OrthogIndexerT, NthStrideIndexerT,
-                       AxesIndexerT, Ty, indT>;
+                       AxesIndexerT, Ty, indT, UpdaterT>;
 
         const std::size_t gws = orthog_nelems * ind_nelems;
 
         cgh.parallel_for<KernelName>(
             sycl::range<1>(gws),
             PutFunctor<ProjectorT, OrthogIndexerT, NthStrideIndexerT,
-                       AxesIndexerT, Ty, indT>(
+                       AxesIndexerT, Ty, indT, UpdaterT>(
                 dst_p, val_p, ind_p, k, ind_nelems, axes_shape_and_strides,
                 orthog_indexer, indices_indexer, axes_indexer));
     });
@@ -411,6 +512,111 @@ template <typename fnT, typename T, typename indT> struct PutClipFactory
     }
 };
 
+template <typename fnT,
+          typename T,
+          typename indT,
+          template <typename>
+          class ProjectorT,
+          template <typename>
+          class UpdaterT>
+struct PutAtomicUpdateFactory
+{
+    fnT get()
+    {
+        if constexpr (std::is_integral<indT>::value &&
+                      !std::is_same<indT, bool>::value &&
+                      PutAtomicUpdateTypeSupport<T>::is_defined)
+        {
+            fnT fn = put_impl<ProjectorT<indT>, T, indT, UpdaterT<T>>;
+            return fn;
+        }
+        else {
+            fnT fn = nullptr;
+            return fn;
+        }
+    }
+};
+
+template <typename fnT, typename T, typename indT>
+struct PutAddWrapFactory
+    : public PutAtomicUpdateFactory<fnT,
+                                    T,
+                                    indT,
+                                    dpctl::tensor::indexing_utils::WrapIndex,
+                                    PutAtomicAdd>
+{
+};
+
+template <typename fnT, typename T, typename indT>
+struct PutAddClipFactory
+    : public PutAtomicUpdateFactory<fnT,
+                                    T,
+                                    indT,
+                                    dpctl::tensor::indexing_utils::ClipIndex,
+                                    PutAtomicAdd>
+{
+};
+
+template <typename fnT, typename T, typename indT>
+struct PutMultiplyWrapFactory
+    : public PutAtomicUpdateFactory<fnT,
+                                    T,
+                                    indT,
+                                    dpctl::tensor::indexing_utils::WrapIndex,
+                                    PutAtomicMultiply>
+{
+};
+
+template <typename fnT, typename T, typename indT>
+struct PutMultiplyClipFactory
+    : public PutAtomicUpdateFactory<fnT,
+                                    T,
+                                    indT,
+                                    dpctl::tensor::indexing_utils::ClipIndex,
+                                    PutAtomicMultiply>
+{
+};
+
+template <typename fnT, typename T, typename indT>
+struct PutMaxWrapFactory
+    : public PutAtomicUpdateFactory<fnT,
+                                    T,
+                                    indT,
+                                    dpctl::tensor::indexing_utils::WrapIndex,
+                                    PutAtomicMax>
+{
+};
+
+template <typename fnT, typename T, typename indT>
+struct PutMaxClipFactory
+    : public PutAtomicUpdateFactory<fnT,
+                                    T,
+                                    indT,
+                                    dpctl::tensor::indexing_utils::ClipIndex,
+                                    PutAtomicMax>
+{
+};
+
+template <typename fnT, typename T, typename indT>
+struct PutMinWrapFactory
+    : public PutAtomicUpdateFactory<fnT,
+                                    T,
+                                    indT,
+                                    dpctl::tensor::indexing_utils::WrapIndex,
+                                    PutAtomicMin>
+{
+};
+
+template <typename fnT, typename T, typename indT>
+struct PutMinClipFactory
+    : public PutAtomicUpdateFactory<fnT,
+                                    T,
+                                    indT,
+                                    dpctl::tensor::indexing_utils::ClipIndex,
+                                    PutAtomicMin>
+{
+};
+
 } // namespace indexing
 } // namespace kernels
 } // namespace tensor
@@ -35,6 +35,7 @@
 
 #include "kernels/dpctl_tensor_types.hpp"
 #include "kernels/reductions.hpp"
+#include "utils/kernel_launch_cache.hpp"
 #include "utils/offset_utils.hpp"
 #include "utils/sycl_alloc_utils.hpp"
 #include "utils/sycl_utils.hpp"
@@ -1300,20 +1301,12 @@ sycl::event _gemm_batch_nm_impl(sycl::queue &exec_q,
                                      LhsIndexerT, RhsIndexerT, ResIndexerT,
                                      wi_delta_n, wi_delta_m_vecs, m_vec_size>;
 
-    const auto &kernel_id = sycl::get_kernel_id<KernelName>();
+    using dpctl::tensor::sycl_utils::get_kernel_launch_info;
+    const auto &launch_info = get_kernel_launch_info<KernelName>(exec_q);
+    const auto &kb = launch_info.bundle;
 
-    auto const &ctx = exec_q.get_context();
-    auto const &dev = exec_q.get_device();
-    auto kb = sycl::get_kernel_bundle<sycl::bundle_state::executable>(
-        ctx, {dev}, {kernel_id});
-
-    auto krn = kb.get_kernel(kernel_id);
-
-    const std::uint32_t max_sg_size = krn.template get_info<
-        sycl::info::kernel_device_specific::max_sub_group_size>(dev);
-
-    const std::size_t k_wg_sz = krn.template get_info<
-        sycl::info::kernel_device_specific::work_group_size>(dev);
+    const std::uint32_t max_sg_size = launch_info.max_sub_group_size;
+    const std::size_t k_wg_sz = launch_info.max_work_group_size;
 
     // Limit work-group size
     static constexpr std::size_t wg_sz_limit(2048);
@@ -1323,8 +1316,7 @@ sycl::event _gemm_batch_nm_impl(sycl::queue &exec_q,
         static_cast<std::uint32_t>(max_wg_sz / max_sg_size);
 
     const std::size_t reserved_slm_byte_size = 512;
-    const std::size_t slm_byte_size =
-        dev.get_info<sycl::info::device::local_mem_size>();
+    const std::size_t slm_byte_size = launch_info.local_mem_size;
 
     const std::uint32_t wg_delta_n = max_sg_size;
     std::uint32_t wg_delta_m = 0;
@@ -0,0 +1,572 @@
+//===  gemm_tiled.hpp - Implementation of tiled GEMM kernels --*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===---------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels for general matrix multiplication (GEMM) of
+/// batches of matrices, which stage tiles of operands in local memory and
+/// accumulate blocks of the result in private memory of work-items. Tile
+/// sizes are selected at run-time from a fixed set of configurations.
+//===---------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <sycl/sycl.hpp>
+#include <type_traits>
+#include <vector>
+
+#include "kernels/dpctl_tensor_types.hpp"
+#include "utils/type_utils.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+
+/*! @brief Sizes of tiles processed by the tiled GEMM kernel.
+ *
+ * Work-group of `wg_rows * wg_cols` work-items computes a tile of
+ * `wg_rows * wi_rows` rows and `wg_cols * wi_cols` columns of the result,
+ * iterating over the inner dimension in steps of `k_tile` elements. Each
+ * work-item accumulates `wi_rows * wi_cols` elements of the result in
+ * private memory.
+ */
+template <std::uint32_t wg_rows_,
+          std::uint32_t wg_cols_,
+          std::uint32_t wi_rows_,
+          std::uint32_t wi_cols_,
+          std::uint32_t k_tile_>
+struct GemmTileConfig
+{
+    static constexpr std::uint32_t wg_rows = wg_rows_;
+    static constexpr std::uint32_t wg_cols = wg_cols_;
+    static constexpr std::uint32_t wi_rows = wi_rows_;
+    static constexpr std::uint32_t wi_cols = wi_cols_;
+    static constexpr std::uint32_t k_tile = k_tile_;
+
+    static constexpr std::uint32_t wg_size = wg_rows * wg_cols;
+    static constexpr std::uint32_t tile_rows = wg_rows * wi_rows;
+    static constexpr std::uint32_t tile_cols = wg_cols * wi_cols;
+};
+
+namespace gemm_detail
+{
+
+// configurations available to tiled GEMM, identified by their position
+using GemmTileConfig0 = GemmTileConfig<8, 8, 4, 4, 16>;
+using GemmTileConfig1 = GemmTileConfig<16, 16, 4, 4, 16>;
+using GemmTileConfig2 = GemmTileConfig<8, 16, 8, 4, 8>;
+using GemmTileConfig3 = GemmTileConfig<16, 8, 2, 2, 32>;
+using GemmTileConfig4 = GemmTileConfig<4, 8, 8, 8, 16>;
+
+} // namespace gemm_detail
+
+static constexpr int gemm_tiled_num_configs = 5;
+
+/*! @brief Whether tile configuration `config_id` can be used on device `dev`
+ *         to multiply matrices with elements of `res_elem_size` bytes */
+inline bool gemm_tiled_config_is_supported(const sycl::device &dev,
+                                           int config_id,
+                                           std::size_t res_elem_size)
+{
+    auto fits = [&dev, res_elem_size](std::uint32_t wg_size,
+                                      std::uint32_t tile_rows,
+                                      std::uint32_t tile_cols,
+                                      std::uint32_t k_tile) {
+        const std::size_t max_wg_size =
+            dev.get_info<sycl::info::device::max_work_group_size>();
+        const std::size_t slm_size =
+            dev.get_info<sycl::info::device::local_mem_size>();
+        const std::size_t slm_needed =
+            (static_cast<std::size_t>(tile_rows) + tile_cols) * k_tile *
+            res_elem_size;
+        return (wg_size <= max_wg_size) && (slm_needed <= slm_size);
+    };
+
+    using namespace gemm_detail;
+    switch (config_id) {
+    case 0:
+        return fits(GemmTileConfig0::wg_size, GemmTileConfig0::tile_rows,
+                    GemmTileConfig0::tile_cols, GemmTileConfig0::k_tile);
+    case 1:
+        return fits(GemmTileConfig1::wg_size, GemmTileConfig1::tile_rows,
+                    GemmTileConfig1::tile_cols, GemmTileConfig1::k_tile);
+    case 2:
+        return fits(GemmTileConfig2::wg_size, GemmTileConfig2::tile_rows,
+                    GemmTileConfig2::tile_cols, GemmTileConfig2::k_tile);
+    case 3:
+        return fits(GemmTileConfig3::wg_size, GemmTileConfig3::tile_rows,
+                    GemmTileConfig3::tile_cols, GemmTileConfig3::k_tile);
+    case 4:
+        return fits(GemmTileConfig4::wg_size, GemmTileConfig4::tile_rows,
+                    GemmTileConfig4::tile_cols, GemmTileConfig4::k_tile);
+    default:
+        return false;
+    }
+}
+
+/*! @brief Offset of element `(i, j)` of matrix `batch_id` in a batch of
+ *         C-contiguous matrices of shape `(rows, cols)` stored one after
+ *         another */
+struct GemmContigMatrixIndexer
+{
+    std::size_t rows = 0;
+    std::size_t cols = 0;
+
+    ssize_t
+    operator()(std::size_t batch_id, std::size_t i, std::size_t j) const
+    {
+        return static_cast<ssize_t>((batch_id * rows + i) * cols + j);
+    }
+
+    /*! @brief Whether elements of a row are closer in memory than
+     *         elements of a column */
+    bool row_major() const { return true; }
+};
+
+/*! @brief Offset of element `(i, j)` of matrix `batch_id` in a batch of
+ *         matrices with arbitrary batch, row and column strides */
+struct GemmStridedMatrixIndexer
+{
+    ssize_t batch_stride = 0;
+    ssize_t row_stride = 0;
+    ssize_t col_stride = 0;
+
+    ssize_t
+    operator()(std::size_t batch_id, std::size_t i, std::size_t j) const
+    {
+        return static_cast<ssize_t>(batch_id) * batch_stride +
+               static_cast<ssize_t>(i) * row_stride +
+               static_cast<ssize_t>(j) * col_stride;
+    }
+
+    /*! @brief Whether elements of a row are closer in memory than
+     *         elements of a column */
+    bool row_major() const
+    {
+        const ssize_t abs_row_st = (row_stride < 0) ? -row_stride : row_stride;
+        const ssize_t abs_col_st = (col_stride < 0) ? -col_stride : col_stride;
+        return abs_col_st <= abs_row_st;
+    }
+};
+
+template <typename lhsT,
+          typename rhsT,
+          typename resT,
+          typename LocAccT,
+          typename ConfigT,
+          typename MatrixIndexerT>
+class GemmBatchTiledFunctor
+{
+private:
+    const lhsT *lhs = nullptr;
+    const rhsT *rhs = nullptr;
+    resT *res = nullptr;
+    LocAccT lhs_tile;
+    LocAccT rhs_tile;
+    std::size_t n = 0;
+    std::size_t k = 0;
+    std::size_t m = 0;
+    std::size_t n_row_tiles = 0;
+    std::size_t n_col_tiles = 0;
+    MatrixIndexerT lhs_indexer;
+    MatrixIndexerT rhs_indexer;
+    MatrixIndexerT res_indexer;
+
+public:
+    GemmBatchTiledFunctor(const lhsT *lhs_,
+                          const rhsT *rhs_,
+                          resT *res_,
+                          LocAccT lhs_tile_,
+                          LocAccT rhs_tile_,
+                          std::size_t n_,
+                          std::size_t k_,
+                          std::size_t m_,
+                          std::size_t n_row_tiles_,
+                          std::size_t n_col_tiles_,
+                          const MatrixIndexerT &lhs_indexer_,
+                          const MatrixIndexerT &rhs_indexer_,
+                          const MatrixIndexerT &res_indexer_)
+        : lhs(lhs_), rhs(rhs_), res(res_), lhs_tile(lhs_tile_),
+          rhs_tile(rhs_tile_), n(n_), k(k_), m(m_), n_row_tiles(n_row_tiles_),
+          n_col_tiles(n_col_tiles_), lhs_indexer(lhs_indexer_),
+          rhs_indexer(rhs_indexer_), res_indexer(res_indexer_)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        static constexpr std::uint32_t wg_rows = ConfigT::wg_rows;
+        static constexpr std::uint32_t wg_cols = ConfigT::wg_cols;
+        static constexpr std::uint32_t wi_rows = ConfigT::wi_rows;
+        static constexpr std::uint32_t wi_cols = ConfigT::wi_cols;
+        static constexpr std::uint32_t k_tile = ConfigT::k_tile;
+        static constexpr std::uint32_t wg_size = ConfigT::wg_size;
+        static constexpr std::uint32_t tile_rows = ConfigT::tile_rows;
+        static constexpr std::uint32_t tile_cols = ConfigT::tile_cols;
+
+        const std::size_t gr_id = it.get_group_linear_id();
+        const std::size_t tiles_per_batch = n_row_tiles * n_col_tiles;
+        const std::size_t batch_id = gr_id / tiles_per_batch;
+        const std::size_t tile_id = gr_id - batch_id * tiles_per_batch;
+        const std::size_t row0 = (tile_id / n_col_tiles) * tile_rows;
+        const std::size_t col0 = (tile_id % n_col_tiles) * tile_cols;
+
+        const std::uint32_t lid = it.get_local_linear_id();
+        // work-item computes rows li + r * wg_rows and columns
+        // lj + c * wg_cols of the tile, so that neighboring work-items
+        // read neighboring elements of local memory
+        const std::uint32_t li = lid / wg_cols;
+        const std::uint32_t lj = lid - li * wg_cols;
+
+        // neighboring work-items load elements adjacent in global memory,
+        // which for transposed operands are those of the same column
+        const bool lhs_row_major = lhs_indexer.row_major();
+        const bool rhs_row_major = rhs_indexer.row_major();
+
+        using dpctl::tensor::type_utils::convert_impl;
+
+        resT acc[wi_rows][wi_cols];
+#pragma unroll
+        for (std::uint32_t r = 0; r < wi_rows; ++r) {
+#pragma unroll
+            for (std::uint32_t c = 0; c < wi_cols; ++c) {
+                acc[r][c] = resT(0);
+            }
+        }
+
+        for (std::size_t k0 = 0; k0 < k; k0 += k_tile) {
+            for (std::uint32_t idx = lid; idx < tile_rows * k_tile;
+                 idx += wg_size)
+            {
+                std::uint32_t r, kk;
+                if (lhs_row_major) {
+                    r = idx / k_tile;
+                    kk = idx - r * k_tile;
+                }
+                else {
+                    kk = idx / tile_rows;
+                    r = idx - kk * tile_rows;
+                }
+                const std::size_t gi = row0 + r;
+                const std::size_t gk = k0 + kk;
+                lhs_tile[r * k_tile + kk] =
+                    (gi < n && gk < k)
+                        ? convert_impl<resT, lhsT>(
+                              lhs[lhs_indexer(batch_id, gi, gk)])
+                        : resT(0);
+            }
+            for (std::uint32_t idx = lid; idx < k_tile * tile_cols;
+                 idx += wg_size)
+            {
+                std::uint32_t kk, c;
+                if (rhs_row_major) {
+                    kk = idx / tile_cols;
+                    c = idx - kk * tile_cols;
+                }
+                else {
+                    c = idx / k_tile;
+                    kk = idx - c * k_tile;
+                }
+                const std::size_t gk = k0 + kk;
+                const std::size_t gj = col0 + c;
+                rhs_tile[kk * tile_cols + c] =
+                    (gk < k && gj < m)
+                        ? convert_impl<resT, rhsT>(
+                              rhs[rhs_indexer(batch_id, gk, gj)])
+                        : resT(0);
+            }
+            sycl::group_barrier(it.get_group());
+
+#pragma unroll
+            for (std::uint32_t kk = 0; kk < k_tile; ++kk) {
+                resT a[wi_rows];
+                resT b[wi_cols];
+#pragma unroll
+                for (std::uint32_t r = 0; r < wi_rows; ++r) {
+                    a[r] = lhs_tile[(li + r * wg_rows) * k_tile + kk];
+                }
+#pragma unroll
+                for (std::uint32_t c = 0; c < wi_cols; ++c) {
+                    b[c] = rhs_tile[kk * tile_cols + lj + c * wg_cols];
+                }
+#pragma unroll
+                for (std::uint32_t r = 0; r < wi_rows; ++r) {
+#pragma unroll
+                    for (std::uint32_t c = 0; c < wi_cols; ++c) {
+                        acc[r][c] += a[r] * b[c];
+                    }
+                }
+            }
+            sycl::group_barrier(it.get_group());
+        }
+
+#pragma unroll
+        for (std::uint32_t r = 0; r < wi_rows; ++r) {
+            const std::size_t gi = row0 + li + r * wg_rows;
+            if (gi < n) {
+#pragma unroll
+                for (std::uint32_t c = 0; c < wi_cols; ++c) {
+                    const std::size_t gj = col0 + lj + c * wg_cols;
+                    if (gj < m) {
+                        res[res_indexer(batch_id, gi, gj)] = acc[r][c];
+                    }
+                }
+            }
+        }
+    }
+};
+
+template <typename T1,
+          typename T2,
+          typename T3,
+          typename ConfigT,
+          typename MatrixIndexerT>
+class gemm_batch_tiled_krn;
+
+namespace gemm_detail
+{
+
+template <typename lhsTy,
+          typename rhsTy,
+          typename resTy,
+          typename ConfigT,
+          typename MatrixIndexerT>
+sycl::event _gemm_batch_tiled_impl(sycl::queue &exec_q,
+                                   const lhsTy *lhs_tp,
+                                   const rhsTy *rhs_tp,
+                                   resTy *res_tp,
+                                   std::size_t batch_nelems,
+                                   std::size_t n,
+                                   std::size_t k,
+                                   std::size_t m,
+                                   const MatrixIndexerT &lhs_indexer,
+                                   const MatrixIndexerT &rhs_indexer,
+                                   const MatrixIndexerT &res_indexer,
+                                   const std::vector<sycl::event> &depends)
+{
+    const std::size_t n_row_tiles =
+        (n + ConfigT::tile_rows - 1) / ConfigT::tile_rows;
+    const std::size_t n_col_tiles =
+        (m + ConfigT::tile_cols - 1) / ConfigT::tile_cols;
+    const std::size_t n_groups = batch_nelems * n_row_tiles * n_col_tiles;
+
+    sycl::event gemm_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        using LocAccT = sycl::local_accessor<resTy, 1>;
+        LocAccT lhs_tile(ConfigT::tile_rows * ConfigT::k_tile, cgh);
+        LocAccT rhs_tile(ConfigT::k_tile * ConfigT::tile_cols, cgh);
+
+        const sycl::nd_range<1> ndRange{
+            sycl::range<1>(n_groups * ConfigT::wg_size),
+            sycl::range<1>(ConfigT::wg_size)};
+
+        using KernelName =
+            gemm_batch_tiled_krn<lhsTy, rhsTy, resTy, ConfigT, MatrixIndexerT>;
+        using FunctorT = GemmBatchTiledFunctor<lhsTy, rhsTy, resTy, LocAccT,
+                                               ConfigT, MatrixIndexerT>;
+        cgh.parallel_for<KernelName>(
+            ndRange, FunctorT(lhs_tp, rhs_tp, res_tp, lhs_tile, rhs_tile, n,
+                              k, m, n_row_tiles, n_col_tiles, lhs_indexer,
+                              rhs_indexer, res_indexer));
+    });
+
+    return gemm_ev;
+}
+
+template <typename lhsTy,
+          typename rhsTy,
+          typename resTy,
+          typename MatrixIndexerT>
+sycl::event
+_gemm_batch_tiled_dispatch(sycl::queue &exec_q,
+                           const lhsTy *lhs_tp,
+                           const rhsTy *rhs_tp,
+                           resTy *res_tp,
+                           std::size_t batch_nelems,
+                           std::size_t n,
+                           std::size_t k,
+                           std::size_t m,
+                           const MatrixIndexerT &lhs_indexer,
+                           const MatrixIndexerT &rhs_indexer,
+                           const MatrixIndexerT &res_indexer,
+                           int config_id,
+                           const std::vector<sycl::event> &depends)
+{
+    switch (config_id) {
+    case 0:
+        return _gemm_batch_tiled_impl<lhsTy, rhsTy, resTy, GemmTileConfig0>(
+            exec_q, lhs_tp, rhs_tp, res_tp, batch_nelems, n, k, m,
+            lhs_indexer, rhs_indexer, res_indexer, depends);
+    case 1:
+        return _gemm_batch_tiled_impl<lhsTy, rhsTy, resTy, GemmTileConfig1>(
+            exec_q, lhs_tp, rhs_tp, res_tp, batch_nelems, n, k, m,
+            lhs_indexer, rhs_indexer, res_indexer, depends);
+    case 2:
+        return _gemm_batch_tiled_impl<lhsTy, rhsTy, resTy, GemmTileConfig2>(
+            exec_q, lhs_tp, rhs_tp, res_tp, batch_nelems, n, k, m,
+            lhs_indexer, rhs_indexer, res_indexer, depends);
+    case 3:
+        return _gemm_batch_tiled_impl<lhsTy, rhsTy, resTy, GemmTileConfig3>(
+            exec_q, lhs_tp, rhs_tp, res_tp, batch_nelems, n, k, m,
+            lhs_indexer, rhs_indexer, res_indexer, depends);
+    case 4:
+        return _gemm_batch_tiled_impl<lhsTy, rhsTy, resTy, GemmTileConfig4>(
+            exec_q, lhs_tp, rhs_tp, res_tp, batch_nelems, n, k, m,
+            lhs_indexer, rhs_indexer, res_indexer, depends);
+    default:
+        throw std::runtime_error("Invalid tiled GEMM configuration");
+    }
+}
+
+} // namespace gemm_detail
+
+typedef sycl::event (*gemm_batch_contig_tiled_impl_fn_ptr_t)(
+    sycl::queue &,
+    const char *, // lhs
+    const char *, // rhs
+    char *,       // res
+    std::size_t,  // batch nelems
+    std::size_t,  // n
+    std::size_t,  // k
+    std::size_t,  // m
+    ssize_t,      // lhs batch offset
+    ssize_t,      // rhs batch offset
+    ssize_t,      // res batch offset
+    int,          // tile configuration
+    std::vector<sycl::event> const &);
+
+/*!
+ * @brief Multiplies `batch_nelems` pairs of C-contiguous matrices of shapes
+ * `(n, k)` and `(k, m)`, stored one after another, using tile configuration
+ * `config_id`, and writes results into consecutive C-contiguous matrices.
+ */
+template <typename lhsTy, typename rhsTy, typename resTy>
+sycl::event
+gemm_batch_contig_tiled_impl(sycl::queue &exec_q,
+                             const char *lhs_cp,
+                             const char *rhs_cp,
+                             char *res_cp,
+                             std::size_t batch_nelems,
+                             std::size_t n,
+                             std::size_t k,
+                             std::size_t m,
+                             ssize_t lhs_batch_offset,
+                             ssize_t rhs_batch_offset,
+                             ssize_t res_batch_offset,
+                             int config_id,
+                             std::vector<sycl::event> const &depends = {})
+{
+    const lhsTy *lhs_tp =
+        reinterpret_cast<const lhsTy *>(lhs_cp) + lhs_batch_offset;
+    const rhsTy *rhs_tp =
+        reinterpret_cast<const rhsTy *>(rhs_cp) + rhs_batch_offset;
+    resTy *res_tp = reinterpret_cast<resTy *>(res_cp) + res_batch_offset;
+
+    const GemmContigMatrixIndexer lhs_indexer{n, k};
+    const GemmContigMatrixIndexer rhs_indexer{k, m};
+    const GemmContigMatrixIndexer res_indexer{n, m};
+
+    return gemm_detail::_gemm_batch_tiled_dispatch<lhsTy, rhsTy, resTy>(
+        exec_q, lhs_tp, rhs_tp, res_tp, batch_nelems, n, k, m, lhs_indexer,
+        rhs_indexer, res_indexer, config_id, depends);
+}
+
+typedef sycl::event (*gemm_batch_strided_tiled_impl_fn_ptr_t)(
+    sycl::queue &,
+    const char *, // lhs
+    const char *, // rhs
+    char *,       // res
+    std::size_t,  // batch nelems
+    std::size_t,  // n
+    std::size_t,  // k
+    std::size_t,  // m
+    ssize_t,      // lhs offset
+    ssize_t,      // lhs batch stride
+    ssize_t,      // lhs row stride
+    ssize_t,      // lhs column stride
+    ssize_t,      // rhs offset
+    ssize_t,      // rhs batch stride
+    ssize_t,      // rhs row stride
+    ssize_t,      // rhs column stride
+    ssize_t,      // res offset
+    ssize_t,      // res batch stride
+    ssize_t,      // res row stride
+    ssize_t,      // res column stride
+    int,          // tile configuration
+    std::vector<sycl::event> const &);
+
+/*!
+ * @brief Multiplies `batch_nelems` pairs of matrices of shapes `(n, k)` and
+ * `(k, m)` with arbitrary batch, row and column strides, using tile
+ * configuration `config_id`.
+ *
+ * Transposed operands and batches broadcast with zero batch stride are
+ * read in place, without copying them into contiguous temporaries.
+ */
+template <typename lhsTy, typename rhsTy, typename resTy>
+sycl::event
+gemm_batch_strided_tiled_impl(sycl::queue &exec_q,
+                              const char *lhs_cp,
+                              const char *rhs_cp,
+                              char *res_cp,
+                              std::size_t batch_nelems,
+                              std::size_t n,
+                              std::size_t k,
+                              std::size_t m,
+                              ssize_t lhs_offset,
+                              ssize_t lhs_batch_stride,
+                              ssize_t lhs_row_stride,
+                              ssize_t lhs_col_stride,
+                              ssize_t rhs_offset,
+                              ssize_t rhs_batch_stride,
+                              ssize_t rhs_row_stride,
+                              ssize_t rhs_col_stride,
+                              ssize_t res_offset,
+                              ssize_t res_batch_stride,
+                              ssize_t res_row_stride,
+                              ssize_t res_col_stride,
+                              int config_id,
+                              std::vector<sycl::event> const &depends = {})
+{
+    const lhsTy *lhs_tp = reinterpret_cast<const lhsTy *>(lhs_cp) + lhs_offset;
+    const rhsTy *rhs_tp = reinterpret_cast<const rhsTy *>(rhs_cp) + rhs_offset;
+    resTy *res_tp = reinterpret_cast<resTy *>(res_cp) + res_offset;
+
+    const GemmStridedMatrixIndexer lhs_indexer{lhs_batch_stride,
+                                               lhs_row_stride, lhs_col_stride};
+    const GemmStridedMatrixIndexer rhs_indexer{rhs_batch_stride,
+                                               rhs_row_stride, rhs_col_stride};
+    const GemmStridedMatrixIndexer res_indexer{res_batch_stride,
+                                               res_row_stride, res_col_stride};
+
+    return gemm_detail::_gemm_batch_tiled_dispatch<lhsTy, rhsTy, resTy>(
+        exec_q, lhs_tp, rhs_tp, res_tp, batch_nelems, n, k, m, lhs_indexer,
+        rhs_indexer, res_indexer, config_id, depends);
+}
+
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
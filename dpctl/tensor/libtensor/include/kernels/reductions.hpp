@@ -26,6 +26,7 @@
 #include <complex>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <stdexcept>
 #include <sycl/sycl.hpp>
 #include <type_traits>
@@ -3317,6 +3318,1116 @@ sycl::event search_axis0_over_group_temps_contig_impl(
     }
 }
 
+/* = Single-pass variance reduction, using Welford's algorithm = */
+
+/*! @brief Partial result of variance reduction: number of elements, their
+ *  mean and sum of squared deviations from the mean */
+template <typename T> struct WelfordState
+{
+    T n;
+    T mean;
+    T m2;
+};
+
+/*! @brief Combines partial results of variance reduction over disjoint sets
+ *  of elements (Chan et al.) */
+template <typename T> struct WelfordCombine
+{
+    WelfordState<T> operator()(const WelfordState<T> &a,
+                               const WelfordState<T> &b) const
+    {
+        if (b.n == T(0)) {
+            return a;
+        }
+        if (a.n == T(0)) {
+            return b;
+        }
+        const T n = a.n + b.n;
+        const T delta = b.mean - a.mean;
+        const T b_frac = b.n / n;
+        return WelfordState<T>{n, a.mean + delta * b_frac,
+                               a.m2 + b.m2 + delta * delta * a.n * b_frac};
+    }
+};
+
+/*! @brief Type used to accumulate variance of values of type resT */
+template <typename resT>
+using welford_acc_t =
+    std::conditional_t<std::is_same_v<resT, sycl::half>, float, resT>;
+
+/*
+  Each work-group reduces a batch of elements of an iteration into a partial
+  result, combining them over the work-group with custom_reduce_over_group.
+
+  If argT is WelfordState<accT>, partial results computed by a previous
+  invocation are combined. If outT is WelfordState<accT>, partial results are
+  written to a temporary, otherwise variance, or standard deviation, is
+  computed and written out.
+*/
+template <typename argT,
+          typename accT,
+          typename outT,
+          typename InputOutputIterIndexerT,
+          typename InputRedIndexerT,
+          typename SlmT>
+struct WelfordReductionFunctor
+{
+private:
+    const argT *inp_ = nullptr;
+    outT *out_ = nullptr;
+    InputOutputIterIndexerT inp_out_iter_indexer_;
+    InputRedIndexerT inp_reduced_dims_indexer_;
+    SlmT local_mem_;
+    accT correction_ = accT(0);
+    bool take_sqrt_ = false;
+    std::size_t reduction_max_gid_ = 0;
+    std::size_t iter_gws_ = 1;
+    std::size_t reductions_per_wi = 16;
+
+public:
+    WelfordReductionFunctor(
+        const argT *data,
+        outT *res,
+        const InputOutputIterIndexerT &arg_res_iter_indexer,
+        const InputRedIndexerT &arg_reduced_dims_indexer,
+        SlmT local_mem,
+        accT correction,
+        bool take_sqrt,
+        std::size_t reduction_size,
+        std::size_t iteration_size,
+        std::size_t reduction_size_per_wi)
+        : inp_(data), out_(res), inp_out_iter_indexer_(arg_res_iter_indexer),
+          inp_reduced_dims_indexer_(arg_reduced_dims_indexer),
+          local_mem_(local_mem), correction_(correction),
+          take_sqrt_(take_sqrt), reduction_max_gid_(reduction_size),
+          iter_gws_(iteration_size), reductions_per_wi(reduction_size_per_wi)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        const std::size_t reduction_lid = it.get_local_id(0);
+        const std::size_t wg = it.get_local_range(0);
+
+        const std::size_t iter_gid = it.get_group(0) % iter_gws_;
+        const std::size_t reduction_batch_id = it.get_group(0) / iter_gws_;
+        const std::size_t n_reduction_groups =
+            it.get_group_range(0) / iter_gws_;
+
+        auto inp_out_iter_offsets_ = inp_out_iter_indexer_(iter_gid);
+        const auto &inp_iter_offset = inp_out_iter_offsets_.get_first_offset();
+        const auto &out_iter_offset = inp_out_iter_offsets_.get_second_offset();
+
+        using StateT = WelfordState<accT>;
+        const WelfordCombine<accT> combine{};
+
+        StateT local_state{accT(0), accT(0), accT(0)};
+        std::size_t arg_reduce_gid0 =
+            reduction_lid + reduction_batch_id * wg * reductions_per_wi;
+        for (std::size_t m = 0; m < reductions_per_wi; ++m) {
+            std::size_t arg_reduce_gid = arg_reduce_gid0 + m * wg;
+
+            if (arg_reduce_gid < reduction_max_gid_) {
+                auto inp_reduction_offset =
+                    inp_reduced_dims_indexer_(arg_reduce_gid);
+                auto inp_offset = inp_iter_offset + inp_reduction_offset;
+
+                if constexpr (std::is_same_v<argT, StateT>) {
+                    local_state = combine(local_state, inp_[inp_offset]);
+                }
+                else {
+                    using dpctl::tensor::type_utils::convert_impl;
+                    const accT val = convert_impl<accT, argT>(inp_[inp_offset]);
+
+                    local_state.n += accT(1);
+                    const accT delta = val - local_state.mean;
+                    local_state.mean += delta / local_state.n;
+                    local_state.m2 += delta * (val - local_state.mean);
+                }
+            }
+        }
+
+        auto work_group = it.get_group();
+        StateT red_state_over_wg = su_ns::custom_reduce_over_group(
+            work_group, local_mem_, local_state, combine);
+
+        if (work_group.leader()) {
+            if constexpr (std::is_same_v<outT, StateT>) {
+                // each group writes to a different memory location
+                out_[out_iter_offset * n_reduction_groups +
+                     reduction_batch_id] = red_state_over_wg;
+            }
+            else {
+                const accT div = red_state_over_wg.n - correction_;
+                accT res = (red_state_over_wg.n > accT(0) && div > accT(0))
+                               ? red_state_over_wg.m2 / div
+                               : std::numeric_limits<accT>::quiet_NaN();
+                if (take_sqrt_) {
+                    res = sycl::sqrt(res);
+                }
+                out_[out_iter_offset] = static_cast<outT>(res);
+            }
+        }
+    }
+};
+
+template <typename T1, typename T2, typename T3, typename T4, typename T5>
+class welford_reduction_krn;
+
+template <typename T1, typename T2> class welford_reduction_empty_krn;
+
+template <typename argTy,
+          typename accTy,
+          typename outTy,
+          typename InputOutputIterIndexerT,
+          typename ReductionIndexerT>
+sycl::event
+submit_welford_reduction(sycl::queue &exec_q,
+                         const argTy *arg,
+                         outTy *res,
+                         accTy correction,
+                         bool take_sqrt,
+                         std::size_t wg,
+                         std::size_t iter_nelems,
+                         std::size_t reduction_nelems,
+                         std::size_t reductions_per_wi,
+                         std::size_t reduction_groups,
+                         const InputOutputIterIndexerT &in_out_iter_indexer,
+                         const ReductionIndexerT &reduction_indexer,
+                         const std::vector<sycl::event> &depends)
+{
+    sycl::event red_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        auto globalRange = sycl::range<1>{iter_nelems * reduction_groups * wg};
+        auto localRange = sycl::range<1>{wg};
+        auto ndRange = sycl::nd_range<1>(globalRange, localRange);
+
+        using SlmT = sycl::local_accessor<WelfordState<accTy>, 1>;
+        SlmT local_memory = SlmT(localRange, cgh);
+
+        using KernelName =
+            class welford_reduction_krn<argTy, accTy, outTy,
+                                        InputOutputIterIndexerT,
+                                        ReductionIndexerT>;
+
+        cgh.parallel_for<KernelName>(
+            ndRange,
+            WelfordReductionFunctor<argTy, accTy, outTy,
+                                    InputOutputIterIndexerT, ReductionIndexerT,
+                                    SlmT>(
+                arg, res, in_out_iter_indexer, reduction_indexer, local_memory,
+                correction, take_sqrt, reduction_nelems, iter_nelems,
+                reductions_per_wi));
+    });
+    return red_ev;
+}
+
+/*! @brief Computes variance, or standard deviation, of `reduction_nelems`
+ * elements for each of `iter_nelems` iterations in a single pass over input
+ */
+template <typename argTy,
+          typename resTy,
+          typename InputIterIndexerT,
+          typename ResIterIndexerT,
+          typename ReductionIndexerT>
+sycl::event
+welford_over_group_temps_impl(sycl::queue &exec_q,
+                              std::size_t iter_nelems,
+                              std::size_t reduction_nelems,
+                              const argTy *arg_tp,
+                              resTy *res_tp,
+                              double correction,
+                              bool take_sqrt,
+                              const InputIterIndexerT &inp_iter_indexer,
+                              const ResIterIndexerT &res_iter_indexer,
+                              const ReductionIndexerT &reduction_indexer,
+                              const std::vector<sycl::event> &depends)
+{
+    using accTy = welford_acc_t<resTy>;
+    using StateT = WelfordState<accTy>;
+
+    if (reduction_nelems == 0) {
+        sycl::event res_init_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(depends);
+
+            using InitKernelName =
+                class welford_reduction_empty_krn<resTy, ResIterIndexerT>;
+            const resTy nan_val =
+                static_cast<resTy>(std::numeric_limits<accTy>::quiet_NaN());
+
+            cgh.parallel_for<InitKernelName>(
+                sycl::range<1>(iter_nelems), [=](sycl::id<1> id) {
+                    auto res_offset = res_iter_indexer(id[0]);
+                    res_tp[res_offset] = nan_val;
+                });
+        });
+
+        return res_init_ev;
+    }
+
+    const accTy acc_correction = static_cast<accTy>(correction);
+
+    const sycl::device &d = exec_q.get_device();
+    const auto &sg_sizes = d.get_info<sycl::info::device::sub_group_sizes>();
+    std::size_t wg = choose_workgroup_size<4>(reduction_nelems, sg_sizes);
+
+    static constexpr std::size_t preferred_reductions_per_wi = 8;
+    // prevents running out of resources on CPU
+    std::size_t max_wg = reduction_detail::get_work_group_size(d);
+
+    using dpctl::tensor::offset_utils::NoOpIndexer;
+    using dpctl::tensor::offset_utils::Strided1DIndexer;
+    using dpctl::tensor::offset_utils::TwoOffsets_CombinedIndexer;
+
+    if (reduction_nelems <= preferred_reductions_per_wi * max_wg) {
+        // one work-group per iteration, can output directly to res
+        using InputOutputIterIndexerT =
+            TwoOffsets_CombinedIndexer<InputIterIndexerT, ResIterIndexerT>;
+        const InputOutputIterIndexerT in_out_iter_indexer{inp_iter_indexer,
+                                                          res_iter_indexer};
+
+        if (iter_nelems == 1) {
+            // increase GPU occupancy
+            wg = max_wg;
+        }
+        const std::size_t reductions_per_wi =
+            std::max<std::size_t>(1, (reduction_nelems + wg - 1) / wg);
+
+        return submit_welford_reduction<argTy, accTy, resTy,
+                                        InputOutputIterIndexerT,
+                                        ReductionIndexerT>(
+            exec_q, arg_tp, res_tp, acc_correction, take_sqrt, wg, iter_nelems,
+            reduction_nelems, reductions_per_wi, 1, in_out_iter_indexer,
+            reduction_indexer, depends);
+    }
+
+    // more than one work-groups is needed, requires a temporary
+    std::size_t reduction_groups =
+        (reduction_nelems + preferred_reductions_per_wi * wg - 1) /
+        (preferred_reductions_per_wi * wg);
+    assert(reduction_groups > 1);
+
+    std::size_t second_iter_reduction_groups_ =
+        (reduction_groups + preferred_reductions_per_wi * wg - 1) /
+        (preferred_reductions_per_wi * wg);
+
+    const std::size_t tmp_alloc_size =
+        iter_nelems * (reduction_groups + second_iter_reduction_groups_);
+    auto tmp_owner = dpctl::tensor::alloc_utils::smart_malloc_device<StateT>(
+        tmp_alloc_size, exec_q);
+
+    StateT *temp_arg = tmp_owner.get();
+    StateT *temp2_arg = temp_arg + reduction_groups * iter_nelems;
+
+    sycl::event dependent_ev;
+    {
+        using InputOutputIterIndexerT =
+            TwoOffsets_CombinedIndexer<InputIterIndexerT, NoOpIndexer>;
+        const InputOutputIterIndexerT in_out_iter_indexer{inp_iter_indexer,
+                                                          NoOpIndexer{}};
+
+        dependent_ev =
+            submit_welford_reduction<argTy, accTy, StateT,
+                                     InputOutputIterIndexerT,
+                                     ReductionIndexerT>(
+                exec_q, arg_tp, temp_arg, acc_correction, take_sqrt, wg,
+                iter_nelems, reduction_nelems, preferred_reductions_per_wi,
+                reduction_groups, in_out_iter_indexer, reduction_indexer,
+                depends);
+    }
+
+    std::size_t remaining_reduction_nelems = reduction_groups;
+    while (remaining_reduction_nelems > preferred_reductions_per_wi * max_wg) {
+        std::size_t reduction_groups_ =
+            (remaining_reduction_nelems + preferred_reductions_per_wi * wg -
+             1) /
+            (preferred_reductions_per_wi * wg);
+        assert(reduction_groups_ > 1);
+
+        // keep combining partial results
+        using InputOutputIterIndexerT =
+            TwoOffsets_CombinedIndexer<Strided1DIndexer, NoOpIndexer>;
+        const InputOutputIterIndexerT in_out_iter_indexer{
+            Strided1DIndexer{/* size */ iter_nelems,
+                             /* step */ remaining_reduction_nelems},
+            NoOpIndexer{}};
+        static constexpr NoOpIndexer tmp_reduction_indexer{};
+
+        sycl::event partial_reduction_ev =
+            submit_welford_reduction<StateT, accTy, StateT,
+                                     InputOutputIterIndexerT, NoOpIndexer>(
+                exec_q, temp_arg, temp2_arg, acc_correction, take_sqrt, wg,
+                iter_nelems, remaining_reduction_nelems,
+                preferred_reductions_per_wi, reduction_groups_,
+                in_out_iter_indexer, tmp_reduction_indexer, {dependent_ev});
+
+        remaining_reduction_nelems = reduction_groups_;
+        std::swap(temp_arg, temp2_arg);
+        dependent_ev = std::move(partial_reduction_ev);
+    }
+
+    // final reduction to res
+    using InputOutputIterIndexerT =
+        TwoOffsets_CombinedIndexer<Strided1DIndexer, ResIterIndexerT>;
+    const InputOutputIterIndexerT in_out_iter_indexer{
+        Strided1DIndexer{/* size */ iter_nelems,
+                         /* step */ remaining_reduction_nelems},
+        res_iter_indexer};
+    static constexpr NoOpIndexer tmp_reduction_indexer{};
+
+    wg = max_wg;
+    const std::size_t reductions_per_wi = std::max<std::size_t>(
+        1, (remaining_reduction_nelems + wg - 1) / wg);
+
+    sycl::event final_reduction_ev =
+        submit_welford_reduction<StateT, accTy, resTy, InputOutputIterIndexerT,
+                                 NoOpIndexer>(
+            exec_q, temp_arg, res_tp, acc_correction, take_sqrt, wg,
+            iter_nelems, remaining_reduction_nelems, reductions_per_wi, 1,
+            in_out_iter_indexer, tmp_reduction_indexer, {dependent_ev});
+
+    sycl::event cleanup_host_task_event =
+        dpctl::tensor::alloc_utils::async_smart_free(
+            exec_q, {final_reduction_ev}, tmp_owner);
+
+    return cleanup_host_task_event;
+}
+
+typedef sycl::event (*welford_reduction_strided_impl_fn_ptr)(
+    sycl::queue &,
+    std::size_t,
+    std::size_t,
+    const char *,
+    char *,
+    double,
+    bool,
+    int,
+    const ssize_t *,
+    ssize_t,
+    ssize_t,
+    int,
+    const ssize_t *,
+    ssize_t,
+    const std::vector<sycl::event> &);
+
+template <typename argTy, typename resTy>
+sycl::event welford_over_group_temps_strided_impl(
+    sycl::queue &exec_q,
+    std::size_t iter_nelems,
+    std::size_t reduction_nelems,
+    const char *arg_cp,
+    char *res_cp,
+    double correction,
+    bool take_sqrt,
+    int iter_nd,
+    const ssize_t *iter_shape_and_strides,
+    ssize_t iter_arg_offset,
+    ssize_t iter_res_offset,
+    int red_nd,
+    const ssize_t *reduction_shape_stride,
+    ssize_t reduction_arg_offset,
+    const std::vector<sycl::event> &depends)
+{
+    const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_cp);
+    resTy *res_tp = reinterpret_cast<resTy *>(res_cp);
+
+    using InputIterIndexerT = dpctl::tensor::offset_utils::StridedIndexer;
+    using ResIterIndexerT = dpctl::tensor::offset_utils::UnpackedStridedIndexer;
+    using ReductionIndexerT = dpctl::tensor::offset_utils::StridedIndexer;
+
+    // Only 2*iter_nd entries describing shape and strides of iterated
+    // dimensions of input array are going to be accessed by inp_indexer
+    const InputIterIndexerT inp_iter_indexer(iter_nd, iter_arg_offset,
+                                             iter_shape_and_strides);
+    const ResIterIndexerT res_iter_indexer{
+        iter_nd, iter_res_offset,
+        /* shape */ iter_shape_and_strides,
+        /* strides */ iter_shape_and_strides + 2 * iter_nd};
+    const ReductionIndexerT reduction_indexer{red_nd, reduction_arg_offset,
+                                              reduction_shape_stride};
+
+    return welford_over_group_temps_impl<argTy, resTy>(
+        exec_q, iter_nelems, reduction_nelems, arg_tp, res_tp, correction,
+        take_sqrt, inp_iter_indexer, res_iter_indexer, reduction_indexer,
+        depends);
+}
+
+typedef sycl::event (*welford_reduction_contig_impl_fn_ptr)(
+    sycl::queue &,
+    std::size_t,
+    std::size_t,
+    const char *,
+    char *,
+    double,
+    bool,
+    ssize_t,
+    ssize_t,
+    ssize_t,
+    const std::vector<sycl::event> &);
+
+template <typename argTy, typename resTy>
+sycl::event welford_axis1_over_group_temps_contig_impl(
+    sycl::queue &exec_q,
+    std::size_t iter_nelems,
+    std::size_t reduction_nelems,
+    const char *arg_cp,
+    char *res_cp,
+    double correction,
+    bool take_sqrt,
+    ssize_t iter_arg_offset,
+    ssize_t iter_res_offset,
+    ssize_t reduction_arg_offset,
+    const std::vector<sycl::event> &depends)
+{
+    const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_cp) +
+                          iter_arg_offset + reduction_arg_offset;
+    resTy *res_tp = reinterpret_cast<resTy *>(res_cp) + iter_res_offset;
+
+    using InputIterIndexerT = dpctl::tensor::offset_utils::Strided1DIndexer;
+    using NoOpIndexerT = dpctl::tensor::offset_utils::NoOpIndexer;
+
+    const InputIterIndexerT inp_iter_indexer{/* size */ iter_nelems,
+                                             /* step */ reduction_nelems};
+    static constexpr NoOpIndexerT res_iter_indexer{};
+    static constexpr NoOpIndexerT reduction_indexer{};
+
+    return welford_over_group_temps_impl<argTy, resTy>(
+        exec_q, iter_nelems, reduction_nelems, arg_tp, res_tp, correction,
+        take_sqrt, inp_iter_indexer, res_iter_indexer, reduction_indexer,
+        depends);
+}
+
+template <typename argTy, typename resTy>
+sycl::event welford_axis0_over_group_temps_contig_impl(
+    sycl::queue &exec_q,
+    std::size_t iter_nelems,
+    std::size_t reduction_nelems,
+    const char *arg_cp,
+    char *res_cp,
+    double correction,
+    bool take_sqrt,
+    ssize_t iter_arg_offset,
+    ssize_t iter_res_offset,
+    ssize_t reduction_arg_offset,
+    const std::vector<sycl::event> &depends)
+{
+    const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_cp) +
+                          iter_arg_offset + reduction_arg_offset;
+    resTy *res_tp = reinterpret_cast<resTy *>(res_cp) + iter_res_offset;
+
+    using NoOpIndexerT = dpctl::tensor::offset_utils::NoOpIndexer;
+    using ReductionIndexerT = dpctl::tensor::offset_utils::Strided1DIndexer;
+
+    static constexpr NoOpIndexerT inp_iter_indexer{};
+    static constexpr NoOpIndexerT res_iter_indexer{};
+    const ReductionIndexerT reduction_indexer{/* size */ reduction_nelems,
+                                              /* step */ iter_nelems};
+
+    return welford_over_group_temps_impl<argTy, resTy>(
+        exec_q, iter_nelems, reduction_nelems, arg_tp, res_tp, correction,
+        take_sqrt, inp_iter_indexer, res_iter_indexer, reduction_indexer,
+        depends);
+}
+
+/* == Multi-output reductions, computing two results in a single pass == */
+
+/*! @brief Pair of values accumulated by a multi-output reduction */
+template <typename T1, typename T2> struct ReductionPair
+{
+    using first_type = T1;
+    using second_type = T2;
+
+    T1 first;
+    T2 second;
+};
+
+/*! @brief Multi-output reduction computing minimum and maximum */
+template <typename T> struct MinMaxReductionOp
+{
+    using state_t = ReductionPair<T, T>;
+
+    state_t identity() const
+    {
+        return state_t{su_ns::GetIdentity<su_ns::Minimum<T>, T>::value,
+                       su_ns::GetIdentity<su_ns::Maximum<T>, T>::value};
+    }
+
+    template <typename argT>
+    state_t make_state(const argT &val, std::size_t) const
+    {
+        return state_t{val, val};
+    }
+
+    state_t operator()(const state_t &a, const state_t &b) const
+    {
+        return state_t{su_ns::Minimum<T>{}(a.first, b.first),
+                       su_ns::Maximum<T>{}(a.second, b.second)};
+    }
+};
+
+/*! @brief Multi-output reduction computing sum of elements and sum of their
+ *  squares, both accumulated in type T */
+template <typename T> struct SumSumSqReductionOp
+{
+    using state_t = ReductionPair<T, T>;
+
+    state_t identity() const { return state_t{T(0), T(0)}; }
+
+    template <typename argT>
+    state_t make_state(const argT &val, std::size_t) const
+    {
+        using dpctl::tensor::type_utils::convert_impl;
+        const T v = convert_impl<T, argT>(val);
+        return state_t{v, static_cast<T>(v * v)};
+    }
+
+    state_t operator()(const state_t &a, const state_t &b) const
+    {
+        return state_t{static_cast<T>(a.first + b.first),
+                       static_cast<T>(a.second + b.second)};
+    }
+};
+
+/*! @brief Multi-output reduction computing maximum and index of its first
+ *  occurrence. NaN values are greater than any other value. */
+template <typename T, typename IndT> struct MaxArgMaxReductionOp
+{
+    using state_t = ReductionPair<T, IndT>;
+
+    state_t identity() const
+    {
+        return state_t{su_ns::GetIdentity<su_ns::Maximum<T>, T>::value,
+                       std::numeric_limits<IndT>::max()};
+    }
+
+    template <typename argT>
+    state_t make_state(const argT &val, std::size_t idx) const
+    {
+        return state_t{val, static_cast<IndT>(idx)};
+    }
+
+    state_t operator()(const state_t &a, const state_t &b) const
+    {
+        const bool a_nan = is_nan(a.first);
+        const bool b_nan = is_nan(b.first);
+        if (a_nan || b_nan) {
+            if (a_nan && b_nan) {
+                return (a.second < b.second) ? a : b;
+            }
+            return (a_nan) ? a : b;
+        }
+        if (a.first == b.first) {
+            return (a.second < b.second) ? a : b;
+        }
+        return (greater(a.first, b.first)) ? a : b;
+    }
+
+private:
+    static bool is_nan(const T &v)
+    {
+        using dpctl::tensor::type_utils::is_complex;
+        if constexpr (is_complex<T>::value) {
+            return std::isnan(std::real(v)) || std::isnan(std::imag(v));
+        }
+        else if constexpr (std::is_floating_point_v<T> ||
+                           std::is_same_v<T, sycl::half>)
+        {
+            return std::isnan(v);
+        }
+        else {
+            return false;
+        }
+    }
+
+    static bool greater(const T &x, const T &y)
+    {
+        using dpctl::tensor::type_utils::is_complex;
+        if constexpr (is_complex<T>::value) {
+            using dpctl::tensor::math_utils::greater_complex;
+            return greater_complex<T>(x, y);
+        }
+        else {
+            return x > y;
+        }
+    }
+};
+
+/*
+  Each work-group reduces a batch of elements of an iteration into a pair of
+  values, combining them over the work-group with custom_reduce_over_group.
+
+  If argT is OpT::state_t, partial results computed by a previous invocation
+  are combined. Otherwise the index of an element passed to the operation is
+  its position among reduced elements. If to_temp is true, partial results
+  are written to a temporary, otherwise the two values are written to the
+  two outputs.
+*/
+template <typename argT,
+          typename OpT,
+          bool to_temp,
+          typename InputOutputIterIndexerT,
+          typename InputRedIndexerT,
+          typename SlmT>
+struct MultiOutputReductionFunctor
+{
+private:
+    using StateT = typename OpT::state_t;
+    using res1T = typename StateT::first_type;
+    using res2T = typename StateT::second_type;
+
+    const argT *inp_ = nullptr;
+    StateT *tmp_ = nullptr;
+    res1T *out1_ = nullptr;
+    res2T *out2_ = nullptr;
+    OpT op_;
+    InputOutputIterIndexerT inp_out_iter_indexer_;
+    InputRedIndexerT inp_reduced_dims_indexer_;
+    SlmT local_mem_;
+    std::size_t reduction_max_gid_ = 0;
+    std::size_t iter_gws_ = 1;
+    std::size_t reductions_per_wi = 16;
+
+public:
+    MultiOutputReductionFunctor(
+        const argT *data,
+        StateT *tmp,
+        res1T *res1,
+        res2T *res2,
+        const OpT &op,
+        const InputOutputIterIndexerT &arg_res_iter_indexer,
+        const InputRedIndexerT &arg_reduced_dims_indexer,
+        SlmT local_mem,
+        std::size_t reduction_size,
+        std::size_t iteration_size,
+        std::size_t reduction_size_per_wi)
+        : inp_(data), tmp_(tmp), out1_(res1), out2_(res2), op_(op),
+          inp_out_iter_indexer_(arg_res_iter_indexer),
+          inp_reduced_dims_indexer_(arg_reduced_dims_indexer),
+          local_mem_(local_mem), reduction_max_gid_(reduction_size),
+          iter_gws_(iteration_size), reductions_per_wi(reduction_size_per_wi)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        const std::size_t reduction_lid = it.get_local_id(0);
+        const std::size_t wg = it.get_local_range(0);
+
+        const std::size_t iter_gid = it.get_group(0) % iter_gws_;
+        const std::size_t reduction_batch_id = it.get_group(0) / iter_gws_;
+        const std::size_t n_reduction_groups =
+            it.get_group_range(0) / iter_gws_;
+
+        auto inp_out_iter_offsets_ = inp_out_iter_indexer_(iter_gid);
+        const auto &inp_iter_offset = inp_out_iter_offsets_.get_first_offset();
+        const auto &out_iter_offset = inp_out_iter_offsets_.get_second_offset();
+
+        StateT local_state = op_.identity();
+        std::size_t arg_reduce_gid0 =
+            reduction_lid + reduction_batch_id * wg * reductions_per_wi;
+        for (std::size_t m = 0; m < reductions_per_wi; ++m) {
+            std::size_t arg_reduce_gid = arg_reduce_gid0 + m * wg;
+
+            if (arg_reduce_gid < reduction_max_gid_) {
+                auto inp_reduction_offset =
+                    inp_reduced_dims_indexer_(arg_reduce_gid);
+                auto inp_offset = inp_iter_offset + inp_reduction_offset;
+
+                if constexpr (std::is_same_v<argT, StateT>) {
+                    local_state = op_(local_state, inp_[inp_offset]);
+                }
+                else {
+                    local_state =
+                        op_(local_state,
+                            op_.make_state(inp_[inp_offset], arg_reduce_gid));
+                }
+            }
+        }
+
+        auto work_group = it.get_group();
+        StateT red_state_over_wg = su_ns::custom_reduce_over_group(
+            work_group, local_mem_, local_state, op_);
+
+        if (work_group.leader()) {
+            if constexpr (to_temp) {
+                // each group writes to a different memory location
+                tmp_[out_iter_offset * n_reduction_groups +
+                     reduction_batch_id] = red_state_over_wg;
+            }
+            else {
+                out1_[out_iter_offset] = red_state_over_wg.first;
+                out2_[out_iter_offset] = red_state_over_wg.second;
+            }
+        }
+    }
+};
+
+template <typename T1, typename T2, bool B, typename T4, typename T5>
+class multi_output_reduction_krn;
+
+template <typename T1, typename T2, typename T3>
+class multi_output_reduction_empty_krn;
+
+template <typename argTy,
+          typename OpT,
+          bool to_temp,
+          typename InputOutputIterIndexerT,
+          typename ReductionIndexerT>
+sycl::event submit_multi_output_reduction(
+    sycl::queue &exec_q,
+    const argTy *arg,
+    typename OpT::state_t *tmp,
+    typename OpT::state_t::first_type *res1,
+    typename OpT::state_t::second_type *res2,
+    const OpT &op,
+    std::size_t wg,
+    std::size_t iter_nelems,
+    std::size_t reduction_nelems,
+    std::size_t reductions_per_wi,
+    std::size_t reduction_groups,
+    const InputOutputIterIndexerT &in_out_iter_indexer,
+    const ReductionIndexerT &reduction_indexer,
+    const std::vector<sycl::event> &depends)
+{
+    sycl::event red_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        auto globalRange = sycl::range<1>{iter_nelems * reduction_groups * wg};
+        auto localRange = sycl::range<1>{wg};
+        auto ndRange = sycl::nd_range<1>(globalRange, localRange);
+
+        using SlmT = sycl::local_accessor<typename OpT::state_t, 1>;
+        SlmT local_memory = SlmT(localRange, cgh);
+
+        using KernelName =
+            class multi_output_reduction_krn<argTy, OpT, to_temp,
+                                             InputOutputIterIndexerT,
+                                             ReductionIndexerT>;
+
+        cgh.parallel_for<KernelName>(
+            ndRange,
+            MultiOutputReductionFunctor<argTy, OpT, to_temp,
+                                        InputOutputIterIndexerT,
+                                        ReductionIndexerT, SlmT>(
+                arg, tmp, res1, res2, op, in_out_iter_indexer,
+                reduction_indexer, local_memory, reduction_nelems, iter_nelems,
+                reductions_per_wi));
+    });
+    return red_ev;
+}
+
+/*! @brief Computes two results of reduction operation `OpT` over
+ * `reduction_nelems` elements for each of `iter_nelems` iterations in a
+ * single pass over input. Both outputs are indexed by `res_iter_indexer`.
+ */
+template <typename argTy,
+          typename OpT,
+          typename InputIterIndexerT,
+          typename ResIterIndexerT,
+          typename ReductionIndexerT>
+sycl::event multi_output_over_group_temps_impl(
+    sycl::queue &exec_q,
+    std::size_t iter_nelems,
+    std::size_t reduction_nelems,
+    const argTy *arg_tp,
+    typename OpT::state_t::first_type *res1_tp,
+    typename OpT::state_t::second_type *res2_tp,
+    const InputIterIndexerT &inp_iter_indexer,
+    const ResIterIndexerT &res_iter_indexer,
+    const ReductionIndexerT &reduction_indexer,
+    const std::vector<sycl::event> &depends)
+{
+    using StateT = typename OpT::state_t;
+    static constexpr OpT op{};
+
+    if (reduction_nelems == 0) {
+        sycl::event res_init_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(depends);
+
+            using InitKernelName =
+                class multi_output_reduction_empty_krn<argTy, OpT,
+                                                       ResIterIndexerT>;
+            const StateT identity_val = op.identity();
+
+            cgh.parallel_for<InitKernelName>(
+                sycl::range<1>(iter_nelems), [=](sycl::id<1> id) {
+                    auto res_offset = res_iter_indexer(id[0]);
+                    res1_tp[res_offset] = identity_val.first;
+                    res2_tp[res_offset] = identity_val.second;
+                });
+        });
+
+        return res_init_ev;
+    }
+
+    const sycl::device &d = exec_q.get_device();
+    const auto &sg_sizes = d.get_info<sycl::info::device::sub_group_sizes>();
+    std::size_t wg = choose_workgroup_size<4>(reduction_nelems, sg_sizes);
+
+    static constexpr std::size_t preferred_reductions_per_wi = 8;
+    // prevents running out of resources on CPU
+    std::size_t max_wg = reduction_detail::get_work_group_size(d);
+
+    using dpctl::tensor::offset_utils::NoOpIndexer;
+    using dpctl::tensor::offset_utils::Strided1DIndexer;
+    using dpctl::tensor::offset_utils::TwoOffsets_CombinedIndexer;
+
+    if (reduction_nelems <= preferred_reductions_per_wi * max_wg) {
+        // one work-group per iteration, can output directly to res
+        using InputOutputIterIndexerT =
+            TwoOffsets_CombinedIndexer<InputIterIndexerT, ResIterIndexerT>;
+        const InputOutputIterIndexerT in_out_iter_indexer{inp_iter_indexer,
+                                                          res_iter_indexer};
+
+        if (iter_nelems == 1) {
+            // increase GPU occupancy
+            wg = max_wg;
+        }
+        const std::size_t reductions_per_wi =
+            std::max<std::size_t>(1, (reduction_nelems + wg - 1) / wg);
+
+        return submit_multi_output_reduction<argTy, OpT, false,
+                                             InputOutputIterIndexerT,
+                                             ReductionIndexerT>(
+            exec_q, arg_tp, nullptr, res1_tp, res2_tp, op, wg, iter_nelems,
+            reduction_nelems, reductions_per_wi, 1, in_out_iter_indexer,
+            reduction_indexer, depends);
+    }
+
+    // more than one work-groups is needed, requires a temporary
+    std::size_t reduction_groups =
+        (reduction_nelems + preferred_reductions_per_wi * wg - 1) /
+        (preferred_reductions_per_wi * wg);
+    assert(reduction_groups > 1);
+
+    std::size_t second_iter_reduction_groups_ =
+        (reduction_groups + preferred_reductions_per_wi * wg - 1) /
+        (preferred_reductions_per_wi * wg);
+
+    const std::size_t tmp_alloc_size =
+        iter_nelems * (reduction_groups + second_iter_reduction_groups_);
+    auto tmp_owner = dpctl::tensor::alloc_utils::smart_malloc_device<StateT>(
+        tmp_alloc_size, exec_q);
+
+    StateT *temp_arg = tmp_owner.get();
+    StateT *temp2_arg = temp_arg + reduction_groups * iter_nelems;
+
+    sycl::event dependent_ev;
+    {
+        using InputOutputIterIndexerT =
+            TwoOffsets_CombinedIndexer<InputIterIndexerT, NoOpIndexer>;
+        const InputOutputIterIndexerT in_out_iter_indexer{inp_iter_indexer,
+                                                          NoOpIndexer{}};
+
+        dependent_ev =
+            submit_multi_output_reduction<argTy, OpT, true,
+                                          InputOutputIterIndexerT,
+                                          ReductionIndexerT>(
+                exec_q, arg_tp, temp_arg, nullptr, nullptr, op, wg,
+                iter_nelems, reduction_nelems, preferred_reductions_per_wi,
+                reduction_groups, in_out_iter_indexer, reduction_indexer,
+                depends);
+    }
+
+    std::size_t remaining_reduction_nelems = reduction_groups;
+    while (remaining_reduction_nelems > preferred_reductions_per_wi * max_wg) {
+        std::size_t reduction_groups_ =
+            (remaining_reduction_nelems + preferred_reductions_per_wi * wg -
+             1) /
+            (preferred_reductions_per_wi * wg);
+        assert(reduction_groups_ > 1);
+
+        // keep combining partial results
+        using InputOutputIterIndexerT =
+            TwoOffsets_CombinedIndexer<Strided1DIndexer, NoOpIndexer>;
+        const InputOutputIterIndexerT in_out_iter_indexer{
+            Strided1DIndexer{/* size */ iter_nelems,
+                             /* step */ remaining_reduction_nelems},
+            NoOpIndexer{}};
+        static constexpr NoOpIndexer tmp_reduction_indexer{};
+
+        sycl::event partial_reduction_ev =
+            submit_multi_output_reduction<StateT, OpT, true,
+                                          InputOutputIterIndexerT,
+                                          NoOpIndexer>(
+                exec_q, temp_arg, temp2_arg, nullptr, nullptr, op, wg,
+                iter_nelems, remaining_reduction_nelems,
+                preferred_reductions_per_wi, reduction_groups_,
+                in_out_iter_indexer, tmp_reduction_indexer, {dependent_ev});
+
+        remaining_reduction_nelems = reduction_groups_;
+        std::swap(temp_arg, temp2_arg);
+        dependent_ev = std::move(partial_reduction_ev);
+    }
+
+    // final reduction to res
+    using InputOutputIterIndexerT =
+        TwoOffsets_CombinedIndexer<Strided1DIndexer, ResIterIndexerT>;
+    const InputOutputIterIndexerT in_out_iter_indexer{
+        Strided1DIndexer{/* size */ iter_nelems,
+                         /* step */ remaining_reduction_nelems},
+        res_iter_indexer};
+    static constexpr NoOpIndexer tmp_reduction_indexer{};
+
+    wg = max_wg;
+    const std::size_t reductions_per_wi = std::max<std::size_t>(
+        1, (remaining_reduction_nelems + wg - 1) / wg);
+
+    sycl::event final_reduction_ev =
+        submit_multi_output_reduction<StateT, OpT, false,
+                                      InputOutputIterIndexerT, NoOpIndexer>(
+            exec_q, temp_arg, nullptr, res1_tp, res2_tp, op, wg, iter_nelems,
+            remaining_reduction_nelems, reductions_per_wi, 1,
+            in_out_iter_indexer, tmp_reduction_indexer, {dependent_ev});
+
+    sycl::event cleanup_host_task_event =
+        dpctl::tensor::alloc_utils::async_smart_free(
+            exec_q, {final_reduction_ev}, tmp_owner);
+
+    return cleanup_host_task_event;
+}
+
+typedef sycl::event (*multi_output_reduction_strided_impl_fn_ptr)(
+    sycl::queue &,
+    std::size_t,
+    std::size_t,
+    const char *,
+    char *,
+    char *,
+    int,
+    const ssize_t *,
+    ssize_t,
+    ssize_t,
+    int,
+    const ssize_t *,
+    ssize_t,
+    const std::vector<sycl::event> &);
+
+template <typename argTy, typename OpT>
+sycl::event multi_output_over_group_temps_strided_impl(
+    sycl::queue &exec_q,
+    std::size_t iter_nelems,
+    std::size_t reduction_nelems,
+    const char *arg_cp,
+    char *res1_cp,
+    char *res2_cp,
+    int iter_nd,
+    const ssize_t *iter_shape_and_strides,
+    ssize_t iter_arg_offset,
+    ssize_t iter_res_offset,
+    int red_nd,
+    const ssize_t *reduction_shape_stride,
+    ssize_t reduction_arg_offset,
+    const std::vector<sycl::event> &depends)
+{
+    using res1Ty = typename OpT::state_t::first_type;
+    using res2Ty = typename OpT::state_t::second_type;
+
+    const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_cp);
+    res1Ty *res1_tp = reinterpret_cast<res1Ty *>(res1_cp);
+    res2Ty *res2_tp = reinterpret_cast<res2Ty *>(res2_cp);
+
+    using InputIterIndexerT = dpctl::tensor::offset_utils::StridedIndexer;
+    using ResIterIndexerT = dpctl::tensor::offset_utils::UnpackedStridedIndexer;
+    using ReductionIndexerT = dpctl::tensor::offset_utils::StridedIndexer;
+
+    // Only 2*iter_nd entries describing shape and strides of iterated
+    // dimensions of input array are going to be accessed by inp_indexer
+    const InputIterIndexerT inp_iter_indexer(iter_nd, iter_arg_offset,
+                                             iter_shape_and_strides);
+    const ResIterIndexerT res_iter_indexer{
+        iter_nd, iter_res_offset,
+        /* shape */ iter_shape_and_strides,
+        /* strides */ iter_shape_and_strides + 2 * iter_nd};
+    const ReductionIndexerT reduction_indexer{red_nd, reduction_arg_offset,
+                                              reduction_shape_stride};
+
+    return multi_output_over_group_temps_impl<argTy, OpT>(
+        exec_q, iter_nelems, reduction_nelems, arg_tp, res1_tp, res2_tp,
+        inp_iter_indexer, res_iter_indexer, reduction_indexer, depends);
+}
+
+typedef sycl::event (*multi_output_reduction_contig_impl_fn_ptr)(
+    sycl::queue &,
+    std::size_t,
+    std::size_t,
+    const char *,
+    char *,
+    char *,
+    ssize_t,
+    ssize_t,
+    ssize_t,
+    const std::vector<sycl::event> &);
+
+template <typename argTy, typename OpT>
+sycl::event multi_output_axis1_over_group_temps_contig_impl(
+    sycl::queue &exec_q,
+    std::size_t iter_nelems,
+    std::size_t reduction_nelems,
+    const char *arg_cp,
+    char *res1_cp,
+    char *res2_cp,
+    ssize_t iter_arg_offset,
+    ssize_t iter_res_offset,
+    ssize_t reduction_arg_offset,
+    const std::vector<sycl::event> &depends)
+{
+    using res1Ty = typename OpT::state_t::first_type;
+    using res2Ty = typename OpT::state_t::second_type;
+
+    const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_cp) +
+                          iter_arg_offset + reduction_arg_offset;
+    res1Ty *res1_tp = reinterpret_cast<res1Ty *>(res1_cp) + iter_res_offset;
+    res2Ty *res2_tp = reinterpret_cast<res2Ty *>(res2_cp) + iter_res_offset;
+
+    using InputIterIndexerT = dpctl::tensor::offset_utils::Strided1DIndexer;
+    using NoOpIndexerT = dpctl::tensor::offset_utils::NoOpIndexer;
+
+    const InputIterIndexerT inp_iter_indexer{/* size */ iter_nelems,
+                                             /* step */ reduction_nelems};
+    static constexpr NoOpIndexerT res_iter_indexer{};
+    static constexpr NoOpIndexerT reduction_indexer{};
+
+    return multi_output_over_group_temps_impl<argTy, OpT>(
+        exec_q, iter_nelems, reduction_nelems, arg_tp, res1_tp, res2_tp,
+        inp_iter_indexer, res_iter_indexer, reduction_indexer, depends);
+}
+
+template <typename argTy, typename OpT>
+sycl::event multi_output_axis0_over_group_temps_contig_impl(
+    sycl::queue &exec_q,
+    std::size_t iter_nelems,
+    std::size_t reduction_nelems,
+    const char *arg_cp,
+    char *res1_cp,
+    char *res2_cp,
+    ssize_t iter_arg_offset,
+    ssize_t iter_res_offset,
+    ssize_t reduction_arg_offset,
+    const std::vector<sycl::event> &depends)
+{
+    using res1Ty = typename OpT::state_t::first_type;
+    using res2Ty = typename OpT::state_t::second_type;
+
+    const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_cp) +
+                          iter_arg_offset + reduction_arg_offset;
+    res1Ty *res1_tp = reinterpret_cast<res1Ty *>(res1_cp) + iter_res_offset;
+    res2Ty *res2_tp = reinterpret_cast<res2Ty *>(res2_cp) + iter_res_offset;
+
+    using NoOpIndexerT = dpctl::tensor::offset_utils::NoOpIndexer;
+    using ReductionIndexerT = dpctl::tensor::offset_utils::Strided1DIndexer;
+
+    static constexpr NoOpIndexerT inp_iter_indexer{};
+    static constexpr NoOpIndexerT res_iter_indexer{};
+    const ReductionIndexerT reduction_indexer{/* size */ reduction_nelems,
+                                              /* step */ iter_nelems};
+
+    return multi_output_over_group_temps_impl<argTy, OpT>(
+        exec_q, iter_nelems, reduction_nelems, arg_tp, res1_tp, res2_tp,
+        inp_iter_indexer, res_iter_indexer, reduction_indexer, depends);
+}
+
 } // namespace kernels
 } // namespace tensor
 } // namespace dpctl
@@ -0,0 +1,893 @@
+//=== segment_reduce.hpp - Implementation of segmented reductions -*-C++-*-===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels for reductions over segments of a vector
+/// delimited by CSR-style offsets.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <sycl/sycl.hpp>
+#include <type_traits>
+#include <vector>
+
+#include "dpctl_tensor_types.hpp"
+#include "kernels/reductions.hpp"
+#include "utils/sycl_alloc_utils.hpp"
+#include "utils/sycl_utils.hpp"
+#include "utils/type_utils.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+namespace segment_reduce
+{
+
+using dpctl::tensor::ssize_t;
+using dpctl::tensor::kernels::can_use_reduce_over_group;
+namespace su_ns = dpctl::tensor::sycl_utils;
+
+namespace detail
+{
+
+template <typename T> bool is_nan(const T &v)
+{
+    using dpctl::tensor::type_utils::is_complex;
+    if constexpr (is_complex<T>::value) {
+        return std::isnan(std::real(v)) || std::isnan(std::imag(v));
+    }
+    else if constexpr (std::is_floating_point_v<T> ||
+                       std::is_same_v<T, sycl::half>)
+    {
+        return std::isnan(v);
+    }
+    else {
+        return false;
+    }
+}
+
+/*! @brief Reduces `val` over sub-group `sg`, the result is returned to all
+ *  work-items of the sub-group */
+template <typename T, typename OpT>
+T reduce_over_sub_group(const sycl::sub_group &sg,
+                        const T &val,
+                        const T &identity,
+                        const OpT &op)
+{
+    if constexpr (can_use_reduce_over_group<OpT, T>::value) {
+        return sycl::reduce_over_group(sg, val, identity, op);
+    }
+    else {
+        const std::uint32_t lane_id = sg.get_local_linear_id();
+        const std::uint32_t sg_size = sg.get_local_linear_range();
+
+        // after the step, lane `i` holds reduction of lanes
+        // [i, min(i + 2 * step, sg_size))
+        T red_val = val;
+        for (std::uint32_t step = 1; step < sg_size; step *= 2) {
+            const bool has_src_lane = (lane_id + step < sg_size);
+            const std::uint32_t src_lane_id =
+                (has_src_lane) ? lane_id + step : lane_id;
+            const T other = sycl::select_from_group(sg, red_val, src_lane_id);
+            if (has_src_lane) {
+                red_val = op(red_val, other);
+            }
+        }
+        return sycl::group_broadcast(sg, red_val, 0);
+    }
+}
+
+/*! @brief Reduces `val` over work-group `wg`, the result is returned to all
+ *  work-items of the work-group */
+template <typename T, typename LocAccT, typename OpT>
+T reduce_over_work_group(const sycl::group<1> &wg,
+                         const LocAccT &local_mem_acc,
+                         const T &val,
+                         const T &identity,
+                         const OpT &op)
+{
+    if constexpr (can_use_reduce_over_group<OpT, T>::value) {
+        return sycl::reduce_over_group(wg, val, identity, op);
+    }
+    else {
+        const T red_val =
+            su_ns::custom_reduce_over_group(wg, local_mem_acc, val, op);
+        // local memory is reused for the next segment
+        sycl::group_barrier(wg, sycl::memory_scope::work_group);
+        return red_val;
+    }
+}
+
+/*! @brief Bounds of segment `seg`, clamped to the input vector so that
+ *  invalid offsets never result in out-of-bounds accesses */
+inline void segment_bounds(const std::int64_t *offsets,
+                           std::size_t seg,
+                           std::size_t n,
+                           std::size_t &start,
+                           std::size_t &stop)
+{
+    const std::int64_t n_ = static_cast<std::int64_t>(n);
+    const std::int64_t start_ = std::clamp<std::int64_t>(offsets[seg], 0, n_);
+    const std::int64_t stop_ =
+        std::clamp<std::int64_t>(offsets[seg + 1], start_, n_);
+
+    start = static_cast<std::size_t>(start_);
+    stop = static_cast<std::size_t>(stop_);
+}
+
+/*! @brief Index of the last segment starting at or before position `pos`
+ *  of the input vector, offsets being non-decreasing */
+inline std::size_t
+find_segment(const std::int64_t *offsets, std::size_t nseg, std::size_t pos)
+{
+    const std::int64_t pos_ = static_cast<std::int64_t>(pos);
+    // the segment is in the range [lo, hi)
+    std::size_t lo = 0;
+    std::size_t hi = nseg;
+    while (hi - lo > 1) {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        if (offsets[mid] <= pos_) {
+            lo = mid;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/*! @brief Slot of the partial result of chunk `chunk_id` for a long
+ *  segment starting at `start`.
+ *
+ * A chunk intersects at most two long segments. At most one of them starts
+ * at or before the first element of the chunk, and uses the first slot. */
+inline std::size_t partial_slot(std::size_t chunk_id,
+                                std::size_t chunk_size,
+                                std::size_t start)
+{
+    return (start > chunk_id * chunk_size) ? 1 : 0;
+}
+
+} // namespace detail
+
+/*
+  Segments longer than a chunk of `chunk_size` elements are reduced in two
+  passes. First, every chunk of the input vector is reduced by a work-group
+  into partial results of the long segments it intersects. A chunk is
+  shorter than these segments, so only the segments containing its first
+  and its last element may be long, and they are found by a binary search
+  of offsets. The partial results are reduced by SegmentReductionFunctor.
+ */
+
+template <typename T, typename ReductionOpT, typename LocalAccessorT>
+class SegmentPartialReductionFunctor
+{
+private:
+    const T *src_ = nullptr;
+    ssize_t src_stride_ = 1;
+    std::size_t n_ = 0;
+    const std::int64_t *offsets_ = nullptr;
+    std::size_t nseg_ = 0;
+    std::size_t chunk_size_ = 1;
+    T *partials_ = nullptr;
+    ReductionOpT reduction_op_;
+    T identity_;
+    LocalAccessorT local_mem_;
+
+public:
+    SegmentPartialReductionFunctor(const T *src,
+                                   ssize_t src_stride,
+                                   std::size_t n,
+                                   const std::int64_t *offsets,
+                                   std::size_t nseg,
+                                   std::size_t chunk_size,
+                                   T *partials,
+                                   const ReductionOpT &reduction_op,
+                                   const T &identity,
+                                   const LocalAccessorT &local_mem)
+        : src_(src), src_stride_(src_stride), n_(n), offsets_(offsets),
+          nseg_(nseg), chunk_size_(chunk_size), partials_(partials),
+          reduction_op_(reduction_op), identity_(identity),
+          local_mem_(local_mem)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        const std::size_t chunk_id = it.get_group(0);
+        const std::size_t chunk_start = chunk_id * chunk_size_;
+        const std::size_t chunk_stop = std::min(chunk_start + chunk_size_, n_);
+        const std::size_t wgs = it.get_local_range(0);
+        const std::size_t lid = it.get_local_linear_id();
+
+        auto wg = it.get_group();
+
+        const std::size_t segs[2] = {
+            detail::find_segment(offsets_, nseg_, chunk_start),
+            detail::find_segment(offsets_, nseg_, chunk_stop - 1)};
+
+        for (std::size_t k = 0; k < 2; ++k) {
+            std::size_t start, stop;
+            detail::segment_bounds(offsets_, segs[k], n_, start, stop);
+            if (stop - start <= chunk_size_ || (k == 1 && segs[1] == segs[0]))
+            {
+                continue;
+            }
+
+            T local_val = identity_;
+            const std::size_t lo = std::max(start, chunk_start);
+            const std::size_t hi = std::min(stop, chunk_stop);
+            for (std::size_t i = lo + lid; i < hi; i += wgs) {
+                const ssize_t src_offset =
+                    static_cast<ssize_t>(i) * src_stride_;
+                local_val = reduction_op_(local_val, src_[src_offset]);
+            }
+            const T red_val = detail::reduce_over_work_group(
+                wg, local_mem_, local_val, identity_, reduction_op_);
+            if (lid == 0) {
+                const std::size_t partial_id =
+                    2 * chunk_id +
+                    detail::partial_slot(chunk_id, chunk_size_, start);
+                partials_[partial_id] = red_val;
+            }
+        }
+    }
+};
+
+/*
+  Each work-group handles a block of consecutive segments. Segments not longer
+  than the work-group are distributed among its sub-groups, each sub-group
+  reducing one segment at a time. Longer segments are then reduced one at a
+  time by the whole work-group, from partial results of their chunks if they
+  are longer than a chunk.
+ */
+
+template <typename T, typename ReductionOpT, typename LocalAccessorT>
+class SegmentReductionFunctor
+{
+private:
+    const T *src_ = nullptr;
+    ssize_t src_stride_ = 1;
+    std::size_t n_ = 0;
+    const std::int64_t *offsets_ = nullptr;
+    T *dst_ = nullptr;
+    std::size_t nseg_ = 0;
+    std::size_t segs_per_group_ = 1;
+    std::size_t chunk_size_ = 1;
+    const T *partials_ = nullptr;
+    ReductionOpT reduction_op_;
+    T identity_;
+    LocalAccessorT local_mem_;
+
+public:
+    SegmentReductionFunctor(const T *src,
+                            ssize_t src_stride,
+                            std::size_t n,
+                            const std::int64_t *offsets,
+                            T *dst,
+                            std::size_t nseg,
+                            std::size_t segs_per_group,
+                            std::size_t chunk_size,
+                            const T *partials,
+                            const ReductionOpT &reduction_op,
+                            const T &identity,
+                            const LocalAccessorT &local_mem)
+        : src_(src), src_stride_(src_stride), n_(n), offsets_(offsets),
+          dst_(dst), nseg_(nseg), segs_per_group_(segs_per_group),
+          chunk_size_(chunk_size), partials_(partials),
+          reduction_op_(reduction_op), identity_(identity),
+          local_mem_(local_mem)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        const std::size_t seg_begin = it.get_group(0) * segs_per_group_;
+        const std::size_t seg_end =
+            std::min(seg_begin + segs_per_group_, nseg_);
+        const std::size_t wgs = it.get_local_range(0);
+
+        auto sg = it.get_sub_group();
+        const std::uint32_t lane_id = sg.get_local_linear_id();
+        const std::uint32_t sg_size = sg.get_local_linear_range();
+
+        for (std::size_t seg = seg_begin + sg.get_group_linear_id();
+             seg < seg_end; seg += sg.get_group_linear_range())
+        {
+            std::size_t start, stop;
+            detail::segment_bounds(offsets_, seg, n_, start, stop);
+            if (stop - start > wgs) {
+                continue;
+            }
+
+            T local_val = identity_;
+            for (std::size_t i = start + lane_id; i < stop; i += sg_size) {
+                const ssize_t src_offset =
+                    static_cast<ssize_t>(i) * src_stride_;
+                local_val = reduction_op_(local_val, src_[src_offset]);
+            }
+            const T red_val = detail::reduce_over_sub_group(
+                sg, local_val, identity_, reduction_op_);
+            if (lane_id == 0) {
+                dst_[seg] = red_val;
+            }
+        }
+
+        auto wg = it.get_group();
+        const std::size_t lid = it.get_local_linear_id();
+
+        for (std::size_t seg = seg_begin; seg < seg_end; ++seg) {
+            std::size_t start, stop;
+            detail::segment_bounds(offsets_, seg, n_, start, stop);
+            if (stop - start <= wgs) {
+                continue;
+            }
+
+            T local_val = identity_;
+            if (stop - start > chunk_size_) {
+                const std::size_t first_chunk = start / chunk_size_;
+                const std::size_t last_chunk = (stop - 1) / chunk_size_;
+                for (std::size_t chunk_id = first_chunk + lid;
+                     chunk_id <= last_chunk; chunk_id += wgs)
+                {
+                    const std::size_t partial_id =
+                        2 * chunk_id +
+                        detail::partial_slot(chunk_id, chunk_size_, start);
+                    local_val =
+                        reduction_op_(local_val, partials_[partial_id]);
+                }
+            }
+            else {
+                for (std::size_t i = start + lid; i < stop; i += wgs) {
+                    const ssize_t src_offset =
+                        static_cast<ssize_t>(i) * src_stride_;
+                    local_val = reduction_op_(local_val, src_[src_offset]);
+                }
+            }
+            const T red_val = detail::reduce_over_work_group(
+                wg, local_mem_, local_val, identity_, reduction_op_);
+            if (lid == 0) {
+                dst_[seg] = red_val;
+            }
+        }
+    }
+};
+
+namespace detail
+{
+
+/*! @brief Updates extremum `local_val` found at index `local_idx` with
+ *  value `val` found at index `idx`, preferring the smallest index among
+ *  equal values and propagating NaNs */
+template <typename T, typename outT, typename ReductionOpT>
+void search_update(const ReductionOpT &reduction_op,
+                   T &local_val,
+                   outT &local_idx,
+                   const T &val,
+                   const outT &idx)
+{
+    if (val == local_val) {
+        local_idx = std::min(local_idx, idx);
+    }
+    else if (!is_nan(local_val) &&
+             (is_nan(val) || reduction_op(local_val, val) == val))
+    {
+        local_val = val;
+        local_idx = idx;
+    }
+}
+
+/*! @brief Index held by a work-item after reduction of values to `red_val`,
+ *  or `idx_identity` if the work-item does not hold the extremum */
+template <typename T, typename outT>
+outT search_select_idx(const T &red_val,
+                       const T &local_val,
+                       const outT &local_idx,
+                       const outT &idx_identity)
+{
+    // equality does not hold for NaNs, so check here
+    return (red_val == local_val || is_nan(local_val)) ? local_idx
+                                                       : idx_identity;
+}
+
+} // namespace detail
+
+/*
+  Same work assignment as SegmentPartialReductionFunctor, partial results
+  are pairs of the extremum and the index of its first occurrence.
+ */
+
+template <typename T,
+          typename outT,
+          typename ReductionOpT,
+          typename LocalAccessorT>
+class SegmentPartialSearchReductionFunctor
+{
+private:
+    const T *src_ = nullptr;
+    ssize_t src_stride_ = 1;
+    std::size_t n_ = 0;
+    const std::int64_t *offsets_ = nullptr;
+    std::size_t nseg_ = 0;
+    std::size_t chunk_size_ = 1;
+    T *partial_vals_ = nullptr;
+    outT *partial_idxs_ = nullptr;
+    ReductionOpT reduction_op_;
+    T identity_;
+    LocalAccessorT local_mem_;
+
+    static constexpr outT idx_identity_ = std::numeric_limits<outT>::max();
+
+public:
+    SegmentPartialSearchReductionFunctor(const T *src,
+                                         ssize_t src_stride,
+                                         std::size_t n,
+                                         const std::int64_t *offsets,
+                                         std::size_t nseg,
+                                         std::size_t chunk_size,
+                                         T *partial_vals,
+                                         outT *partial_idxs,
+                                         const ReductionOpT &reduction_op,
+                                         const T &identity,
+                                         const LocalAccessorT &local_mem)
+        : src_(src), src_stride_(src_stride), n_(n), offsets_(offsets),
+          nseg_(nseg), chunk_size_(chunk_size), partial_vals_(partial_vals),
+          partial_idxs_(partial_idxs), reduction_op_(reduction_op),
+          identity_(identity), local_mem_(local_mem)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        const std::size_t chunk_id = it.get_group(0);
+        const std::size_t chunk_start = chunk_id * chunk_size_;
+        const std::size_t chunk_stop = std::min(chunk_start + chunk_size_, n_);
+        const std::size_t wgs = it.get_local_range(0);
+        const std::size_t lid = it.get_local_linear_id();
+
+        auto wg = it.get_group();
+
+        const std::size_t segs[2] = {
+            detail::find_segment(offsets_, nseg_, chunk_start),
+            detail::find_segment(offsets_, nseg_, chunk_stop - 1)};
+
+        for (std::size_t k = 0; k < 2; ++k) {
+            std::size_t start, stop;
+            detail::segment_bounds(offsets_, segs[k], n_, start, stop);
+            if (stop - start <= chunk_size_ || (k == 1 && segs[1] == segs[0]))
+            {
+                continue;
+            }
+
+            T local_val = identity_;
+            outT local_idx = idx_identity_;
+            const std::size_t lo = std::max(start, chunk_start);
+            const std::size_t hi = std::min(stop, chunk_stop);
+            for (std::size_t i = lo + lid; i < hi; i += wgs) {
+                const ssize_t src_offset =
+                    static_cast<ssize_t>(i) * src_stride_;
+                detail::search_update(reduction_op_, local_val, local_idx,
+                                      src_[src_offset], static_cast<outT>(i));
+            }
+            const T red_val = detail::reduce_over_work_group(
+                wg, local_mem_, local_val, identity_, reduction_op_);
+            const outT red_idx = sycl::reduce_over_group(
+                wg,
+                detail::search_select_idx(red_val, local_val, local_idx,
+                                          idx_identity_),
+                idx_identity_, sycl::minimum<outT>());
+            if (lid == 0) {
+                const std::size_t partial_id =
+                    2 * chunk_id +
+                    detail::partial_slot(chunk_id, chunk_size_, start);
+                partial_vals_[partial_id] = red_val;
+                partial_idxs_[partial_id] = red_idx;
+            }
+        }
+    }
+};
+
+/*
+  Same work assignment as SegmentReductionFunctor. Indices of the first
+  occurrence of the extremum are found by reducing values first, and then
+  reducing indices of work-items holding the extremum, as in SearchReduction.
+  NaNs are propagated, so the index of the first NaN is found if any. Empty
+  segments are assigned index -1.
+ */
+
+template <typename T,
+          typename outT,
+          typename ReductionOpT,
+          typename LocalAccessorT>
+class SegmentSearchReductionFunctor
+{
+private:
+    const T *src_ = nullptr;
+    ssize_t src_stride_ = 1;
+    std::size_t n_ = 0;
+    const std::int64_t *offsets_ = nullptr;
+    outT *dst_ = nullptr;
+    std::size_t nseg_ = 0;
+    std::size_t segs_per_group_ = 1;
+    std::size_t chunk_size_ = 1;
+    const T *partial_vals_ = nullptr;
+    const outT *partial_idxs_ = nullptr;
+    ReductionOpT reduction_op_;
+    T identity_;
+    LocalAccessorT local_mem_;
+
+    static constexpr outT idx_identity_ = std::numeric_limits<outT>::max();
+
+    void update(T &local_val, outT &local_idx, std::size_t i) const
+    {
+        const T val = src_[static_cast<ssize_t>(i) * src_stride_];
+        detail::search_update(reduction_op_, local_val, local_idx, val,
+                              static_cast<outT>(i));
+    }
+
+public:
+    SegmentSearchReductionFunctor(const T *src,
+                                  ssize_t src_stride,
+                                  std::size_t n,
+                                  const std::int64_t *offsets,
+                                  outT *dst,
+                                  std::size_t nseg,
+                                  std::size_t segs_per_group,
+                                  std::size_t chunk_size,
+                                  const T *partial_vals,
+                                  const outT *partial_idxs,
+                                  const ReductionOpT &reduction_op,
+                                  const T &identity,
+                                  const LocalAccessorT &local_mem)
+        : src_(src), src_stride_(src_stride), n_(n), offsets_(offsets),
+          dst_(dst), nseg_(nseg), segs_per_group_(segs_per_group),
+          chunk_size_(chunk_size), partial_vals_(partial_vals),
+          partial_idxs_(partial_idxs), reduction_op_(reduction_op),
+          identity_(identity), local_mem_(local_mem)
+    {
+    }
+
+    void operator()(sycl::nd_item<1> it) const
+    {
+        const std::size_t seg_begin = it.get_group(0) * segs_per_group_;
+        const std::size_t seg_end =
+            std::min(seg_begin + segs_per_group_, nseg_);
+        const std::size_t wgs = it.get_local_range(0);
+
+        auto sg = it.get_sub_group();
+        const std::uint32_t lane_id = sg.get_local_linear_id();
+        const std::uint32_t sg_size = sg.get_local_linear_range();
+
+        for (std::size_t seg = seg_begin + sg.get_group_linear_id();
+             seg < seg_end; seg += sg.get_group_linear_range())
+        {
+            std::size_t start, stop;
+            detail::segment_bounds(offsets_, seg, n_, start, stop);
+            if (stop - start > wgs) {
+                continue;
+            }
+
+            T local_val = identity_;
+            outT local_idx = idx_identity_;
+            for (std::size_t i = start + lane_id; i < stop; i += sg_size) {
+                update(local_val, local_idx, i);
+            }
+            const T red_val = detail::reduce_over_sub_group(
+                sg, local_val, identity_, reduction_op_);
+            const outT red_idx = sycl::reduce_over_group(
+                sg,
+                detail::search_select_idx(red_val, local_val, local_idx,
+                                          idx_identity_),
+                idx_identity_, sycl::minimum<outT>());
+            if (lane_id == 0) {
+                dst_[seg] = (stop > start) ? red_idx : outT(-1);
+            }
+        }
+
+        auto wg = it.get_group();
+        const std::size_t lid = it.get_local_linear_id();
+
+        for (std::size_t seg = seg_begin; seg < seg_end; ++seg) {
+            std::size_t start, stop;
+            detail::segment_bounds(offsets_, seg, n_, start, stop);
+            if (stop - start <= wgs) {
+                continue;
+            }
+
+            T local_val = identity_;
+            outT local_idx = idx_identity_;
+            if (stop - start > chunk_size_) {
+                const std::size_t first_chunk = start / chunk_size_;
+                const std::size_t last_chunk = (stop - 1) / chunk_size_;
+                for (std::size_t chunk_id = first_chunk + lid;
+                     chunk_id <= last_chunk; chunk_id += wgs)
+                {
+                    const std::size_t partial_id =
+                        2 * chunk_id +
+                        detail::partial_slot(chunk_id, chunk_size_, start);
+                    detail::search_update(reduction_op_, local_val, local_idx,
+                                          partial_vals_[partial_id],
+                                          partial_idxs_[partial_id]);
+                }
+            }
+            else {
+                for (std::size_t i = start + lid; i < stop; i += wgs) {
+                    update(local_val, local_idx, i);
+                }
+            }
+            const T red_val = detail::reduce_over_work_group(
+                wg, local_mem_, local_val, identity_, reduction_op_);
+            const outT red_idx = sycl::reduce_over_group(
+                wg,
+                detail::search_select_idx(red_val, local_val, local_idx,
+                                          idx_identity_),
+                idx_identity_, sycl::minimum<outT>());
+            if (lid == 0) {
+                dst_[seg] = red_idx;
+            }
+        }
+    }
+};
+
+template <typename T, typename ReductionOpT> class segment_reduction_krn;
+
+template <typename T, typename ReductionOpT>
+class segment_partial_reduction_krn;
+
+template <typename T, typename outT, typename ReductionOpT>
+class segment_search_reduction_krn;
+
+template <typename T, typename outT, typename ReductionOpT>
+class segment_partial_search_reduction_krn;
+
+namespace detail
+{
+
+struct SegmentLaunchParams
+{
+    std::size_t wg_size;
+    std::size_t segs_per_group;
+    std::size_t n_groups;
+    std::size_t chunk_size;
+    std::size_t n_chunks;
+};
+
+inline SegmentLaunchParams segment_launch_params(const sycl::queue &exec_q,
+                                                 std::size_t n,
+                                                 std::size_t nseg)
+{
+    const auto &dev = exec_q.get_device();
+    const std::size_t max_wg_size =
+        dev.get_info<sycl::info::device::max_work_group_size>();
+    const std::size_t wg_size = std::min<std::size_t>(max_wg_size, 256);
+
+    // use the largest sub-group size to not overestimate the number of
+    // sub-groups, each sub-group is given a few short segments
+    const auto &sg_sizes = dev.get_info<sycl::info::device::sub_group_sizes>();
+    const std::size_t max_sg_size =
+        *std::max_element(std::begin(sg_sizes), std::end(sg_sizes));
+    const std::size_t n_sgs = std::max<std::size_t>(1, wg_size / max_sg_size);
+    const std::size_t segs_per_group = 4 * n_sgs;
+
+    const std::size_t n_groups = (nseg + segs_per_group - 1) / segs_per_group;
+
+    // segments longer than a chunk are split among work-groups, no segment
+    // is that long unless the input vector is
+    static constexpr std::size_t reductions_per_wi = 16;
+    const std::size_t chunk_size = wg_size * reductions_per_wi;
+    const std::size_t n_chunks =
+        (n > chunk_size) ? (n + chunk_size - 1) / chunk_size : 0;
+
+    return SegmentLaunchParams{wg_size, segs_per_group, n_groups, chunk_size,
+                               n_chunks};
+}
+
+template <typename T, typename ReductionOpT>
+constexpr std::size_t segment_local_mem_size(std::size_t wg_size)
+{
+    // local memory is only used by custom work-group reductions
+    return (can_use_reduce_over_group<ReductionOpT, T>::value) ? 1 : wg_size;
+}
+
+} // namespace detail
+
+typedef sycl::event (*segment_reduction_fn_ptr_t)(
+    sycl::queue &,
+    std::size_t,
+    const char *,
+    ssize_t,
+    std::size_t,
+    const char *,
+    char *,
+    const std::vector<sycl::event> &);
+
+template <typename T, typename ReductionOpT>
+sycl::event segment_reduction_impl(sycl::queue &exec_q,
+                                   std::size_t n,
+                                   const char *src_cp,
+                                   ssize_t src_stride,
+                                   std::size_t nseg,
+                                   const char *offsets_cp,
+                                   char *dst_cp,
+                                   const std::vector<sycl::event> &depends)
+{
+    const T *src = reinterpret_cast<const T *>(src_cp);
+    const std::int64_t *offsets =
+        reinterpret_cast<const std::int64_t *>(offsets_cp);
+    T *dst = reinterpret_cast<T *>(dst_cp);
+
+    const auto &params = detail::segment_launch_params(exec_q, n, nseg);
+    const std::size_t wg_size = params.wg_size;
+    const std::size_t segs_per_group = params.segs_per_group;
+    const std::size_t n_groups = params.n_groups;
+    const std::size_t chunk_size = params.chunk_size;
+    const std::size_t n_chunks = params.n_chunks;
+
+    static constexpr T identity = su_ns::Identity<ReductionOpT, T>::value;
+
+    using LocalAccessorT = sycl::local_accessor<T, 1>;
+    const std::size_t local_mem_size =
+        detail::segment_local_mem_size<T, ReductionOpT>(wg_size);
+
+    auto submit_reduction = [&](const T *partials,
+                                const std::vector<sycl::event> &deps) {
+        return exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(deps);
+
+            LocalAccessorT local_mem(local_mem_size, cgh);
+
+            using KernelName = segment_reduction_krn<T, ReductionOpT>;
+            using Impl =
+                SegmentReductionFunctor<T, ReductionOpT, LocalAccessorT>;
+
+            cgh.parallel_for<KernelName>(
+                sycl::nd_range<1>(n_groups * wg_size, wg_size),
+                Impl(src, src_stride, n, offsets, dst, nseg, segs_per_group,
+                     chunk_size, partials, ReductionOpT(), identity,
+                     local_mem));
+        });
+    };
+
+    if (n_chunks == 0) {
+        return submit_reduction(nullptr, depends);
+    }
+
+    // two partial results per chunk
+    using dpctl::tensor::alloc_utils::smart_malloc_device;
+    auto partials_owner = smart_malloc_device<T>(2 * n_chunks, exec_q);
+    T *partials = partials_owner.get();
+
+    sycl::event partial_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        LocalAccessorT local_mem(local_mem_size, cgh);
+
+        using KernelName = segment_partial_reduction_krn<T, ReductionOpT>;
+        using Impl =
+            SegmentPartialReductionFunctor<T, ReductionOpT, LocalAccessorT>;
+
+        cgh.parallel_for<KernelName>(
+            sycl::nd_range<1>(n_chunks * wg_size, wg_size),
+            Impl(src, src_stride, n, offsets, nseg, chunk_size, partials,
+                 ReductionOpT(), identity, local_mem));
+    });
+
+    sycl::event comp_ev = submit_reduction(partials, {partial_ev});
+
+    return dpctl::tensor::alloc_utils::async_smart_free(exec_q, {comp_ev},
+                                                        partials_owner);
+}
+
+template <typename T, typename outT, typename ReductionOpT>
+sycl::event
+segment_search_reduction_impl(sycl::queue &exec_q,
+                              std::size_t n,
+                              const char *src_cp,
+                              ssize_t src_stride,
+                              std::size_t nseg,
+                              const char *offsets_cp,
+                              char *dst_cp,
+                              const std::vector<sycl::event> &depends)
+{
+    const T *src = reinterpret_cast<const T *>(src_cp);
+    const std::int64_t *offsets =
+        reinterpret_cast<const std::int64_t *>(offsets_cp);
+    outT *dst = reinterpret_cast<outT *>(dst_cp);
+
+    const auto &params = detail::segment_launch_params(exec_q, n, nseg);
+    const std::size_t wg_size = params.wg_size;
+    const std::size_t segs_per_group = params.segs_per_group;
+    const std::size_t n_groups = params.n_groups;
+    const std::size_t chunk_size = params.chunk_size;
+    const std::size_t n_chunks = params.n_chunks;
+
+    static constexpr T identity = su_ns::Identity<ReductionOpT, T>::value;
+
+    using LocalAccessorT = sycl::local_accessor<T, 1>;
+    const std::size_t local_mem_size =
+        detail::segment_local_mem_size<T, ReductionOpT>(wg_size);
+
+    auto submit_reduction = [&](const T *partial_vals,
+                                const outT *partial_idxs,
+                                const std::vector<sycl::event> &deps) {
+        return exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(deps);
+
+            LocalAccessorT local_mem(local_mem_size, cgh);
+
+            using KernelName =
+                segment_search_reduction_krn<T, outT, ReductionOpT>;
+            using Impl = SegmentSearchReductionFunctor<T, outT, ReductionOpT,
+                                                       LocalAccessorT>;
+
+            cgh.parallel_for<KernelName>(
+                sycl::nd_range<1>(n_groups * wg_size, wg_size),
+                Impl(src, src_stride, n, offsets, dst, nseg, segs_per_group,
+                     chunk_size, partial_vals, partial_idxs, ReductionOpT(),
+                     identity, local_mem));
+        });
+    };
+
+    if (n_chunks == 0) {
+        return submit_reduction(nullptr, nullptr, depends);
+    }
+
+    // two partial results per chunk
+    using dpctl::tensor::alloc_utils::smart_malloc_device;
+    auto partial_vals_owner = smart_malloc_device<T>(2 * n_chunks, exec_q);
+    auto partial_idxs_owner = smart_malloc_device<outT>(2 * n_chunks, exec_q);
+    T *partial_vals = partial_vals_owner.get();
+    outT *partial_idxs = partial_idxs_owner.get();
+
+    sycl::event partial_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        LocalAccessorT local_mem(local_mem_size, cgh);
+
+        using KernelName =
+            segment_partial_search_reduction_krn<T, outT, ReductionOpT>;
+        using Impl = SegmentPartialSearchReductionFunctor<T, outT, ReductionOpT,
+                                                          LocalAccessorT>;
+
+        cgh.parallel_for<KernelName>(
+            sycl::nd_range<1>(n_chunks * wg_size, wg_size),
+            Impl(src, src_stride, n, offsets, nseg, chunk_size, partial_vals,
+                 partial_idxs, ReductionOpT(), identity, local_mem));
+    });
+
+    sycl::event comp_ev =
+        submit_reduction(partial_vals, partial_idxs, {partial_ev});
+
+    return dpctl::tensor::alloc_utils::async_smart_free(
+        exec_q, {comp_ev}, partial_vals_owner, partial_idxs_owner);
+}
+
+} // namespace segment_reduce
+} // namespace kernels
+} // namespace tensor
+} // namespace dpctl
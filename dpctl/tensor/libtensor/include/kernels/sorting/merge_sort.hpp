@@ -35,6 +35,7 @@
 #include "kernels/dpctl_tensor_types.hpp"
 #include "kernels/sorting/search_sorted_detail.hpp"
 #include "kernels/sorting/sort_utils.hpp"
+#include "utils/kernel_launch_cache.hpp"
 
 namespace dpctl
 {
@@ -388,19 +389,14 @@ sort_over_work_group_contig_impl(sycl::queue &q,
     using T = typename GetValueType<OutAcc>::value_type;
     using KernelName = sort_over_work_group_contig_krn<inpT, T, Comp>;
 
-    const auto &kernel_id = sycl::get_kernel_id<KernelName>();
-
-    auto const &ctx = q.get_context();
     auto const &dev = q.get_device();
-    auto kb = sycl::get_kernel_bundle<sycl::bundle_state::executable>(
-        ctx, {dev}, {kernel_id});
 
-    auto krn = kb.get_kernel(kernel_id);
+    using dpctl::tensor::sycl_utils::get_kernel_launch_info;
+    const auto &launch_info = get_kernel_launch_info<KernelName>(q);
+    const auto &kb = launch_info.bundle;
 
-    const std::uint32_t max_sg_size = krn.template get_info<
-        sycl::info::kernel_device_specific::max_sub_group_size>(dev);
-    const std::uint64_t device_local_memory_size =
-        dev.get_info<sycl::info::device::local_mem_size>();
+    const std::uint32_t max_sg_size = launch_info.max_sub_group_size;
+    const std::uint64_t device_local_memory_size = launch_info.local_mem_size;
 
     //  leave 512 bytes of local memory for RT
     const std::uint64_t safety_margin = 512;
@@ -40,6 +40,7 @@
 
 #include "kernels/dpctl_tensor_types.hpp"
 #include "kernels/sorting/sort_utils.hpp"
+#include "utils/kernel_launch_cache.hpp"
 #include "utils/sycl_alloc_utils.hpp"
 
 namespace dpctl
@@ -726,17 +727,11 @@ radix_sort_reorder_submit(sycl::queue &exec_q,
 
     const std::size_t no_op_flag_id = n_offsets - 1;
 
-    const auto &kernel_id = sycl::get_kernel_id<KernelName>();
+    using dpctl::tensor::sycl_utils::get_kernel_launch_info;
+    const auto &launch_info = get_kernel_launch_info<KernelName>(exec_q);
+    const auto &kb = launch_info.bundle;
 
-    auto const &ctx = exec_q.get_context();
-    auto const &dev = exec_q.get_device();
-    auto kb = sycl::get_kernel_bundle<sycl::bundle_state::executable>(
-        ctx, {dev}, {kernel_id});
-
-    auto krn = kb.get_kernel(kernel_id);
-
-    const std::uint32_t sg_size = krn.template get_info<
-        sycl::info::kernel_device_specific::max_sub_group_size>(dev);
+    const std::uint32_t sg_size = launch_info.max_sub_group_size;
 
     sycl::event reorder_ev = exec_q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(dependency_events);
@@ -1059,6 +1054,12 @@ struct parallel_radix_sort_iteration_step
 template <typename Names, std::uint16_t... Constants>
 class radix_sort_one_wg_krn;
 
+// Number of rows sorted concurrently by the one-work-group radix sort when
+// temporary values do not fit in local memory. Remaining rows are processed
+// by subsequent kernel submissions.
+static constexpr std::size_t one_wg_radix_sort_max_concurrent_work_groups =
+    128U;
+
 template <typename KernelNameBase,
           std::uint16_t wg_size = 256,
           std::uint16_t block_size = 16,
@@ -1094,11 +1095,9 @@ public:
         using _SortKernelGlob =
             radix_sort_one_wg_krn<KernelNameBase, wg_size, block_size, 2>;
 
-        static constexpr std::size_t max_concurrent_work_groups = 128U;
-
         // Choose this to occupy the entire accelerator
-        const std::size_t n_work_groups =
-            std::min<std::size_t>(n_iters, max_concurrent_work_groups);
+        const std::size_t n_work_groups = std::min<std::size_t>(
+            n_iters, one_wg_radix_sort_max_concurrent_work_groups);
 
         // determine which temporary allocation can be accommodated in SLM
         const auto &SLM_availability =
@@ -1263,17 +1262,12 @@ private:
             const std::size_t n_batches =
                 (n_iters + n_batch_size - 1) / n_batch_size;
 
-            const auto &kernel_id = sycl::get_kernel_id<KernelName>();
+            using dpctl::tensor::sycl_utils::get_kernel_launch_info;
+            const auto &launch_info =
+                get_kernel_launch_info<KernelName>(exec_q);
+            const auto &kb = launch_info.bundle;
 
-            auto const &ctx = exec_q.get_context();
-            auto const &dev = exec_q.get_device();
-            auto kb = sycl::get_kernel_bundle<sycl::bundle_state::executable>(
-                ctx, {dev}, {kernel_id});
-
-            const auto &krn = kb.get_kernel(kernel_id);
-
-            const std::uint32_t krn_sg_size = krn.template get_info<
-                sycl::info::kernel_device_specific::max_sub_group_size>(dev);
+            const std::uint32_t krn_sg_size = launch_info.max_sub_group_size;
 
             // due to a bug in CPU device implementation, an additional
             // synchronization is necessary for short sub-group sizes
@@ -1534,6 +1528,82 @@ private:
 
 template <typename ValueT, typename ProjT> struct OneWorkGroupRadixSortKernel;
 
+//-----------------------------------------------------------------------
+// radix sort: selection of strategy
+//-----------------------------------------------------------------------
+
+enum class radix_sort_strategy
+{
+    // each row is sorted by a single work-group, see subgroup_radix_sort
+    one_work_group_per_row,
+    // all rows are sorted together by a sequence of count, scan and reorder
+    // passes, with every row split into segments, each having its own
+    // histogram and being processed by its own work-group
+    segmented
+};
+
+// largest row length sorted by a single work-group
+static constexpr std::size_t one_wg_radix_sort_max_size = 16384;
+
+/*! @brief Work-group size used by parallel_radix_sort_impl to sort rows of
+ *         length `n_to_sort` with a single work-group */
+inline std::size_t one_wg_radix_sort_wg_size(std::size_t n_to_sort)
+{
+    static constexpr std::size_t ref_wg_size = 64;
+
+    if (n_to_sort <= 64) {
+        return ref_wg_size;
+    }
+    else if (n_to_sort <= 1024) {
+        return ref_wg_size * 2;
+    }
+    else if (n_to_sort <= 4096) {
+        return ref_wg_size * 4;
+    }
+    return ref_wg_size * 8;
+}
+
+/*! @brief Selects radix sort strategy for `n_iters` rows of length
+ *         `n_to_sort`.
+ *
+ * Rows are sorted by one work-group each if that work-group can keep the
+ * row and its counters in local memory, or if all rows can be processed by
+ * a single kernel submission. Otherwise rows would be sorted in global
+ * memory in batches of `one_wg_radix_sort_max_concurrent_work_groups`
+ * rows, leaving most of the device idle, so all rows are instead sorted
+ * by segmented passes.
+ */
+template <typename ValueT>
+radix_sort_strategy select_radix_sort_strategy(const sycl::device &dev,
+                                               std::size_t n_iters,
+                                               std::size_t n_to_sort,
+                                               std::uint32_t radix_bits)
+{
+    const std::size_t max_wg_size =
+        dev.template get_info<sycl::info::device::max_work_group_size>();
+    const std::size_t one_wg_size = one_wg_radix_sort_wg_size(n_to_sort);
+
+    if (n_to_sort > one_wg_radix_sort_max_size || one_wg_size > max_wg_size) {
+        return radix_sort_strategy::segmented;
+    }
+    if (n_iters <= one_wg_radix_sort_max_concurrent_work_groups) {
+        return radix_sort_strategy::one_work_group_per_row;
+    }
+
+    // same estimate of local memory use as in subgroup_radix_sort
+    const std::size_t max_slm_size =
+        dev.template get_info<sycl::info::device::local_mem_size>() / 2;
+    const std::size_t radix_states = std::size_t(1) << radix_bits;
+    const std::size_t counters_bytes =
+        (one_wg_size * radix_states + 1) * sizeof(std::uint16_t);
+    const std::size_t values_bytes =
+        sizeof(ValueT) * (std::size_t(1) << ceil_log2(n_to_sort));
+
+    return (values_bytes + counters_bytes <= max_slm_size)
+               ? radix_sort_strategy::one_work_group_per_row
+               : radix_sort_strategy::segmented;
+}
+
 //-----------------------------------------------------------------------
 // radix sort: main function
 //-----------------------------------------------------------------------
@@ -1562,8 +1632,11 @@ sycl::event parallel_radix_sort_impl(sycl::queue &exec_q,
     const auto max_wg_size =
         dev.template get_info<sycl::info::device::max_work_group_size>();
 
+    const radix_sort_strategy strategy = select_radix_sort_strategy<ValueT>(
+        dev, n_iters, n_to_sort, radix_bits);
+
     static constexpr std::uint16_t ref_wg_size = 64;
-    if (n_to_sort <= 16384 && ref_wg_size * 8 <= max_wg_size) {
+    if (strategy == radix_sort_strategy::one_work_group_per_row) {
         using _RadixSortKernel = OneWorkGroupRadixSortKernel<ValueT, ProjT>;
 
         if (n_to_sort <= 64 && ref_wg_size <= max_wg_size) {
@@ -1669,8 +1742,11 @@ sycl::event parallel_radix_sort_impl(sycl::queue &exec_q,
         const auto wg_sz_k = (n_to_sort < bound_512k)  ? 8
                              : (n_to_sort <= bound_2m) ? 4
                                                        : 1;
+        // number of elements in a segment of a row
         const std::size_t wg_size = max_wg_size / wg_sz_k;
 
+        // rows of all iterations are processed by the same kernel
+        // submissions, each (row, segment) pair by its own work-group
         const std::size_t n_segments = (n_to_sort + wg_size - 1) / wg_size;
 
         // Additional radix_states elements are used for getting local offsets
@@ -40,6 +40,7 @@
 #include "kernels/sorting/radix_sort.hpp"
 #include "kernels/sorting/search_sorted_detail.hpp"
 #include "kernels/sorting/sort_utils.hpp"
+#include "utils/kernel_launch_cache.hpp"
 #include "utils/sycl_alloc_utils.hpp"
 
 namespace dpctl
@@ -231,20 +232,16 @@ sycl::event topk_merge_impl(
         using PartialKernelName =
             topk_over_work_group_krn<IndexTy, IndexTy, ValueComp>;
 
-        const auto &kernel_id = sycl::get_kernel_id<PartialKernelName>();
-
-        auto const &ctx = exec_q.get_context();
         auto const &dev = exec_q.get_device();
 
-        auto kb = sycl::get_kernel_bundle<sycl::bundle_state::executable>(
-            ctx, {dev}, {kernel_id});
-
-        auto krn = kb.get_kernel(kernel_id);
+        using dpctl::tensor::sycl_utils::get_kernel_launch_info;
+        const auto &launch_info =
+            get_kernel_launch_info<PartialKernelName>(exec_q);
+        const auto &kb = launch_info.bundle;
 
-        const std::uint32_t max_sg_size = krn.template get_info<
-            sycl::info::kernel_device_specific::max_sub_group_size>(dev);
+        const std::uint32_t max_sg_size = launch_info.max_sub_group_size;
         const std::uint64_t device_local_memory_size =
-            dev.get_info<sycl::info::device::local_mem_size>();
+            launch_info.local_mem_size;
 
         //  leave 512 bytes of local memory for RT
         const std::uint64_t safety_margin = 512;
@@ -500,6 +497,417 @@ sycl::event topk_radix_impl(sycl::queue &exec_q,
     return cleanup_ev;
 }
 
+//-----------------------------------------------------------------------
+// top k by radix select
+//-----------------------------------------------------------------------
+
+/*! @brief Whether top k elements of rows of length `axis_nelems` are to be
+ *         found by radix select rather than by sorting rows */
+inline bool use_topk_radix_select(std::size_t axis_nelems, std::size_t k)
+{
+    static constexpr std::size_t min_axis_nelems = 4096;
+    static constexpr std::size_t max_axis_nelems =
+        std::numeric_limits<std::uint32_t>::max();
+
+    return (k > 0) && (axis_nelems >= min_axis_nelems) &&
+           (axis_nelems <= max_axis_nelems) && (k <= axis_nelems / 16);
+}
+
+namespace topk_detail
+{
+
+// number of bits of keys processed by every pass of radix select
+static constexpr std::uint32_t radix_select_bits = 8;
+static constexpr std::uint32_t radix_select_states = std::uint32_t(1)
+                                                     << radix_select_bits;
+
+// every work-group processes a segment of a row
+static constexpr std::size_t radix_select_wg_size = 256;
+static constexpr std::size_t radix_select_segment_size =
+    radix_select_wg_size * 16;
+
+} // namespace topk_detail
+
+template <typename T> class topk_select_init_krn;
+template <typename T, bool is_ascending> class topk_select_histogram_krn;
+template <typename T> class topk_select_pick_krn;
+template <typename T, bool is_ascending> class topk_select_count_krn;
+template <typename T> class topk_select_scan_krn;
+template <typename T1, typename T2, bool is_ascending>
+class topk_select_compact_krn;
+template <typename T1, typename T2> class topk_select_map_back_krn;
+
+namespace topk_detail
+{
+
+template <typename argTy, typename IndexTy, bool is_ascending>
+sycl::event radix_select_impl(sycl::queue &exec_q,
+                              std::size_t iter_nelems,
+                              std::size_t axis_nelems,
+                              std::size_t k,
+                              const char *arg_cp,
+                              char *vals_cp,
+                              char *inds_cp,
+                              const std::vector<sycl::event> &depends)
+{
+    using radix_sort_details::order_preserving_cast;
+    using KeyT = decltype(order_preserving_cast<is_ascending>(argTy{}));
+    using CountT = std::uint32_t;
+
+    static constexpr std::uint32_t radix_bits = radix_select_bits;
+    static constexpr std::uint32_t radix_states = radix_select_states;
+    static constexpr std::uint32_t radix_mask = radix_states - 1;
+    static constexpr std::uint32_t key_bits =
+        radix_sort_details::number_of_bits_in_type<KeyT>();
+    static constexpr std::uint32_t n_passes =
+        (key_bits + radix_bits - 1) / radix_bits;
+    static_assert(key_bits % radix_bits == 0);
+
+    const argTy *arg_tp = reinterpret_cast<const argTy *>(arg_cp);
+    argTy *vals_tp = reinterpret_cast<argTy *>(vals_cp);
+    IndexTy *inds_tp = reinterpret_cast<IndexTy *>(inds_cp);
+
+    static constexpr std::size_t wg_size = radix_select_wg_size;
+    static constexpr std::size_t segment_size = radix_select_segment_size;
+    const std::size_t n_segments =
+        (axis_nelems + segment_size - 1) / segment_size;
+
+    using dpctl::tensor::alloc_utils::smart_malloc_device;
+
+    // per row: digit histogram
+    auto hist_owner =
+        smart_malloc_device<CountT>(iter_nelems * radix_states, exec_q);
+    CountT *hist_tp = hist_owner.get();
+
+    // per row: known leading digits of the k-th key, and the number of
+    // elements equal to the k-th key to be selected
+    auto state_owner =
+        smart_malloc_device<std::uint64_t>(2 * iter_nelems, exec_q);
+    std::uint64_t *state_tp = state_owner.get();
+
+    sycl::event init_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(depends);
+
+        using KernelName = topk_select_init_krn<argTy>;
+        cgh.parallel_for<KernelName>(
+            sycl::range<1>(iter_nelems * radix_states), [=](sycl::id<1> id) {
+                const std::size_t i = id[0];
+                hist_tp[i] = CountT(0);
+                if (i % radix_states == 0) {
+                    const std::size_t iter_id = i / radix_states;
+                    state_tp[2 * iter_id] = std::uint64_t(0);
+                    state_tp[2 * iter_id + 1] = std::uint64_t(k);
+                }
+            });
+    });
+
+    const sycl::nd_range<1> seg_ndRange(
+        sycl::range<1>(iter_nelems * n_segments * wg_size),
+        sycl::range<1>(wg_size));
+
+    sycl::event pass_ev = init_ev;
+    for (std::uint32_t pass = 0; pass < n_passes; ++pass) {
+        const std::uint32_t shift = key_bits - radix_bits * (pass + 1);
+
+        sycl::event hist_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(pass_ev);
+
+            sycl::local_accessor<CountT, 1> local_hist(radix_states, cgh);
+
+            using KernelName = topk_select_histogram_krn<argTy, is_ascending>;
+            cgh.parallel_for<KernelName>(
+                seg_ndRange, [=](sycl::nd_item<1> ndit) {
+                    const std::size_t lid = ndit.get_local_id(0);
+                    const std::size_t group_id = ndit.get_group(0);
+                    const std::size_t iter_id = group_id / n_segments;
+                    const std::size_t seg_id = group_id - iter_id * n_segments;
+
+                    for (std::size_t b = lid; b < radix_states; b += wg_size) {
+                        local_hist[b] = CountT(0);
+                    }
+                    sycl::group_barrier(ndit.get_group());
+
+                    const KeyT prefix =
+                        static_cast<KeyT>(state_tp[2 * iter_id]);
+                    const std::size_t seg_start = seg_id * segment_size;
+                    const std::size_t seg_end =
+                        std::min(seg_start + segment_size, axis_nelems);
+                    const argTy *row_tp = arg_tp + iter_id * axis_nelems;
+
+                    for (std::size_t i = seg_start + lid; i < seg_end;
+                         i += wg_size)
+                    {
+                        const KeyT key =
+                            order_preserving_cast<is_ascending>(row_tp[i]);
+                        // only keys agreeing with the k-th key in leading
+                        // digits found by preceding passes are counted
+                        const bool matches =
+                            (pass == 0) || ((key >> (shift + radix_bits)) ==
+                                            (prefix >> (shift + radix_bits)));
+                        if (matches) {
+                            const std::uint32_t bucket_id =
+                                (key >> shift) & radix_mask;
+                            sycl::atomic_ref<
+                                CountT, sycl::memory_order::relaxed,
+                                sycl::memory_scope::work_group,
+                                sycl::access::address_space::local_space>
+                                bucket_ref(local_hist[bucket_id]);
+                            bucket_ref += CountT(1);
+                        }
+                    }
+                    sycl::group_barrier(ndit.get_group());
+
+                    CountT *row_hist_tp = hist_tp + iter_id * radix_states;
+                    for (std::size_t b = lid; b < radix_states; b += wg_size) {
+                        const CountT c = local_hist[b];
+                        if (c > 0) {
+                            sycl::atomic_ref<
+                                CountT, sycl::memory_order::relaxed,
+                                sycl::memory_scope::device,
+                                sycl::access::address_space::global_space>
+                                bucket_ref(row_hist_tp[b]);
+                            bucket_ref += c;
+                        }
+                    }
+                });
+        });
+
+        pass_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(hist_ev);
+
+            using KernelName = topk_select_pick_krn<argTy>;
+            cgh.parallel_for<KernelName>(
+                sycl::range<1>(iter_nelems), [=](sycl::id<1> id) {
+                    const std::size_t iter_id = id[0];
+                    CountT *row_hist_tp = hist_tp + iter_id * radix_states;
+                    const std::uint64_t k_rem = state_tp[2 * iter_id + 1];
+
+                    // find digit of the k_rem-th smallest key among counted
+                    std::uint64_t n_before = 0;
+                    std::uint32_t digit = 0;
+                    for (; digit + 1 < radix_states; ++digit) {
+                        const std::uint64_t c = row_hist_tp[digit];
+                        if (n_before + c >= k_rem) {
+                            break;
+                        }
+                        n_before += c;
+                    }
+                    state_tp[2 * iter_id] |= (std::uint64_t(digit) << shift);
+                    state_tp[2 * iter_id + 1] = k_rem - n_before;
+
+                    // reset histogram for the next pass
+                    for (std::uint32_t b = 0; b < radix_states; ++b) {
+                        row_hist_tp[b] = CountT(0);
+                    }
+                });
+        });
+    }
+
+    // per (row, segment): numbers of elements smaller than and equal to
+    // the k-th key, replaced by their exclusive prefix sums over segments
+    const std::size_t n_seg_counts = iter_nelems * n_segments;
+    auto seg_counts_owner =
+        smart_malloc_device<std::uint64_t>(2 * n_seg_counts, exec_q);
+    std::uint64_t *lt_counts_tp = seg_counts_owner.get();
+    std::uint64_t *eq_counts_tp = lt_counts_tp + n_seg_counts;
+
+    sycl::event count_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(pass_ev);
+
+        using KernelName = topk_select_count_krn<argTy, is_ascending>;
+        cgh.parallel_for<KernelName>(seg_ndRange, [=](sycl::nd_item<1> ndit) {
+            const std::size_t lid = ndit.get_local_id(0);
+            const std::size_t group_id = ndit.get_group(0);
+            const std::size_t iter_id = group_id / n_segments;
+            const std::size_t seg_id = group_id - iter_id * n_segments;
+
+            const KeyT kth_key = static_cast<KeyT>(state_tp[2 * iter_id]);
+            const std::size_t seg_start = seg_id * segment_size;
+            const std::size_t seg_end =
+                std::min(seg_start + segment_size, axis_nelems);
+            const argTy *row_tp = arg_tp + iter_id * axis_nelems;
+
+            std::uint64_t n_lt = 0;
+            std::uint64_t n_eq = 0;
+            for (std::size_t i = seg_start + lid; i < seg_end; i += wg_size) {
+                const KeyT key = order_preserving_cast<is_ascending>(row_tp[i]);
+                n_lt += (key < kth_key) ? 1 : 0;
+                n_eq += (key == kth_key) ? 1 : 0;
+            }
+
+            const auto &wg = ndit.get_group();
+            n_lt = sycl::reduce_over_group(wg, n_lt, sycl::plus<>());
+            n_eq = sycl::reduce_over_group(wg, n_eq, sycl::plus<>());
+            if (wg.leader()) {
+                lt_counts_tp[group_id] = n_lt;
+                eq_counts_tp[group_id] = n_eq;
+            }
+        });
+    });
+
+    sycl::event scan_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(count_ev);
+
+        const std::size_t scan_wg_size = std::min(n_segments, wg_size);
+        const sycl::nd_range<1> scan_ndRange(
+            sycl::range<1>(2 * iter_nelems * scan_wg_size),
+            sycl::range<1>(scan_wg_size));
+
+        using KernelName = topk_select_scan_krn<argTy>;
+        cgh.parallel_for<KernelName>(
+            scan_ndRange, [=](sycl::nd_item<1> ndit) {
+                // groups scan counts of smaller, then of equal elements
+                std::uint64_t *begin_tp =
+                    lt_counts_tp + ndit.get_group(0) * n_segments;
+                sycl::joint_exclusive_scan(ndit.get_group(), begin_tp,
+                                           begin_tp + n_segments, begin_tp,
+                                           std::uint64_t(0), sycl::plus<>());
+            });
+    });
+
+    // indices of candidates, which are the top k elements of each row
+    auto cands_owner =
+        smart_malloc_device<IndexTy>(2 * iter_nelems * k, exec_q);
+    IndexTy *cands_tp = cands_owner.get();
+    IndexTy *sorted_cands_tp = cands_tp + iter_nelems * k;
+
+    sycl::event compact_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(scan_ev);
+
+        using KernelName =
+            topk_select_compact_krn<argTy, IndexTy, is_ascending>;
+        cgh.parallel_for<KernelName>(seg_ndRange, [=](sycl::nd_item<1> ndit) {
+            const std::size_t lid = ndit.get_local_id(0);
+            const std::size_t group_id = ndit.get_group(0);
+            const std::size_t iter_id = group_id / n_segments;
+            const std::size_t seg_id = group_id - iter_id * n_segments;
+
+            const KeyT kth_key = static_cast<KeyT>(state_tp[2 * iter_id]);
+            const std::uint64_t n_eq_needed = state_tp[2 * iter_id + 1];
+            // elements smaller than the k-th key precede equal ones
+            const std::uint64_t eq_dst_offset = k - n_eq_needed;
+
+            const std::size_t seg_start = seg_id * segment_size;
+            const std::size_t seg_end =
+                std::min(seg_start + segment_size, axis_nelems);
+            const std::size_t row_offset = iter_id * axis_nelems;
+            const argTy *row_tp = arg_tp + row_offset;
+            IndexTy *row_cands_tp = cands_tp + iter_id * k;
+
+            std::uint64_t lt_pos = lt_counts_tp[group_id];
+            std::uint64_t eq_pos = eq_counts_tp[group_id];
+
+            const auto &wg = ndit.get_group();
+            for (std::size_t chunk_start = seg_start; chunk_start < seg_end;
+                 chunk_start += wg_size)
+            {
+                const std::size_t i = chunk_start + lid;
+                bool is_lt = false;
+                bool is_eq = false;
+                if (i < seg_end) {
+                    const KeyT key =
+                        order_preserving_cast<is_ascending>(row_tp[i]);
+                    is_lt = (key < kth_key);
+                    is_eq = (key == kth_key);
+                }
+
+                const std::uint64_t lt_rank = sycl::exclusive_scan_over_group(
+                    wg, std::uint64_t(is_lt), sycl::plus<>());
+                const std::uint64_t eq_rank = sycl::exclusive_scan_over_group(
+                    wg, std::uint64_t(is_eq), sycl::plus<>());
+
+                if (is_lt) {
+                    row_cands_tp[lt_pos + lt_rank] =
+                        static_cast<IndexTy>(row_offset + i);
+                }
+                if (is_eq && (eq_pos + eq_rank < n_eq_needed)) {
+                    row_cands_tp[eq_dst_offset + eq_pos + eq_rank] =
+                        static_cast<IndexTy>(row_offset + i);
+                }
+
+                lt_pos += sycl::reduce_over_group(wg, std::uint64_t(is_lt),
+                                                  sycl::plus<>());
+                eq_pos += sycl::reduce_over_group(wg, std::uint64_t(is_eq),
+                                                  sycl::plus<>());
+            }
+        });
+    });
+
+    // candidates are in order of their positions within groups of smaller
+    // and of equal elements, so stable sort yields order of stable sort
+    // of rows
+    sycl::event sort_ev = compact_ev;
+    const IndexTy *topk_index_tp = cands_tp;
+    if (k > 1) {
+        using IdentityProjT = radix_sort_details::IdentityProj;
+        using IndexedProjT =
+            radix_sort_details::IndexedProj<IndexTy, argTy, IdentityProjT>;
+        const IndexedProjT proj_op{arg_tp};
+
+        sort_ev =
+            radix_sort_details::parallel_radix_sort_impl<IndexTy, IndexedProjT>(
+                exec_q, iter_nelems, k, cands_tp, sorted_cands_tp, proj_op,
+                is_ascending, {compact_ev});
+        topk_index_tp = sorted_cands_tp;
+    }
+
+    using WriteOutKernelName = topk_select_map_back_krn<argTy, IndexTy>;
+
+    sycl::event write_topk_ev =
+        write_out_impl<WriteOutKernelName, argTy, IndexTy>(
+            exec_q, iter_nelems, k, arg_tp, topk_index_tp, k, axis_nelems,
+            vals_tp, inds_tp, {sort_ev});
+
+    sycl::event cleanup_ev = dpctl::tensor::alloc_utils::async_smart_free(
+        exec_q, {write_topk_ev}, hist_owner, state_owner, seg_counts_owner,
+        cands_owner);
+
+    return cleanup_ev;
+}
+
+} // namespace topk_detail
+
+/*!
+ * @brief Finds `k` smallest, if `ascending`, or largest elements of each of
+ * `iter_nelems` contiguous rows of length `axis_nelems`.
+ *
+ * Keys of elements are the bit patterns used by radix sort. The k-th key of
+ * every row is determined digit by digit, from the most significant one, by
+ * computing histograms of digits of keys which agree with it in preceding
+ * digits. Elements preceding the k-th key, and as many elements equal to it
+ * as needed, taken in the order of their positions, are then compacted and
+ * only these `k` candidates are sorted. The result is the same as the one
+ * obtained by stable sorting of rows.
+ */
+template <typename argTy, typename IndexTy>
+sycl::event topk_radix_select_impl(sycl::queue &exec_q,
+                                   std::size_t iter_nelems,
+                                   std::size_t axis_nelems,
+                                   std::size_t k,
+                                   bool ascending,
+                                   const char *arg_cp,
+                                   char *vals_cp,
+                                   char *inds_cp,
+                                   const std::vector<sycl::event> &depends)
+{
+    if (axis_nelems < k) {
+        throw std::runtime_error("Invalid sort axis size for value of k");
+    }
+
+    if (ascending) {
+        return topk_detail::radix_select_impl<argTy, IndexTy,
+                                              /*ascending*/ true>(
+            exec_q, iter_nelems, axis_nelems, k, arg_cp, vals_cp, inds_cp,
+            depends);
+    }
+    else {
+        return topk_detail::radix_select_impl<argTy, IndexTy,
+                                              /*ascending*/ false>(
+            exec_q, iter_nelems, axis_nelems, k, arg_cp, vals_cp, inds_cp,
+            depends);
+    }
+}
+
 } // end of namespace kernels
 } // end of namespace tensor
 } // end of namespace dpctl
@@ -0,0 +1,239 @@
+//=== unique.hpp - Implementation of unique kernels       ---*-C++-*--/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines kernels for computing unique elements of an array,
+/// their counts and inverse indices, without synchronizing with the host.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <sycl/sycl.hpp>
+
+#include "kernels/accumulators.hpp"
+#include "kernels/dpctl_tensor_types.hpp"
+#include "kernels/sorting/radix_sort.hpp"
+#include "utils/sycl_alloc_utils.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace kernels
+{
+
+template <typename T, typename IndexT> class unique_gather_krn;
+template <typename T> class unique_heads_krn;
+template <typename T, typename IndexT> class unique_scatter_krn;
+template <typename IndexT> class unique_counts_krn;
+
+/*! @brief Computes unique elements of contiguous 1D array `src` of size
+ *         `n > 0`.
+ *
+ * Sorted unique elements are written into `values` (of capacity `n`), and
+ * their number is written into device scalar `n_uniques`. If not null,
+ * `counts[j]` is set to the number of occurrences of `values[j]` for
+ * `j < n_uniques[0]`, and `inverse[i]` is set to the position of `src[i]`
+ * in `values`. No synchronization with the host is performed; events of
+ * host tasks releasing temporary allocations are appended to `host_tasks`.
+ */
+typedef sycl::event (*unique_contig_impl_fn_ptr_t)(
+    sycl::queue &,
+    std::size_t,
+    const char *,
+    char *,
+    std::int64_t *,
+    std::int64_t *,
+    std::int64_t *,
+    std::vector<sycl::event> &,
+    const std::vector<sycl::event> &);
+
+template <typename argTy>
+sycl::event unique_contig_impl(sycl::queue &exec_q,
+                               std::size_t n,
+                               const char *src_cp,
+                               char *values_cp,
+                               std::int64_t *counts,
+                               std::int64_t *inverse,
+                               std::int64_t *n_uniques,
+                               std::vector<sycl::event> &host_tasks,
+                               const std::vector<sycl::event> &depends)
+{
+    using IndexT = std::int64_t;
+
+    const argTy *src_tp = reinterpret_cast<const argTy *>(src_cp);
+    argTy *values_tp = reinterpret_cast<argTy *>(values_cp);
+
+    using dpctl::tensor::alloc_utils::smart_malloc_device;
+
+    auto sorted_owner = smart_malloc_device<argTy>(n, exec_q);
+    argTy *sorted_tp = sorted_owner.get();
+
+    // permutation is only needed to compute inverse indices
+    auto perm_owner = smart_malloc_device<IndexT>((inverse) ? n : 1, exec_q);
+    IndexT *perm_tp = perm_owner.get();
+
+    static constexpr bool sort_ascending = true;
+    static constexpr std::size_t iter_nelems = 1;
+
+    sycl::event sort_ev;
+    if (inverse) {
+        sycl::event argsort_ev =
+            radix_argsort_axis1_contig_impl<argTy, IndexT>(
+                exec_q, sort_ascending, iter_nelems, n, src_cp,
+                reinterpret_cast<char *>(perm_tp), 0, 0, 0, 0, depends);
+
+        sort_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(argsort_ev);
+
+            using KernelName = unique_gather_krn<argTy, IndexT>;
+            cgh.parallel_for<KernelName>(
+                sycl::range<1>(n), [=](sycl::id<1> id) {
+                    const std::size_t i = id[0];
+                    sorted_tp[i] = src_tp[perm_tp[i]];
+                });
+        });
+    }
+    else {
+        sort_ev = radix_sort_axis1_contig_impl<argTy>(
+            exec_q, sort_ascending, iter_nelems, n, src_cp,
+            reinterpret_cast<char *>(sorted_tp), 0, 0, 0, 0, depends);
+    }
+
+    // heads[i] is true if sorted[i] starts a run of equal elements
+    auto heads_owner = smart_malloc_device<bool>(n, exec_q);
+    bool *heads_tp = heads_owner.get();
+
+    sycl::event heads_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(sort_ev);
+
+        using KernelName = unique_heads_krn<argTy>;
+        cgh.parallel_for<KernelName>(sycl::range<1>(n), [=](sycl::id<1> id) {
+            const std::size_t i = id[0];
+            heads_tp[i] = (i == 0) || (sorted_tp[i] != sorted_tp[i - 1]);
+        });
+    });
+
+    auto cumsum_owner = smart_malloc_device<IndexT>(n, exec_q);
+    IndexT *cumsum_tp = cumsum_owner.get();
+
+    namespace acc_ns = dpctl::tensor::kernels::accumulators;
+    using NoOpIndexerT = dpctl::tensor::offset_utils::NoOpIndexer;
+    using TransformerT = acc_ns::NonZeroIndicator<bool, IndexT>;
+    using AccumulateOpT = sycl::plus<IndexT>;
+
+    static constexpr NoOpIndexerT flat_indexer{};
+    static constexpr TransformerT transformer{};
+    static constexpr std::size_t s0 = 0;
+    static constexpr std::size_t s1 = 1;
+    static constexpr bool include_initial = false;
+
+    sycl::event scan_ev;
+    const sycl::device &dev = exec_q.get_device();
+    if (dev.has(sycl::aspect::cpu)) {
+        static constexpr acc_ns::nwiT n_wi_for_cpu = 8;
+        const std::uint32_t wg_size = 256;
+        scan_ev = acc_ns::inclusive_scan_iter_1d<
+            bool, IndexT, n_wi_for_cpu, NoOpIndexerT, TransformerT,
+            AccumulateOpT, include_initial>(exec_q, wg_size, n, heads_tp,
+                                            cumsum_tp, s0, s1, flat_indexer,
+                                            transformer, host_tasks,
+                                            {heads_ev});
+    }
+    else {
+        static constexpr acc_ns::nwiT n_wi_for_gpu = 4;
+        // base_scan_striped algorithm does not execute correctly
+        // on HIP device with wg_size > 64
+        const std::uint32_t wg_size =
+            (exec_q.get_backend() == sycl::backend::ext_oneapi_hip) ? 64 : 256;
+        scan_ev = acc_ns::inclusive_scan_iter_1d<
+            bool, IndexT, n_wi_for_gpu, NoOpIndexerT, TransformerT,
+            AccumulateOpT, include_initial>(exec_q, wg_size, n, heads_tp,
+                                            cumsum_tp, s0, s1, flat_indexer,
+                                            transformer, host_tasks,
+                                            {heads_ev});
+    }
+
+    // starts[j] is the position in sorted array of the first occurrence
+    // of the j-th unique element, only needed to compute counts
+    auto starts_owner = smart_malloc_device<IndexT>((counts) ? n : 1, exec_q);
+    IndexT *starts_tp = starts_owner.get();
+
+    sycl::event scatter_ev = exec_q.submit([&](sycl::handler &cgh) {
+        cgh.depends_on(scan_ev);
+
+        const bool compute_starts = (counts != nullptr);
+        const bool compute_inverse = (inverse != nullptr);
+
+        using KernelName = unique_scatter_krn<argTy, IndexT>;
+        cgh.parallel_for<KernelName>(sycl::range<1>(n), [=](sycl::id<1> id) {
+            const std::size_t i = id[0];
+            const IndexT pos = cumsum_tp[i] - 1;
+            if (heads_tp[i]) {
+                values_tp[pos] = sorted_tp[i];
+                if (compute_starts) {
+                    starts_tp[pos] = static_cast<IndexT>(i);
+                }
+            }
+            if (compute_inverse) {
+                inverse[perm_tp[i]] = pos;
+            }
+            if (i + 1 == n) {
+                *n_uniques = pos + 1;
+            }
+        });
+    });
+
+    sycl::event comp_ev = scatter_ev;
+    if (counts) {
+        comp_ev = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(scatter_ev);
+
+            const IndexT n_elems = static_cast<IndexT>(n);
+
+            using KernelName = unique_counts_krn<IndexT>;
+            cgh.parallel_for<KernelName>(
+                sycl::range<1>(n), [=](sycl::id<1> id) {
+                    const IndexT j = static_cast<IndexT>(id[0]);
+                    const IndexT nu = *n_uniques;
+                    if (j < nu) {
+                        const IndexT end =
+                            (j + 1 < nu) ? starts_tp[j + 1] : n_elems;
+                        counts[j] = end - starts_tp[j];
+                    }
+                });
+        });
+    }
+
+    sycl::event cleanup_ev = dpctl::tensor::alloc_utils::async_smart_free(
+        exec_q, {comp_ev}, sorted_owner, perm_owner, heads_owner, cumsum_owner,
+        starts_owner);
+    host_tasks.push_back(cleanup_ev);
+
+    return comp_ev;
+}
+
+} // end of namespace kernels
+} // end of namespace tensor
+} // end of namespace dpctl
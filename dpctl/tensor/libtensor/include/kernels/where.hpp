@@ -275,6 +275,9 @@ typedef sycl::event (*where_strided_impl_fn_ptr_t)(
     ssize_t,
     const std::vector<sycl::event> &);
 
+/*! @brief Submits strided kernel for `where`. For `nd <= max_inline_nd`
+ *  `shape_strides` must be host accessible, and is copied into kernel
+ *  functor at submission, otherwise it must be kernel accessible USM. */
 template <typename T, typename condT>
 sycl::event where_strided_impl(sycl::queue &q,
                                std::size_t nelems,
@@ -298,14 +301,27 @@ sycl::event where_strided_impl(sycl::queue &q,
     sycl::event where_ev = q.submit([&](sycl::handler &cgh) {
         cgh.depends_on(depends);
 
-        const FourOffsets_StridedIndexer indexer{
-            nd, cond_offset, x1_offset, x2_offset, dst_offset, shape_strides};
+        if (nd <= max_inline_nd) {
+            using IndexerT = FourOffsets_InlineStridedIndexer<max_inline_nd>;
+            const IndexerT indexer{nd,        cond_offset, x1_offset,
+                                   x2_offset, dst_offset,  shape_strides};
 
-        cgh.parallel_for<
-            where_strided_kernel<T, condT, FourOffsets_StridedIndexer>>(
-            sycl::range<1>(nelems),
-            WhereStridedFunctor<T, condT, FourOffsets_StridedIndexer>(
-                cond_tp, x1_tp, x2_tp, dst_tp, indexer));
+            cgh.parallel_for<where_strided_kernel<T, condT, IndexerT>>(
+                sycl::range<1>(nelems),
+                WhereStridedFunctor<T, condT, IndexerT>(cond_tp, x1_tp, x2_tp,
+                                                        dst_tp, indexer));
+        }
+        else {
+            const FourOffsets_StridedIndexer indexer{
+                nd,        cond_offset, x1_offset,
+                x2_offset, dst_offset,  shape_strides};
+
+            cgh.parallel_for<
+                where_strided_kernel<T, condT, FourOffsets_StridedIndexer>>(
+                sycl::range<1>(nelems),
+                WhereStridedFunctor<T, condT, FourOffsets_StridedIndexer>(
+                    cond_tp, x1_tp, x2_tp, dst_tp, indexer));
+        }
     });
 
     return where_ev;
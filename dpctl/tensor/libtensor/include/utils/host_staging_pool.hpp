@@ -0,0 +1,142 @@
+//===-- host_staging_pool.hpp - Pool of pinned host buffers -*-C++-*- ----===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines a pool of fixed-size USM-host buffers used to stage
+/// transfers between pageable host memory and USM allocations.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "sycl/sycl.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace alloc_utils
+{
+
+/*! @brief Pool of USM-host (pinned) staging buffers of `buffer_nbytes`
+ *         bytes, kept per SYCL context.
+ *
+ * Buffers are returned to the pool by a host task once the operations
+ * using them complete. At most `max_cached_buffers` idle buffers are kept
+ * per context, buffers in excess are freed.
+ */
+class HostStagingPool
+{
+public:
+    static constexpr std::size_t buffer_nbytes = 4 * 1024 * 1024;
+    static constexpr std::size_t max_cached_buffers = 8;
+
+    HostStagingPool(const HostStagingPool &) = delete;
+    HostStagingPool &operator=(const HostStagingPool &) = delete;
+
+    /*! @brief Returns the process-wide pool */
+    static HostStagingPool &get()
+    {
+        // intentionally never destroyed, since buffers held by the pool can
+        // not be freed after SYCL runtime has been torn down
+        static HostStagingPool *pool = new HostStagingPool{};
+        return *pool;
+    }
+
+    /*! @brief Returns `n` buffers bound to the context of queue `q` */
+    std::vector<char *> acquire(const sycl::queue &q, std::size_t n)
+    {
+        const sycl::context &ctx = q.get_context();
+
+        std::vector<char *> bufs;
+        bufs.reserve(n);
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+
+            auto &free_list = free_buffers_[ctx];
+            while (bufs.size() < n && !free_list.empty()) {
+                bufs.push_back(free_list.back());
+                free_list.pop_back();
+            }
+        }
+
+        while (bufs.size() < n) {
+            char *buf = sycl::malloc_host<char>(buffer_nbytes, q);
+            if (buf == nullptr) {
+                for (char *p : bufs) {
+                    put_back(ctx, p);
+                }
+                throw std::runtime_error(
+                    "Failed to allocate USM-host staging buffer");
+            }
+            bufs.push_back(buf);
+        }
+
+        return bufs;
+    }
+
+    /*! @brief Submits host task returning `bufs` to the pool once all
+     *         events in `depends` complete */
+    sycl::event release(sycl::queue &q,
+                        std::vector<char *> bufs,
+                        const std::vector<sycl::event> &depends)
+    {
+        const sycl::context &ctx = q.get_context();
+
+        return q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(depends);
+            cgh.host_task([this, ctx, bufs = std::move(bufs)]() {
+                for (char *p : bufs) {
+                    put_back(ctx, p);
+                }
+            });
+        });
+    }
+
+private:
+    std::mutex mu_{};
+    std::unordered_map<sycl::context, std::vector<char *>> free_buffers_{};
+
+    HostStagingPool() = default;
+
+    void put_back(const sycl::context &ctx, char *buf)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+
+            auto &free_list = free_buffers_[ctx];
+            if (free_list.size() < max_cached_buffers) {
+                free_list.push_back(buf);
+                return;
+            }
+        }
+        sycl::free(buf, ctx);
+    }
+};
+
+} // end of namespace alloc_utils
+} // end of namespace tensor
+} // end of namespace dpctl
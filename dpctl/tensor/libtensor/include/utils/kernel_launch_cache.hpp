@@ -0,0 +1,176 @@
+//===-- kernel_launch_cache.hpp - Cache of kernel launch info -*-C++-*- ---===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines a cache of executable kernel bundles and of launch
+/// parameters derived from them, so that kernel launchers avoid querying
+/// SYCL runtime on every submission.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+#include <sycl/sycl.hpp>
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace sycl_utils
+{
+
+/*! @brief Executable bundle of a kernel built for a device, and launch
+ *         parameters of the kernel on that device */
+struct KernelLaunchInfo
+{
+    sycl::kernel_bundle<sycl::bundle_state::executable> bundle;
+    sycl::kernel kernel;
+    // maximal sub-group size the kernel may be executed with
+    std::uint32_t max_sub_group_size;
+    // maximal work-group size the kernel may be launched with
+    std::size_t max_work_group_size;
+    // size of local memory of the device in bytes
+    std::size_t local_mem_size;
+};
+
+/*! @brief Thread-safe cache of `KernelLaunchInfo` keyed by context, device
+ *         and kernel id.
+ *
+ * Entries are never evicted; the number of entries is bounded by the number
+ * of kernels compiled into the module times the number of devices used.
+ */
+class KernelLaunchCache
+{
+private:
+    struct Key
+    {
+        sycl::context ctx;
+        sycl::device dev;
+        sycl::kernel_id kernel_id;
+
+        bool operator==(const Key &other) const
+        {
+            return (ctx == other.ctx) && (dev == other.dev) &&
+                   (kernel_id == other.kernel_id);
+        }
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(const Key &key) const
+        {
+            std::size_t h = std::hash<sycl::kernel_id>{}(key.kernel_id);
+            h ^= std::hash<sycl::device>{}(key.dev) + 0x9e3779b9 + (h << 6) +
+                 (h >> 2);
+            h ^= std::hash<sycl::context>{}(key.ctx) + 0x9e3779b9 + (h << 6) +
+                 (h >> 2);
+            return h;
+        }
+    };
+
+    std::mutex mu_{};
+    // references to elements of unordered_map remain valid on rehashing
+    std::unordered_map<Key, KernelLaunchInfo, KeyHash> entries_{};
+    std::atomic<std::size_t> n_hits_{0};
+    std::atomic<std::size_t> n_misses_{0};
+
+    KernelLaunchCache() = default;
+
+public:
+    KernelLaunchCache(const KernelLaunchCache &) = delete;
+    KernelLaunchCache &operator=(const KernelLaunchCache &) = delete;
+
+    /*! @brief Returns the cache shared by all launchers of the module */
+    static KernelLaunchCache &get()
+    {
+        // intentionally never destroyed, since kernel bundles can not be
+        // released after SYCL runtime has been torn down
+        static KernelLaunchCache *cache = new KernelLaunchCache{};
+        return *cache;
+    }
+
+    /*! @brief Returns launch information of kernel `kernel_id` for context
+     *         and device of queue `q`, building the kernel on first use */
+    const KernelLaunchInfo &lookup(const sycl::queue &q,
+                                   const sycl::kernel_id &kernel_id)
+    {
+        Key key{q.get_context(), q.get_device(), kernel_id};
+
+        {
+            std::lock_guard<std::mutex> lock(mu_);
+            const auto &pos = entries_.find(key);
+            if (pos != entries_.end()) {
+                ++n_hits_;
+                return pos->second;
+            }
+        }
+
+        // building the bundle may be slow, do it without holding the lock
+        const sycl::context &ctx = key.ctx;
+        const sycl::device &dev = key.dev;
+        auto kb = sycl::get_kernel_bundle<sycl::bundle_state::executable>(
+            ctx, {dev}, {kernel_id});
+        auto krn = kb.get_kernel(kernel_id);
+
+        const std::uint32_t max_sg_size = krn.template get_info<
+            sycl::info::kernel_device_specific::max_sub_group_size>(dev);
+        const std::size_t max_wg_size = krn.template get_info<
+            sycl::info::kernel_device_specific::work_group_size>(dev);
+        const std::size_t local_mem_size =
+            dev.get_info<sycl::info::device::local_mem_size>();
+
+        std::lock_guard<std::mutex> lock(mu_);
+        ++n_misses_;
+        // if another thread inserted the entry meanwhile, keep that one
+        const auto &pos_inserted = entries_.try_emplace(
+            std::move(key), KernelLaunchInfo{std::move(kb), std::move(krn),
+                                             max_sg_size, max_wg_size,
+                                             local_mem_size});
+        return pos_inserted.first->second;
+    }
+
+    std::size_t get_num_hits() const { return n_hits_.load(); }
+    std::size_t get_num_misses() const { return n_misses_.load(); }
+
+    std::size_t get_num_entries()
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        return entries_.size();
+    }
+};
+
+/*! @brief Returns launch information of kernel `KernelName` for context
+ *         and device of queue `q` */
+template <typename KernelName>
+const KernelLaunchInfo &get_kernel_launch_info(const sycl::queue &q)
+{
+    const auto &kernel_id = sycl::get_kernel_id<KernelName>();
+    return KernelLaunchCache::get().lookup(q, kernel_id);
+}
+
+} // end of namespace sycl_utils
+} // end of namespace tensor
+} // end of namespace dpctl
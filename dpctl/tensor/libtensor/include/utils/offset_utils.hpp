@@ -27,6 +27,8 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cassert>
 #include <cstddef>
 #include <memory> // for std::make_shared, std::unique_ptr
 #include <tuple>
@@ -36,6 +38,7 @@
 #include <sycl/sycl.hpp>
 
 #include "kernels/dpctl_tensor_types.hpp"
+#include "utils/packed_metadata_arena.hpp"
 #include "utils/strided_iters.hpp"
 #include "utils/sycl_alloc_utils.hpp"
 
@@ -130,6 +133,33 @@ device_allocate_and_pack(sycl::queue &q,
     return std::make_tuple(std::move(shape_strides_owner), sz, copy_ev);
 }
 
+/*! @brief Packs vectors into a host vector, e.g. to pass shape and strides
+ *         of arrays with `nd <= max_inline_nd` to kernels by value. */
+template <typename indT, typename... Vs> std::vector<indT> host_pack(Vs &&...vs)
+{
+    std::vector<indT> empty{};
+    return detail::concat(std::move(empty), vs...);
+}
+
+/*! @brief Packs vectors into a device block leased from the metadata arena
+ *         associated with the queue.
+ *
+ *  Unlike `device_allocate_and_pack`, no host_task is submitted: the block
+ *  is reused by the arena once events passed to `Lease::release_after`
+ *  complete, and the copy is skipped if the same content is already cached.
+ */
+template <typename indT, typename... Vs>
+typename dpctl::tensor::alloc_utils::PackedMetadataArena<indT>::Lease
+device_allocate_and_pack_cached(sycl::queue &q, Vs &&...vs)
+{
+    using dpctl::tensor::alloc_utils::get_packed_metadata_arena;
+
+    const std::vector<indT> &packed_shape_strides = host_pack<indT>(vs...);
+
+    auto &arena = get_packed_metadata_arena<indT>(q);
+    return arena.acquire(q, packed_shape_strides);
+}
+
 struct NoOpIndexer
 {
     constexpr NoOpIndexer() {}
@@ -776,6 +806,215 @@ private:
 static_assert(
     sycl::is_device_copyable_v<ThreeOffsets_FixedDimStridedIndexer<1>>);
 
+/*! @brief Largest array dimensionality for which packed shape and strides
+ *  are carried by value in kernel functors, rather than in USM allocation */
+static constexpr int max_inline_nd = 8;
+
+namespace detail
+{
+
+/*! @brief Copy of packed shape and strides for `nd <= max_nd`, with
+ *  `n_arrays` stride vectors, laid out same as in packed USM allocation */
+template <int max_nd, int n_arrays> class InlinePackedShapeStrides
+{
+public:
+    InlinePackedShapeStrides(int nd, ssize_t const *host_packed_shape_strides)
+        : data_{}
+    {
+        assert(nd <= max_nd);
+        std::copy(host_packed_shape_strides,
+                  host_packed_shape_strides + (n_arrays + 1) * nd,
+                  data_.begin());
+    }
+
+    ssize_t const *get() const { return data_.data(); }
+
+private:
+    std::array<ssize_t, (n_arrays + 1) * max_nd> data_;
+};
+
+} // namespace detail
+
+/* @brief Indexer with packed shape and strides of two arrays held by value.
+ * Pointer to packed shape and strides must be host accessible. */
+template <int max_nd = max_inline_nd> struct TwoOffsets_InlineStridedIndexer
+{
+    TwoOffsets_InlineStridedIndexer(int common_nd,
+                                    ssize_t first_offset_,
+                                    ssize_t second_offset_,
+                                    ssize_t const *_host_packed_shape_strides)
+        : nd(common_nd), starting_first_offset(first_offset_),
+          starting_second_offset(second_offset_),
+          shape_strides(common_nd, _host_packed_shape_strides)
+    {
+    }
+
+    TwoOffsets<ssize_t> operator()(ssize_t gid) const
+    {
+        return compute_offsets(gid);
+    }
+
+    TwoOffsets<ssize_t> operator()(std::size_t gid) const
+    {
+        return compute_offsets(static_cast<ssize_t>(gid));
+    }
+
+private:
+    int nd;
+    ssize_t starting_first_offset;
+    ssize_t starting_second_offset;
+    detail::InlinePackedShapeStrides<max_nd, 2> shape_strides;
+
+    TwoOffsets<ssize_t> compute_offsets(ssize_t gid) const
+    {
+        using dpctl::tensor::strides::CIndexer_vector;
+
+        ssize_t const *packed = shape_strides.get();
+
+        CIndexer_vector<ssize_t> _ind(nd);
+        ssize_t relative_first_offset(0);
+        ssize_t relative_second_offset(0);
+        _ind.get_displacement<const ssize_t *, const ssize_t *>(
+            gid,
+            packed,          // shape ptr
+            packed + nd,     // strides ptr
+            packed + 2 * nd, // strides ptr
+            relative_first_offset, relative_second_offset);
+        return TwoOffsets<ssize_t>(
+            starting_first_offset + relative_first_offset,
+            starting_second_offset + relative_second_offset);
+    }
+};
+
+static_assert(sycl::is_device_copyable_v<TwoOffsets_InlineStridedIndexer<>>);
+
+/* @brief Indexer with packed shape and strides of three arrays held by value.
+ * Pointer to packed shape and strides must be host accessible. */
+template <int max_nd = max_inline_nd> struct ThreeOffsets_InlineStridedIndexer
+{
+    ThreeOffsets_InlineStridedIndexer(int common_nd,
+                                      ssize_t first_offset_,
+                                      ssize_t second_offset_,
+                                      ssize_t third_offset_,
+                                      ssize_t const *_host_packed_shape_strides)
+        : nd(common_nd), starting_first_offset(first_offset_),
+          starting_second_offset(second_offset_),
+          starting_third_offset(third_offset_),
+          shape_strides(common_nd, _host_packed_shape_strides)
+    {
+    }
+
+    ThreeOffsets<ssize_t> operator()(ssize_t gid) const
+    {
+        return compute_offsets(gid);
+    }
+
+    ThreeOffsets<ssize_t> operator()(std::size_t gid) const
+    {
+        return compute_offsets(static_cast<ssize_t>(gid));
+    }
+
+private:
+    int nd;
+    ssize_t starting_first_offset;
+    ssize_t starting_second_offset;
+    ssize_t starting_third_offset;
+    detail::InlinePackedShapeStrides<max_nd, 3> shape_strides;
+
+    ThreeOffsets<ssize_t> compute_offsets(ssize_t gid) const
+    {
+        using dpctl::tensor::strides::CIndexer_vector;
+
+        ssize_t const *packed = shape_strides.get();
+
+        CIndexer_vector<ssize_t> _ind(nd);
+        ssize_t relative_first_offset(0);
+        ssize_t relative_second_offset(0);
+        ssize_t relative_third_offset(0);
+        _ind.get_displacement<const ssize_t *, const ssize_t *>(
+            gid,
+            packed,          // shape ptr
+            packed + nd,     // strides ptr
+            packed + 2 * nd, // strides ptr
+            packed + 3 * nd, // strides ptr
+            relative_first_offset, relative_second_offset,
+            relative_third_offset);
+        return ThreeOffsets<ssize_t>(
+            starting_first_offset + relative_first_offset,
+            starting_second_offset + relative_second_offset,
+            starting_third_offset + relative_third_offset);
+    }
+};
+
+static_assert(
+    sycl::is_device_copyable_v<ThreeOffsets_InlineStridedIndexer<>>);
+
+/* @brief Indexer with packed shape and strides of four arrays held by value.
+ * Pointer to packed shape and strides must be host accessible. */
+template <int max_nd = max_inline_nd> struct FourOffsets_InlineStridedIndexer
+{
+    FourOffsets_InlineStridedIndexer(int common_nd,
+                                     ssize_t first_offset_,
+                                     ssize_t second_offset_,
+                                     ssize_t third_offset_,
+                                     ssize_t fourth_offset_,
+                                     ssize_t const *_host_packed_shape_strides)
+        : nd(common_nd), starting_first_offset(first_offset_),
+          starting_second_offset(second_offset_),
+          starting_third_offset(third_offset_),
+          starting_fourth_offset(fourth_offset_),
+          shape_strides(common_nd, _host_packed_shape_strides)
+    {
+    }
+
+    FourOffsets<ssize_t> operator()(ssize_t gid) const
+    {
+        return compute_offsets(gid);
+    }
+
+    FourOffsets<ssize_t> operator()(std::size_t gid) const
+    {
+        return compute_offsets(static_cast<ssize_t>(gid));
+    }
+
+private:
+    int nd;
+    ssize_t starting_first_offset;
+    ssize_t starting_second_offset;
+    ssize_t starting_third_offset;
+    ssize_t starting_fourth_offset;
+    detail::InlinePackedShapeStrides<max_nd, 4> shape_strides;
+
+    FourOffsets<ssize_t> compute_offsets(ssize_t gid) const
+    {
+        using dpctl::tensor::strides::CIndexer_vector;
+
+        ssize_t const *packed = shape_strides.get();
+
+        CIndexer_vector<ssize_t> _ind(nd);
+        ssize_t relative_first_offset(0);
+        ssize_t relative_second_offset(0);
+        ssize_t relative_third_offset(0);
+        ssize_t relative_fourth_offset(0);
+        _ind.get_displacement<const ssize_t *, const ssize_t *>(
+            gid,
+            packed,          // shape ptr
+            packed + nd,     // strides ptr
+            packed + 2 * nd, // strides ptr
+            packed + 3 * nd, // strides ptr
+            packed + 4 * nd, // strides ptr
+            relative_first_offset, relative_second_offset,
+            relative_third_offset, relative_fourth_offset);
+        return FourOffsets<ssize_t>(
+            starting_first_offset + relative_first_offset,
+            starting_second_offset + relative_second_offset,
+            starting_third_offset + relative_third_offset,
+            starting_fourth_offset + relative_fourth_offset);
+    }
+};
+
+static_assert(sycl::is_device_copyable_v<FourOffsets_InlineStridedIndexer<>>);
+
 } // namespace offset_utils
 } // namespace tensor
 } // namespace dpctl
@@ -0,0 +1,394 @@
+//===-- packed_metadata_arena.hpp - Arena for packed metadata  ---*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines an arena of small device allocations used to hold packed
+/// shape/strides metadata of strided kernels. Blocks are recycled once events
+/// of kernels reading them complete, and are looked up by their content, so
+/// that repeated requests for the same metadata skip the host-to-device copy.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <sycl/sycl.hpp>
+
+#include "utils/sycl_alloc_utils.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace alloc_utils
+{
+
+namespace detail
+{
+
+inline bool is_event_complete(const sycl::event &e)
+{
+    static constexpr auto exec_complete =
+        sycl::info::event_command_status::complete;
+
+    const auto status =
+        e.get_info<sycl::info::event::command_execution_status>();
+    return (status == exec_complete);
+}
+
+template <typename indT>
+std::size_t hash_packed_metadata(const std::vector<indT> &packed)
+{
+    // FNV-1a over elements, size is mixed in to separate prefixes
+    std::uint64_t h = 14695981039346656037ULL;
+    static constexpr std::uint64_t prime = 1099511628211ULL;
+
+    h = (h ^ static_cast<std::uint64_t>(packed.size())) * prime;
+    for (const indT &v : packed) {
+        h = (h ^ static_cast<std::uint64_t>(v)) * prime;
+    }
+    return static_cast<std::size_t>(h);
+}
+
+} // namespace detail
+
+/*! @brief Per-(context, device) arena of device blocks holding packed
+ *         shape/strides metadata.
+ *
+ *  Each block keeps a USM-host mirror of its content. The mirror is the
+ *  source of the host-to-device copy, and is used to verify content-hash
+ *  matches. A block may be handed out to several concurrent consumers when
+ *  their metadata coincide, and is only rewritten or freed after all events
+ *  recorded against it have completed.
+ */
+template <typename indT> class PackedMetadataArena
+{
+private:
+    struct Block
+    {
+        std::size_t hash = 0;
+        std::size_t size = 0;
+        std::size_t capacity = 0;
+        indT *dev_ptr = nullptr;
+        indT *host_ptr = nullptr;
+        std::size_t n_leases = 0;
+        sycl::event upload_ev{};
+        std::vector<sycl::event> pending{};
+    };
+
+    using BlockList = std::list<Block>;
+    using BlockIt = typename BlockList::iterator;
+
+    sycl::context ctx_;
+    sycl::device dev_;
+    std::mutex mu_{};
+    // most recently used block is at the front
+    BlockList blocks_{};
+    std::unordered_map<std::size_t, BlockIt> index_{};
+    std::size_t n_hits_ = 0;
+    std::size_t n_misses_ = 0;
+
+    static bool is_idle(Block &blk)
+    {
+        if (blk.n_leases > 0) {
+            return false;
+        }
+        prune_pending(blk);
+        return blk.pending.empty() &&
+               detail::is_event_complete(blk.upload_ev);
+    }
+
+    static void prune_pending(Block &blk)
+    {
+        const auto &it = std::remove_if(blk.pending.begin(), blk.pending.end(),
+                                        detail::is_event_complete);
+        blk.pending.erase(it, blk.pending.end());
+    }
+
+    void unindex(const BlockIt &it)
+    {
+        const auto &pos = index_.find(it->hash);
+        if (pos != index_.end() && pos->second == it) {
+            index_.erase(pos);
+        }
+    }
+
+    void free_block(Block &blk) const
+    {
+        sycl_free_noexcept(blk.dev_ptr, ctx_);
+        sycl_free_noexcept(blk.host_ptr, ctx_);
+        blk.dev_ptr = nullptr;
+        blk.host_ptr = nullptr;
+    }
+
+    static std::size_t block_capacity(std::size_t sz)
+    {
+        std::size_t cap = min_block_elems;
+        while (cap < sz) {
+            cap <<= 1;
+        }
+        return cap;
+    }
+
+    BlockIt allocate_block(std::size_t sz)
+    {
+        const std::size_t cap = block_capacity(sz);
+
+        indT *dev_ptr = sycl::malloc_device<indT>(cap, dev_, ctx_);
+        if (nullptr == dev_ptr) {
+            throw std::runtime_error("Unable to allocate device_memory");
+        }
+        indT *host_ptr = sycl::malloc_host<indT>(cap, ctx_);
+        if (nullptr == host_ptr) {
+            sycl_free_noexcept(dev_ptr, ctx_);
+            throw std::runtime_error("Unable to allocate host_memory");
+        }
+
+        Block blk{};
+        blk.capacity = cap;
+        blk.dev_ptr = dev_ptr;
+        blk.host_ptr = host_ptr;
+
+        blocks_.push_front(std::move(blk));
+        return blocks_.begin();
+    }
+
+    BlockIt find_reusable_block(std::size_t sz)
+    {
+        // scan from the least recently used end
+        for (auto rit = blocks_.rbegin(); rit != blocks_.rend(); ++rit) {
+            if (rit->capacity >= sz && is_idle(*rit)) {
+                BlockIt it = std::prev(rit.base());
+                unindex(it);
+                blocks_.splice(blocks_.begin(), blocks_, it);
+                return blocks_.begin();
+            }
+        }
+        return blocks_.end();
+    }
+
+    void trim_idle_blocks()
+    {
+        auto it = blocks_.end();
+        while (blocks_.size() > max_cached_blocks && it != blocks_.begin()) {
+            --it;
+            if (is_idle(*it)) {
+                unindex(it);
+                free_block(*it);
+                it = blocks_.erase(it);
+            }
+        }
+    }
+
+public:
+    static constexpr std::size_t max_cached_blocks = 256;
+    static constexpr std::size_t min_block_elems = 32;
+
+    /*! @brief Handle to a leased block. Consumer events must be recorded
+     *         with `release_after` so the block is not recycled early. */
+    class Lease
+    {
+    private:
+        PackedMetadataArena<indT> *arena_ = nullptr;
+        BlockIt it_{};
+        const indT *ptr_ = nullptr;
+        sycl::event copy_ev_{};
+
+    public:
+        Lease(PackedMetadataArena<indT> *arena,
+              const BlockIt &it,
+              const sycl::event &copy_ev)
+            : arena_(arena), it_(it), ptr_(it->dev_ptr), copy_ev_(copy_ev)
+        {
+        }
+
+        /*! @brief Lease of a block not owned by an arena */
+        Lease(const indT *ptr, const sycl::event &copy_ev)
+            : ptr_(ptr), copy_ev_(copy_ev)
+        {
+        }
+
+        Lease(const Lease &) = delete;
+        Lease &operator=(const Lease &) = delete;
+
+        Lease(Lease &&other) noexcept
+            : arena_(std::exchange(other.arena_, nullptr)), it_(other.it_),
+              ptr_(other.ptr_), copy_ev_(std::move(other.copy_ev_))
+        {
+        }
+
+        ~Lease()
+        {
+            if (arena_) {
+                arena_->release(it_, {});
+            }
+        }
+
+        const indT *get() const { return ptr_; }
+
+        const sycl::event &get_copy_event() const { return copy_ev_; }
+
+        /*! @brief Return the block to the arena; it stays reserved until
+         *         all events in `depends` complete. */
+        void release_after(const std::vector<sycl::event> &depends)
+        {
+            if (arena_) {
+                arena_->release(it_, depends);
+                arena_ = nullptr;
+            }
+        }
+    };
+
+    PackedMetadataArena(const sycl::context &ctx, const sycl::device &dev)
+        : ctx_(ctx), dev_(dev)
+    {
+    }
+
+    PackedMetadataArena(const PackedMetadataArena &) = delete;
+    PackedMetadataArena &operator=(const PackedMetadataArena &) = delete;
+
+    bool is_associated_with(const sycl::context &ctx,
+                            const sycl::device &dev) const
+    {
+        return (ctx_ == ctx) && (dev_ == dev);
+    }
+
+    /*! @brief Lease a device block holding content of `packed`, copying it
+     *         using `q` unless a block with the same content is cached. */
+    Lease acquire(sycl::queue &q, const std::vector<indT> &packed)
+    {
+        if (queue_is_recording(q)) {
+            return acquire_for_graph(q, packed);
+        }
+
+        const std::size_t sz = packed.size();
+        const std::size_t h = detail::hash_packed_metadata(packed);
+
+        std::lock_guard<std::mutex> lock(mu_);
+
+        const auto &pos = index_.find(h);
+        if (pos != index_.end()) {
+            BlockIt it = pos->second;
+            if (it->size == sz &&
+                std::equal(packed.begin(), packed.end(), it->host_ptr))
+            {
+                ++n_hits_;
+                ++(it->n_leases);
+                blocks_.splice(blocks_.begin(), blocks_, it);
+                return Lease(this, it, it->upload_ev);
+            }
+        }
+
+        ++n_misses_;
+        BlockIt it = find_reusable_block(sz);
+        if (it == blocks_.end()) {
+            it = allocate_block(sz);
+        }
+
+        std::copy(packed.begin(), packed.end(), it->host_ptr);
+        it->upload_ev = q.copy<indT>(it->host_ptr, it->dev_ptr, sz);
+        it->hash = h;
+        it->size = sz;
+        it->n_leases = 1;
+        index_[h] = it;
+
+        trim_idle_blocks();
+
+        return Lease(this, it, it->upload_ev);
+    }
+
+    /*! @brief Lease a block which lives as long as the command graph `q`
+     *         is recording into.
+     *
+     *  Recorded commands are executed on every replay of the graph, so
+     *  arena blocks, which are recycled once their events complete, can
+     *  not be used. The block and its host mirror, which is the source of
+     *  the recorded copy, are owned by a recorded host_task instead.
+     */
+    Lease acquire_for_graph(sycl::queue &q, const std::vector<indT> &packed)
+    {
+        const std::size_t sz = packed.size();
+
+        auto dev_owner = smart_malloc_device<indT>(sz, q);
+        auto host_owner = smart_malloc_host<indT>(sz, q);
+        std::copy(packed.begin(), packed.end(), host_owner.get());
+
+        const indT *dev_ptr = dev_owner.get();
+        sycl::event copy_ev =
+            q.copy<indT>(host_owner.get(), dev_owner.get(), sz);
+        async_smart_free(q, {copy_ev}, dev_owner, host_owner);
+
+        return Lease(dev_ptr, copy_ev);
+    }
+
+    void release(const BlockIt &it, const std::vector<sycl::event> &depends)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+
+        prune_pending(*it);
+        for (const auto &e : depends) {
+            it->pending.push_back(e);
+        }
+        --(it->n_leases);
+    }
+
+    std::size_t get_num_hits() const { return n_hits_; }
+    std::size_t get_num_misses() const { return n_misses_; }
+};
+
+/*! @brief Returns arena associated with context and device of the queue.
+ *
+ *  Registry is intentionally never destroyed: USM must not be freed after
+ *  the SYCL runtime has been torn down at process exit.
+ */
+template <typename indT>
+PackedMetadataArena<indT> &get_packed_metadata_arena(const sycl::queue &q)
+{
+    using ArenaT = PackedMetadataArena<indT>;
+    using RegistryT = std::vector<std::unique_ptr<ArenaT>>;
+
+    static RegistryT *registry = new RegistryT{};
+    static std::mutex *registry_mu = new std::mutex{};
+
+    const sycl::context &ctx = q.get_context();
+    const sycl::device &dev = q.get_device();
+
+    std::lock_guard<std::mutex> lock(*registry_mu);
+    for (const auto &arena : *registry) {
+        if (arena->is_associated_with(ctx, dev)) {
+            return *arena;
+        }
+    }
+    registry->emplace_back(std::make_unique<ArenaT>(ctx, dev));
+    return *(registry->back());
+}
+
+} // end of namespace alloc_utils
+} // end of namespace tensor
+} // end of namespace dpctl
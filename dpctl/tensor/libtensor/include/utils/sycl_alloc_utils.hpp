@@ -29,7 +29,7 @@
 #include <cstddef>     // for std::size_t
 #include <exception>   // for std::exception
 #include <iostream>    // for std::cerr
-#include <memory>      // for std::unique_ptr
+#include <memory>      // for std::unique_ptr, std::shared_ptr
 #include <stdexcept>   // for std::runtime_error
 #include <type_traits> // for std::true_type, std::false_type
 #include <utility>     // for std::move
@@ -175,7 +175,26 @@ struct all_valid_smart_ptrs<Arg, RestArgs...>
 };
 } // end of namespace detail
 
-/*! @brief Submit host_task and transfer ownership from smart pointers to it */
+/*! @brief Returns true if commands submitted to `q` are being recorded into
+ *         a command graph rather than executed */
+inline bool queue_is_recording(const sycl::queue &q)
+{
+#ifdef SYCL_EXT_ONEAPI_GRAPH
+    namespace syclexp = sycl::ext::oneapi::experimental;
+    return q.ext_oneapi_get_state() == syclexp::queue_state::recording;
+#else
+    (void)q;
+    return false;
+#endif
+}
+
+/*! @brief Submit host_task and transfer ownership from smart pointers to it.
+ *
+ *  If `exec_q` is recording into a command graph, the host_task becomes a
+ *  node of the graph executed on every replay, so it must not free the
+ *  allocations. Deleters are then run when the recorded host_task is
+ *  destroyed together with the graph.
+ */
 template <typename... UniquePtrTs>
 sycl::event async_smart_free(sycl::queue &exec_q,
                              const std::vector<sycl::event> &depends,
@@ -197,15 +216,35 @@ sycl::event async_smart_free(sycl::queue &exec_q,
     dels.reserve(n);
     (dels.emplace_back(unique_pointers.get_deleter()), ...);
 
-    sycl::event ht_e = exec_q.submit([&](sycl::handler &cgh) {
-        cgh.depends_on(depends);
+    sycl::event ht_e;
+    if (queue_is_recording(exec_q)) {
+        std::vector<std::shared_ptr<void>> owners;
+        owners.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            owners.emplace_back(ptrs[i], dels[i]);
+        }
+        // allocations are owned by `owners` from here on
+        (unique_pointers.release(), ...);
+
+        ht_e = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(depends);
 
-        cgh.host_task([ptrs = std::move(ptrs), dels = std::move(dels)]() {
-            for (std::size_t i = 0; i < ptrs.size(); ++i) {
-                dels[i](ptrs[i]);
-            }
+            cgh.host_task([owners = std::move(owners)]() {
+                // no body, allocations are owned by the recorded task
+            });
         });
-    });
+    }
+    else {
+        ht_e = exec_q.submit([&](sycl::handler &cgh) {
+            cgh.depends_on(depends);
+
+            cgh.host_task([ptrs = std::move(ptrs), dels = std::move(dels)]() {
+                for (std::size_t i = 0; i < ptrs.size(); ++i) {
+                    dels[i](ptrs[i]);
+                }
+            });
+        });
+    }
 
     // Upon successful submission of host_task, USM allocations are owned
     // by the host_task. Release smart pointer ownership to avoid double
@@ -219,6 +219,26 @@ py_clip(const dpctl::tensor::usm_ndarray &src,
 
     auto fn = clip_strided_dispatch_vector[src_typeid];
 
+    using dpctl::tensor::offset_utils::max_inline_nd;
+    if (nd <= max_inline_nd) {
+        // shape and strides are copied into kernel functor by value
+        using dpctl::tensor::offset_utils::host_pack;
+        const auto &packed_shape_strides = host_pack<py::ssize_t>(
+            // common shape and strides
+            simplified_shape, simplified_src_strides, simplified_min_strides,
+            simplified_max_strides, simplified_dst_strides);
+
+        sycl::event clip_ev =
+            fn(exec_q, nelems, nd, src_data, min_data, max_data, dst_data,
+               packed_shape_strides.data(), src_offset, min_offset, max_offset,
+               dst_offset, depends);
+
+        sycl::event arg_cleanup_ev =
+            keep_args_alive(exec_q, {src, min, max, dst}, {clip_ev});
+
+        return std::make_pair(arg_cleanup_ev, clip_ev);
+    }
+
     std::vector<sycl::event> host_task_events;
     host_task_events.reserve(2);
 
@@ -247,6 +247,22 @@ copy_usm_ndarray_into_usm_ndarray(const dpctl::tensor::usm_ndarray &src,
     auto copy_and_cast_fn =
         copy_and_cast_generic_dispatch_table[dst_type_id][src_type_id];
 
+    using dpctl::tensor::offset_utils::max_inline_nd;
+    if (nd <= max_inline_nd) {
+        // shape and strides are copied into kernel functor by value
+        using dpctl::tensor::offset_utils::host_pack;
+        const auto &packed_shape_strides = host_pack<py::ssize_t>(
+            simplified_shape, simplified_src_strides, simplified_dst_strides);
+
+        const sycl::event &copy_and_cast_generic_ev = copy_and_cast_fn(
+            exec_q, src_nelems, nd, packed_shape_strides.data(), src_data,
+            src_offset, dst_data, dst_offset, depends, {});
+
+        return std::make_pair(
+            keep_args_alive(exec_q, {src, dst}, {copy_and_cast_generic_ev}),
+            copy_and_cast_generic_ev);
+    }
+
     std::vector<sycl::event> host_task_events;
     host_task_events.reserve(2);
 
@@ -26,6 +26,7 @@
 #include <cstddef>
 #include <stdexcept>
 #include <sycl/sycl.hpp>
+#include <utility>
 #include <vector>
 
 #include "dpctl4pybind11.hpp"
@@ -33,6 +34,7 @@
 #include <pybind11/pybind11.h>
 
 #include "kernels/copy_and_cast.hpp"
+#include "utils/host_staging_pool.hpp"
 #include "utils/offset_utils.hpp"
 #include "utils/output_validation.hpp"
 #include "utils/sycl_alloc_utils.hpp"
@@ -65,6 +67,11 @@ static copy_and_cast_from_host_contig_blocking_fn_ptr_t
     copy_and_cast_from_host_contig_blocking_dispatch_table[td_ns::num_types]
                                                           [td_ns::num_types];
 
+using dpctl::tensor::kernels::copy_and_cast::copy_from_host_staged_fn_ptr_t;
+
+static copy_from_host_staged_fn_ptr_t
+    copy_from_host_staged_dispatch_vector[td_ns::num_types];
+
 void copy_numpy_ndarray_into_usm_ndarray(
     const py::array &npy_src,
     const dpctl::tensor::usm_ndarray &dst,
@@ -331,6 +338,105 @@ void copy_numpy_ndarray_into_usm_ndarray(
     return;
 }
 
+std::pair<sycl::event, sycl::event>
+copy_numpy_ndarray_into_usm_ndarray_async(
+    const py::array &npy_src,
+    const dpctl::tensor::usm_ndarray &dst,
+    sycl::queue &exec_q,
+    const std::vector<sycl::event> &depends)
+{
+    int src_ndim = npy_src.ndim();
+    int dst_ndim = dst.get_ndim();
+
+    if (src_ndim != dst_ndim) {
+        throw py::value_error("Source ndarray and destination usm_ndarray have "
+                              "different array ranks, "
+                              "i.e. different number of indices needed to "
+                              "address array elements.");
+    }
+
+    const py::ssize_t *src_shape = npy_src.shape();
+    const py::ssize_t *dst_shape = dst.get_shape_raw();
+    bool shapes_equal(true);
+    std::size_t src_nelems(1);
+    for (int i = 0; shapes_equal && (i < src_ndim); ++i) {
+        shapes_equal = shapes_equal && (src_shape[i] == dst_shape[i]);
+        src_nelems *= static_cast<std::size_t>(src_shape[i]);
+    }
+
+    if (!shapes_equal) {
+        throw py::value_error("Source ndarray and destination usm_ndarray have "
+                              "difference shapes.");
+    }
+
+    if (src_nelems == 0) {
+        // nothing to do
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    dpctl::tensor::validation::AmpleMemory::throw_if_not_ample(dst, src_nelems);
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {dst})) {
+        throw py::value_error("Execution queue is not compatible with the "
+                              "allocation queue");
+    }
+
+    dpctl::tensor::validation::CheckWritable::throw_if_not_writable(dst);
+
+    const int src_flags = npy_src.flags();
+    if (!(src_flags & py::array::c_style) || !dst.is_c_contiguous()) {
+        throw py::value_error("Source ndarray and destination usm_ndarray are "
+                              "expected to be C-contiguous.");
+    }
+
+    int src_typenum =
+        py::detail::array_descriptor_proxy(npy_src.dtype().ptr())->type_num;
+    int dst_typenum = dst.get_typenum();
+
+    const auto &array_types = td_ns::usm_ndarray_types();
+    int src_type_id = array_types.typenum_to_lookup_id(src_typenum);
+    int dst_type_id = array_types.typenum_to_lookup_id(dst_typenum);
+
+    // casting is done on the host before the source gets staged
+    if (src_type_id != dst_type_id) {
+        throw py::value_error("Source ndarray and destination usm_ndarray are "
+                              "expected to have the same data type.");
+    }
+
+    const char *src_data = static_cast<const char *>(npy_src.data());
+    char *dst_data = dst.get_data();
+
+    using dpctl::tensor::alloc_utils::HostStagingPool;
+    // two staging buffers let filling one overlap with draining the other
+    static constexpr std::size_t n_staging_buffers = 2;
+
+    HostStagingPool &pool = HostStagingPool::get();
+    std::vector<char *> staging = pool.acquire(exec_q, n_staging_buffers);
+
+    auto copy_from_host_staged_fn =
+        copy_from_host_staged_dispatch_vector[dst_type_id];
+
+    sycl::event copy_ev;
+    try {
+        copy_ev = copy_from_host_staged_fn(
+            exec_q, src_nelems, src_data, dst_data, staging,
+            HostStagingPool::buffer_nbytes, depends);
+    } catch (...) {
+        // data types are validated before staging buffers get used
+        pool.release(exec_q, std::move(staging), depends);
+        throw;
+    }
+
+    sycl::event release_ev =
+        pool.release(exec_q, std::move(staging), {copy_ev});
+
+    // host tasks read source array until copy completes
+    sycl::event ht_ev = dpctl::utils::keep_args_alive(
+        exec_q, {npy_src, dst}, {copy_ev, release_ev});
+
+    return std::make_pair(ht_ev, copy_ev);
+}
+
 void init_copy_numpy_ndarray_into_usm_ndarray_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -352,6 +458,15 @@ void init_copy_numpy_ndarray_into_usm_ndarray_dispatch_tables(void)
 
     dtb_copy_from_numpy_contig.populate_dispatch_table(
         copy_and_cast_from_host_contig_blocking_dispatch_table);
+
+    using dpctl::tensor::kernels::copy_and_cast::CopyFromHostStagedFactory;
+
+    DispatchVectorBuilder<copy_from_host_staged_fn_ptr_t,
+                          CopyFromHostStagedFactory, num_types>
+        dvb_copy_from_numpy_staged;
+
+    dvb_copy_from_numpy_staged.populate_dispatch_vector(
+        copy_from_host_staged_dispatch_vector);
 }
 
 } // namespace py_internal
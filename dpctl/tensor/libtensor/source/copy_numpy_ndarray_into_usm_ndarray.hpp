@@ -24,6 +24,7 @@
 
 #pragma once
 #include <sycl/sycl.hpp>
+#include <utility>
 #include <vector>
 
 #include "dpctl4pybind11.hpp"
@@ -43,6 +44,13 @@ extern void copy_numpy_ndarray_into_usm_ndarray(
     sycl::queue &exec_q,
     const std::vector<sycl::event> &depends = {});
 
+extern std::pair<sycl::event, sycl::event>
+copy_numpy_ndarray_into_usm_ndarray_async(
+    const py::array &npy_src,
+    const dpctl::tensor::usm_ndarray &dst,
+    sycl::queue &exec_q,
+    const std::vector<sycl::event> &depends = {});
+
 extern void init_copy_numpy_ndarray_into_usm_ndarray_dispatch_tables(void);
 
 } // namespace py_internal
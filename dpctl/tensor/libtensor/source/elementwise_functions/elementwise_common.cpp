@@ -47,12 +47,14 @@
 #include "copysign.hpp"
 #include "cos.hpp"
 #include "cosh.hpp"
+#include "elementwise_plan_cache.hpp"
 #include "equal.hpp"
 #include "exp.hpp"
 #include "exp2.hpp"
 #include "expm1.hpp"
 #include "floor.hpp"
 #include "floor_divide.hpp"
+#include "fused.hpp"
 #include "greater.hpp"
 #include "greater_equal.hpp"
 #include "hypot.hpp"
@@ -138,6 +140,7 @@ void init_elementwise_functions(py::module_ m)
     init_expm1(m);
     init_floor(m);
     init_floor_divide(m);
+    init_fused(m);
     init_greater(m);
     init_greater_equal(m);
     init_hypot(m);
@@ -180,6 +183,24 @@ void init_elementwise_functions(py::module_ m)
     init_tan(m);
     init_tanh(m);
     init_trunc(m);
+
+    auto plan_cache_info_fn = []() {
+        const auto &cache = get_binary_ufunc_plan_cache();
+        py::dict info;
+        info["hits"] = cache.get_num_hits();
+        info["misses"] = cache.get_num_misses();
+        info["size"] = cache.size();
+        info["capacity"] = cache.capacity();
+        return info;
+    };
+    m.def("_elementwise_plan_cache_info", plan_cache_info_fn,
+          "Returns dictionary with statistics of the cache of dispatch "
+          "plans of binary elementwise functions.");
+
+    auto plan_cache_clear_fn = []() { get_binary_ufunc_plan_cache().clear(); };
+    m.def("_elementwise_plan_cache_clear", plan_cache_clear_fn,
+          "Clears the cache of dispatch plans of binary elementwise "
+          "functions, and resets its statistics.");
 }
 
 } // namespace py_internal
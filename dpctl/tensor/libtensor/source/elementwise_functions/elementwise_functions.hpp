@@ -25,6 +25,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <stdexcept>
 #include <sycl/sycl.hpp>
@@ -37,13 +38,13 @@
 #include <pybind11/stl.h>
 
 #include "elementwise_functions_type_utils.hpp"
+#include "elementwise_plan_cache.hpp"
 #include "kernels/alignment.hpp"
 #include "kernels/dpctl_tensor_types.hpp"
 #include "simplify_iteration_space.hpp"
 #include "utils/memory_overlap.hpp"
 #include "utils/offset_utils.hpp"
 #include "utils/output_validation.hpp"
-#include "utils/sycl_alloc_utils.hpp"
 #include "utils/type_dispatch.hpp"
 
 namespace py = pybind11;
@@ -218,30 +219,38 @@ py_unary_ufunc(const dpctl::tensor::usm_ndarray &src,
             std::to_string(src_typeid));
     }
 
-    using dpctl::tensor::offset_utils::device_allocate_and_pack;
+    using dpctl::tensor::offset_utils::max_inline_nd;
+    if (nd <= max_inline_nd) {
+        // shape and strides are copied into kernel functor by value
+        using dpctl::tensor::offset_utils::host_pack;
+        const auto &packed_shape_strides = host_pack<py::ssize_t>(
+            simplified_shape, simplified_src_strides, simplified_dst_strides);
 
-    std::vector<sycl::event> host_tasks{};
-    host_tasks.reserve(2);
+        sycl::event strided_fn_ev = strided_fn(
+            q, src_nelems, nd, packed_shape_strides.data(), src_data,
+            src_offset, dst_data, dst_offset, depends, {});
+
+        return std::make_pair(
+            dpctl::utils::keep_args_alive(q, {src, dst}, {strided_fn_ev}),
+            strided_fn_ev);
+    }
+
+    using dpctl::tensor::offset_utils::device_allocate_and_pack_cached;
 
-    auto ptr_size_event_triple_ = device_allocate_and_pack<py::ssize_t>(
-        q, host_tasks, simplified_shape, simplified_src_strides,
-        simplified_dst_strides);
-    auto shape_strides_owner = std::move(std::get<0>(ptr_size_event_triple_));
-    const auto &copy_shape_ev = std::get<2>(ptr_size_event_triple_);
-    const py::ssize_t *shape_strides = shape_strides_owner.get();
+    auto shape_strides_lease = device_allocate_and_pack_cached<py::ssize_t>(
+        q, simplified_shape, simplified_src_strides, simplified_dst_strides);
+    const auto &copy_shape_ev = shape_strides_lease.get_copy_event();
+    const py::ssize_t *shape_strides = shape_strides_lease.get();
 
     sycl::event strided_fn_ev =
         strided_fn(q, src_nelems, nd, shape_strides, src_data, src_offset,
                    dst_data, dst_offset, depends, {copy_shape_ev});
 
-    // async free of shape_strides temporary
-    sycl::event tmp_cleanup_ev = dpctl::tensor::alloc_utils::async_smart_free(
-        q, {strided_fn_ev}, shape_strides_owner);
-
-    host_tasks.push_back(tmp_cleanup_ev);
+    // shape_strides block is recycled by the arena after strided_fn_ev
+    shape_strides_lease.release_after({strided_fn_ev});
 
     return std::make_pair(
-        dpctl::utils::keep_args_alive(q, {src, dst}, host_tasks),
+        dpctl::utils::keep_args_alive(q, {src, dst}, {strided_fn_ev}),
         strided_fn_ev);
 }
 
@@ -290,6 +299,99 @@ bool isEqual(Container const &c, std::initializer_list<T> const &l)
 }
 } // namespace
 
+/*! @brief Select kernel variant of binary elementwise function for
+ *         arguments which are not all C-contiguous or all F-contiguous,
+ *         and simplify their iteration space. */
+inline BinaryUfuncPlan
+make_binary_ufunc_plan(int nd,
+                       const py::ssize_t *shape,
+                       const std::vector<py::ssize_t> &src1_strides,
+                       const std::vector<py::ssize_t> &src2_strides,
+                       const std::vector<py::ssize_t> &dst_strides,
+                       const char *src1_data,
+                       int src1_itemsize,
+                       const char *src2_data,
+                       int src2_itemsize,
+                       const char *dst_data,
+                       int dst_itemsize,
+                       bool has_contig_fn,
+                       bool has_matrix_row_broadcast_fn,
+                       bool has_row_matrix_broadcast_fn)
+{
+    using shT = std::vector<py::ssize_t>;
+    shT simplified_shape;
+    shT simplified_src1_strides;
+    shT simplified_src2_strides;
+    shT simplified_dst_strides;
+
+    BinaryUfuncPlan plan{};
+
+    dpctl::tensor::py_internal::simplify_iteration_space_3(
+        nd, shape, src1_strides, src2_strides, dst_strides,
+        // outputs
+        simplified_shape, simplified_src1_strides, simplified_src2_strides,
+        simplified_dst_strides, plan.src1_offset, plan.src2_offset,
+        plan.dst_offset);
+
+    plan.nd = nd;
+    using dpctl::tensor::offset_utils::host_pack;
+    plan.packed_shape_strides =
+        host_pack<py::ssize_t>(simplified_shape, simplified_src1_strides,
+                               simplified_src2_strides, simplified_dst_strides);
+
+    const bool args_aligned =
+        is_aligned<required_alignment>(src1_data +
+                                       plan.src1_offset * src1_itemsize) &&
+        is_aligned<required_alignment>(src2_data +
+                                       plan.src2_offset * src2_itemsize) &&
+        is_aligned<required_alignment>(dst_data +
+                                       plan.dst_offset * dst_itemsize);
+
+    if (nd < 3) {
+        static constexpr auto unit_stride =
+            std::initializer_list<py::ssize_t>{1};
+
+        if ((nd == 1) && isEqual(simplified_src1_strides, unit_stride) &&
+            isEqual(simplified_src2_strides, unit_stride) &&
+            isEqual(simplified_dst_strides, unit_stride))
+        {
+            if (has_contig_fn) {
+                plan.kind = BinaryUfuncPlan::Kind::contig;
+                return plan;
+            }
+        }
+        if (nd == 2) {
+            static constexpr auto zero_one_strides =
+                std::initializer_list<py::ssize_t>{0, 1};
+            static constexpr auto one_zero_strides =
+                std::initializer_list<py::ssize_t>{1, 0};
+            static constexpr py::ssize_t one{1};
+            // special case of C-contiguous matrix and a row
+            if (isEqual(simplified_src2_strides, zero_one_strides) &&
+                isEqual(simplified_src1_strides, {simplified_shape[1], one}) &&
+                isEqual(simplified_dst_strides, {simplified_shape[1], one}))
+            {
+                if (has_matrix_row_broadcast_fn && args_aligned) {
+                    plan.kind = BinaryUfuncPlan::Kind::contig_matrix_row;
+                    return plan;
+                }
+            }
+            if (isEqual(simplified_src1_strides, one_zero_strides) &&
+                isEqual(simplified_src2_strides, {one, simplified_shape[0]}) &&
+                isEqual(simplified_dst_strides, {one, simplified_shape[0]}))
+            {
+                if (has_row_matrix_broadcast_fn && args_aligned) {
+                    plan.kind = BinaryUfuncPlan::Kind::contig_row_matrix;
+                    return plan;
+                }
+            }
+        }
+    }
+
+    plan.kind = BinaryUfuncPlan::Kind::strided;
+    return plan;
+}
+
 /*! @brief Template implementing Python API for binary elementwise
  *         functions */
 template <typename output_typesT,
@@ -409,125 +511,102 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
         }
     }
 
-    // simplify strides
     auto const &src1_strides = src1.get_strides_vector();
     auto const &src2_strides = src2.get_strides_vector();
     auto const &dst_strides = dst.get_strides_vector();
 
-    using shT = std::vector<py::ssize_t>;
-    shT simplified_shape;
-    shT simplified_src1_strides;
-    shT simplified_src2_strides;
-    shT simplified_dst_strides;
-    py::ssize_t src1_offset(0);
-    py::ssize_t src2_offset(0);
-    py::ssize_t dst_offset(0);
+    // Plan depends on the function, data types, shape, strides, and on
+    // misalignment of data pointers, which decides whether broadcasting
+    // kernels may be used. Plans do not depend on the queue.
+    std::vector<py::ssize_t> plan_key;
+    plan_key.reserve(4 + 4 * static_cast<std::size_t>(dst_nd) + 3);
+    plan_key.push_back(static_cast<py::ssize_t>(
+        reinterpret_cast<std::uintptr_t>(&strided_dispatch_table)));
+    plan_key.push_back(src1_typeid);
+    plan_key.push_back(src2_typeid);
+    plan_key.push_back(dst_nd);
+    plan_key.insert(plan_key.end(), dst_shape, dst_shape + dst_nd);
+    plan_key.insert(plan_key.end(), src1_strides.begin(), src1_strides.end());
+    plan_key.insert(plan_key.end(), src2_strides.begin(), src2_strides.end());
+    plan_key.insert(plan_key.end(), dst_strides.begin(), dst_strides.end());
+    const char *data_ptrs[] = {src1_data, src2_data, dst_data};
+    for (const char *p : data_ptrs) {
+        plan_key.push_back(static_cast<py::ssize_t>(
+            reinterpret_cast<std::uintptr_t>(p) % required_alignment));
+    }
+
+    auto &plan_cache = get_binary_ufunc_plan_cache();
+    BinaryUfuncPlan plan{};
+    if (auto cached_plan = plan_cache.lookup(plan_key)) {
+        plan = std::move(*cached_plan);
+    }
+    else {
+        plan = make_binary_ufunc_plan(
+            dst_nd, dst_shape, src1_strides, src2_strides, dst_strides,
+            src1_data, src1.get_elemsize(), src2_data, src2.get_elemsize(),
+            dst_data, dst.get_elemsize(),
+            contig_dispatch_table[src1_typeid][src2_typeid] != nullptr,
+            contig_matrix_row_broadcast_dispatch_table[src1_typeid]
+                                                      [src2_typeid] != nullptr,
+            contig_row_matrix_broadcast_dispatch_table[src1_typeid]
+                                                      [src2_typeid] != nullptr);
+        plan_cache.insert(plan_key, plan);
+    }
+
+    const int nd = plan.nd;
+    const py::ssize_t *simplified_shape = plan.packed_shape_strides.data();
+    const py::ssize_t src1_offset = plan.src1_offset;
+    const py::ssize_t src2_offset = plan.src2_offset;
+    const py::ssize_t dst_offset = plan.dst_offset;
 
-    int nd = dst_nd;
-    const py::ssize_t *shape = src1_shape;
+    std::vector<sycl::event> host_tasks{};
+    switch (plan.kind) {
+    case BinaryUfuncPlan::Kind::contig:
+    {
+        auto contig_fn = contig_dispatch_table[src1_typeid][src2_typeid];
 
-    dpctl::tensor::py_internal::simplify_iteration_space_3(
-        nd, shape, src1_strides, src2_strides, dst_strides,
-        // outputs
-        simplified_shape, simplified_src1_strides, simplified_src2_strides,
-        simplified_dst_strides, src1_offset, src2_offset, dst_offset);
+        auto comp_ev = contig_fn(exec_q, src_nelems, src1_data, src1_offset,
+                                 src2_data, src2_offset, dst_data, dst_offset,
+                                 depends);
+        sycl::event ht_ev = dpctl::utils::keep_args_alive(
+            exec_q, {src1, src2, dst}, {comp_ev});
 
-    std::vector<sycl::event> host_tasks{};
-    if (nd < 3) {
-        static constexpr auto unit_stride =
-            std::initializer_list<py::ssize_t>{1};
+        return std::make_pair(ht_ev, comp_ev);
+    }
+    case BinaryUfuncPlan::Kind::contig_matrix_row:
+    {
+        auto matrix_row_broadcast_fn =
+            contig_matrix_row_broadcast_dispatch_table[src1_typeid]
+                                                      [src2_typeid];
 
-        if ((nd == 1) && isEqual(simplified_src1_strides, unit_stride) &&
-            isEqual(simplified_src2_strides, unit_stride) &&
-            isEqual(simplified_dst_strides, unit_stride))
-        {
-            auto contig_fn = contig_dispatch_table[src1_typeid][src2_typeid];
+        std::size_t n0 = simplified_shape[0];
+        std::size_t n1 = simplified_shape[1];
+        sycl::event comp_ev = matrix_row_broadcast_fn(
+            exec_q, host_tasks, n0, n1, src1_data, src1_offset, src2_data,
+            src2_offset, dst_data, dst_offset, depends);
 
-            if (contig_fn != nullptr) {
-                auto comp_ev = contig_fn(exec_q, src_nelems, src1_data,
-                                         src1_offset, src2_data, src2_offset,
-                                         dst_data, dst_offset, depends);
-                sycl::event ht_ev = dpctl::utils::keep_args_alive(
-                    exec_q, {src1, src2, dst}, {comp_ev});
+        return std::make_pair(dpctl::utils::keep_args_alive(
+                                  exec_q, {src1, src2, dst}, host_tasks),
+                              comp_ev);
+    }
+    case BinaryUfuncPlan::Kind::contig_row_matrix:
+    {
+        auto row_matrix_broadcast_fn =
+            contig_row_matrix_broadcast_dispatch_table[src1_typeid]
+                                                      [src2_typeid];
 
-                return std::make_pair(ht_ev, comp_ev);
-            }
-        }
-        if (nd == 2) {
-            static constexpr auto zero_one_strides =
-                std::initializer_list<py::ssize_t>{0, 1};
-            static constexpr auto one_zero_strides =
-                std::initializer_list<py::ssize_t>{1, 0};
-            static constexpr py::ssize_t one{1};
-            // special case of C-contiguous matrix and a row
-            if (isEqual(simplified_src2_strides, zero_one_strides) &&
-                isEqual(simplified_src1_strides, {simplified_shape[1], one}) &&
-                isEqual(simplified_dst_strides, {simplified_shape[1], one}))
-            {
-                auto matrix_row_broadcast_fn =
-                    contig_matrix_row_broadcast_dispatch_table[src1_typeid]
-                                                              [src2_typeid];
-                if (matrix_row_broadcast_fn != nullptr) {
-                    int src1_itemsize = src1.get_elemsize();
-                    int src2_itemsize = src2.get_elemsize();
-                    int dst_itemsize = dst.get_elemsize();
-
-                    if (is_aligned<required_alignment>(
-                            src1_data + src1_offset * src1_itemsize) &&
-                        is_aligned<required_alignment>(
-                            src2_data + src2_offset * src2_itemsize) &&
-                        is_aligned<required_alignment>(
-                            dst_data + dst_offset * dst_itemsize))
-                    {
-                        std::size_t n0 = simplified_shape[0];
-                        std::size_t n1 = simplified_shape[1];
-                        sycl::event comp_ev = matrix_row_broadcast_fn(
-                            exec_q, host_tasks, n0, n1, src1_data, src1_offset,
-                            src2_data, src2_offset, dst_data, dst_offset,
-                            depends);
-
-                        return std::make_pair(
-                            dpctl::utils::keep_args_alive(
-                                exec_q, {src1, src2, dst}, host_tasks),
-                            comp_ev);
-                    }
-                }
-            }
-            if (isEqual(simplified_src1_strides, one_zero_strides) &&
-                isEqual(simplified_src2_strides, {one, simplified_shape[0]}) &&
-                isEqual(simplified_dst_strides, {one, simplified_shape[0]}))
-            {
-                auto row_matrix_broadcast_fn =
-                    contig_row_matrix_broadcast_dispatch_table[src1_typeid]
-                                                              [src2_typeid];
-                if (row_matrix_broadcast_fn != nullptr) {
+        std::size_t n0 = simplified_shape[1];
+        std::size_t n1 = simplified_shape[0];
+        sycl::event comp_ev = row_matrix_broadcast_fn(
+            exec_q, host_tasks, n0, n1, src1_data, src1_offset, src2_data,
+            src2_offset, dst_data, dst_offset, depends);
 
-                    int src1_itemsize = src1.get_elemsize();
-                    int src2_itemsize = src2.get_elemsize();
-                    int dst_itemsize = dst.get_elemsize();
-
-                    if (is_aligned<required_alignment>(
-                            src1_data + src1_offset * src1_itemsize) &&
-                        is_aligned<required_alignment>(
-                            src2_data + src2_offset * src2_itemsize) &&
-                        is_aligned<required_alignment>(
-                            dst_data + dst_offset * dst_itemsize))
-                    {
-                        std::size_t n0 = simplified_shape[1];
-                        std::size_t n1 = simplified_shape[0];
-                        sycl::event comp_ev = row_matrix_broadcast_fn(
-                            exec_q, host_tasks, n0, n1, src1_data, src1_offset,
-                            src2_data, src2_offset, dst_data, dst_offset,
-                            depends);
-
-                        return std::make_pair(
-                            dpctl::utils::keep_args_alive(
-                                exec_q, {src1, src2, dst}, host_tasks),
-                            comp_ev);
-                    }
-                }
-            }
-        }
+        return std::make_pair(dpctl::utils::keep_args_alive(
+                                  exec_q, {src1, src2, dst}, host_tasks),
+                              comp_ev);
+    }
+    default:
+        break;
     }
 
     // dispatch to strided code
@@ -540,23 +619,34 @@ std::pair<sycl::event, sycl::event> py_binary_ufunc(
             " and src2_typeid=" + std::to_string(src2_typeid));
     }
 
-    using dpctl::tensor::offset_utils::device_allocate_and_pack;
-    auto ptr_sz_event_triple_ = device_allocate_and_pack<py::ssize_t>(
-        exec_q, host_tasks, simplified_shape, simplified_src1_strides,
-        simplified_src2_strides, simplified_dst_strides);
-    auto shape_strides_owner = std::move(std::get<0>(ptr_sz_event_triple_));
-    auto &copy_shape_ev = std::get<2>(ptr_sz_event_triple_);
+    using dpctl::tensor::offset_utils::max_inline_nd;
+    if (nd <= max_inline_nd) {
+        // shape and strides are copied into kernel functor by value
+        sycl::event strided_fn_ev = strided_fn(
+            exec_q, src_nelems, nd, plan.packed_shape_strides.data(),
+            src1_data, src1_offset, src2_data, src2_offset, dst_data,
+            dst_offset, depends, {});
+        host_tasks.push_back(strided_fn_ev);
 
-    const py::ssize_t *shape_strides = shape_strides_owner.get();
+        return std::make_pair(dpctl::utils::keep_args_alive(
+                                  exec_q, {src1, src2, dst}, host_tasks),
+                              strided_fn_ev);
+    }
+
+    using dpctl::tensor::offset_utils::device_allocate_and_pack_cached;
+    auto shape_strides_lease = device_allocate_and_pack_cached<py::ssize_t>(
+        exec_q, plan.packed_shape_strides);
+    const auto &copy_shape_ev = shape_strides_lease.get_copy_event();
+
+    const py::ssize_t *shape_strides = shape_strides_lease.get();
 
     sycl::event strided_fn_ev = strided_fn(
         exec_q, src_nelems, nd, shape_strides, src1_data, src1_offset,
         src2_data, src2_offset, dst_data, dst_offset, depends, {copy_shape_ev});
 
-    // async free of shape_strides temporary
-    sycl::event tmp_cleanup_ev = dpctl::tensor::alloc_utils::async_smart_free(
-        exec_q, {strided_fn_ev}, shape_strides_owner);
-    host_tasks.push_back(tmp_cleanup_ev);
+    // shape_strides block is recycled by the arena after strided_fn_ev
+    shape_strides_lease.release_after({strided_fn_ev});
+    host_tasks.push_back(strided_fn_ev);
 
     return std::make_pair(
         dpctl::utils::keep_args_alive(exec_q, {src1, src2, dst}, host_tasks),
@@ -784,24 +874,39 @@ py_binary_inplace_ufunc(const dpctl::tensor::usm_ndarray &lhs,
             " and lhs_typeid=" + std::to_string(lhs_typeid));
     }
 
-    using dpctl::tensor::offset_utils::device_allocate_and_pack;
-    auto ptr_sz_event_triple_ = device_allocate_and_pack<py::ssize_t>(
-        exec_q, host_tasks, simplified_shape, simplified_rhs_strides,
+    using dpctl::tensor::offset_utils::max_inline_nd;
+    if (nd <= max_inline_nd) {
+        // shape and strides are copied into kernel functor by value
+        using dpctl::tensor::offset_utils::host_pack;
+        const auto &packed_shape_strides = host_pack<py::ssize_t>(
+            simplified_shape, simplified_rhs_strides, simplified_lhs_strides);
+
+        sycl::event strided_fn_ev =
+            strided_fn(exec_q, rhs_nelems, nd, packed_shape_strides.data(),
+                       rhs_data, rhs_offset, lhs_data, lhs_offset, depends, {});
+        host_tasks.push_back(strided_fn_ev);
+
+        return std::make_pair(
+            dpctl::utils::keep_args_alive(exec_q, {rhs, lhs}, host_tasks),
+            strided_fn_ev);
+    }
+
+    using dpctl::tensor::offset_utils::device_allocate_and_pack_cached;
+    auto shape_strides_lease = device_allocate_and_pack_cached<py::ssize_t>(
+        exec_q, simplified_shape, simplified_rhs_strides,
         simplified_lhs_strides);
-    auto shape_strides_owner = std::move(std::get<0>(ptr_sz_event_triple_));
-    auto copy_shape_ev = std::get<2>(ptr_sz_event_triple_);
+    const auto &copy_shape_ev = shape_strides_lease.get_copy_event();
 
-    const py::ssize_t *shape_strides = shape_strides_owner.get();
+    const py::ssize_t *shape_strides = shape_strides_lease.get();
 
     sycl::event strided_fn_ev =
         strided_fn(exec_q, rhs_nelems, nd, shape_strides, rhs_data, rhs_offset,
                    lhs_data, lhs_offset, depends, {copy_shape_ev});
 
-    // async free of shape_strides temporary
-    sycl::event tmp_cleanup_ev = dpctl::tensor::alloc_utils::async_smart_free(
-        exec_q, {strided_fn_ev}, shape_strides_owner);
+    // shape_strides block is recycled by the arena after strided_fn_ev
+    shape_strides_lease.release_after({strided_fn_ev});
 
-    host_tasks.push_back(tmp_cleanup_ev);
+    host_tasks.push_back(strided_fn_ev);
 
     return std::make_pair(
         dpctl::utils::keep_args_alive(exec_q, {rhs, lhs}, host_tasks),
@@ -0,0 +1,166 @@
+//===----------- Implementation of _tensor_impl module  ---------*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines a cache of dispatch plans of elementwise functions,
+/// i.e. of the kernel variant selected for given data types and memory
+/// layouts of arguments, together with the simplified iteration space.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+/*! @brief Dispatch plan of a binary elementwise function for arguments
+ *         which are not all C-contiguous or all F-contiguous */
+struct BinaryUfuncPlan
+{
+    enum class Kind : std::uint8_t
+    {
+        contig,
+        contig_matrix_row,
+        contig_row_matrix,
+        strided
+    };
+
+    Kind kind = Kind::strided;
+    int nd = 0;
+    // simplified shape followed by simplified strides of src1, src2, dst
+    std::vector<py::ssize_t> packed_shape_strides{};
+    py::ssize_t src1_offset = 0;
+    py::ssize_t src2_offset = 0;
+    py::ssize_t dst_offset = 0;
+};
+
+/*! @brief Bounded LRU cache of dispatch plans keyed by vector of integers
+ *         describing the call: function, data types, shape, strides and
+ *         alignment of data pointers. */
+template <typename PlanT> class ElementwisePlanCache
+{
+private:
+    using keyT = std::vector<py::ssize_t>;
+
+    struct KeyHash
+    {
+        std::size_t operator()(const keyT &key) const
+        {
+            std::uint64_t h = 14695981039346656037ULL;
+            static constexpr std::uint64_t prime = 1099511628211ULL;
+            for (const auto &v : key) {
+                h = (h ^ static_cast<std::uint64_t>(v)) * prime;
+            }
+            return static_cast<std::size_t>(h);
+        }
+    };
+
+    using EntryList = std::list<std::pair<keyT, PlanT>>;
+    using EntryIt = typename EntryList::iterator;
+
+    std::mutex mu_{};
+    // most recently used entry is at the front
+    EntryList entries_{};
+    std::unordered_map<keyT, EntryIt, KeyHash> index_{};
+    std::size_t capacity_;
+    std::size_t n_hits_ = 0;
+    std::size_t n_misses_ = 0;
+
+public:
+    static constexpr std::size_t default_capacity = 512;
+
+    ElementwisePlanCache(std::size_t capacity = default_capacity)
+        : capacity_(capacity)
+    {
+    }
+
+    ElementwisePlanCache(const ElementwisePlanCache &) = delete;
+    ElementwisePlanCache &operator=(const ElementwisePlanCache &) = delete;
+
+    std::optional<PlanT> lookup(const keyT &key)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+
+        const auto &pos = index_.find(key);
+        if (pos == index_.end()) {
+            ++n_misses_;
+            return std::nullopt;
+        }
+        ++n_hits_;
+        entries_.splice(entries_.begin(), entries_, pos->second);
+        return pos->second->second;
+    }
+
+    void insert(const keyT &key, const PlanT &plan)
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+
+        if (capacity_ == 0 || index_.find(key) != index_.end()) {
+            return;
+        }
+        entries_.emplace_front(key, plan);
+        index_.emplace(key, entries_.begin());
+        while (entries_.size() > capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+
+        index_.clear();
+        entries_.clear();
+        n_hits_ = 0;
+        n_misses_ = 0;
+    }
+
+    std::size_t get_num_hits() const { return n_hits_; }
+    std::size_t get_num_misses() const { return n_misses_; }
+    std::size_t size() const { return entries_.size(); }
+    std::size_t capacity() const { return capacity_; }
+};
+
+/*! @brief Cache of plans shared by all binary elementwise functions */
+inline ElementwisePlanCache<BinaryUfuncPlan> &get_binary_ufunc_plan_cache()
+{
+    static ElementwisePlanCache<BinaryUfuncPlan> cache{};
+    return cache;
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
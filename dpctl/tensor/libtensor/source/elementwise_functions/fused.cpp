@@ -0,0 +1,326 @@
+//===----------- Implementation of _tensor_impl module  ---------*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_impl extensions,
+/// specifically functions for evaluation of fused elementwise expressions.
+//===----------------------------------------------------------------------===//
+
+#include "dpctl4pybind11.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <stdexcept>
+#include <string>
+#include <sycl/sycl.hpp>
+#include <utility>
+#include <vector>
+
+#include "fused.hpp"
+#include "utils/memory_overlap.hpp"
+#include "utils/offset_utils.hpp"
+#include "utils/output_validation.hpp"
+#include "utils/type_dispatch.hpp"
+
+#include "kernels/elementwise_functions/fused.hpp"
+
+namespace py = pybind11;
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+namespace td_ns = dpctl::tensor::type_dispatch;
+
+namespace impl
+{
+
+namespace fused_ns = dpctl::tensor::kernels::fused;
+
+using fused_ns::fused_elementwise_impl_fn_ptr_t;
+using fused_ns::FusedInstruction;
+using fused_ns::FusedOpCode;
+
+static fused_elementwise_impl_fn_ptr_t
+    fused_elementwise_dispatch_vector[td_ns::num_types];
+
+void populate_fused_elementwise_dispatch_vector(void)
+{
+    using namespace td_ns;
+    using fused_ns::FusedElementwiseFactory;
+
+    DispatchVectorBuilder<fused_elementwise_impl_fn_ptr_t,
+                          FusedElementwiseFactory, num_types>
+        dvb;
+    dvb.populate_dispatch_vector(fused_elementwise_dispatch_vector);
+}
+
+/*! @brief Validate program, so that kernel need not check stack bounds */
+std::vector<FusedInstruction>
+validate_fused_program(const std::vector<std::pair<int, int>> &program,
+                       std::size_t n_inputs,
+                       std::size_t n_scalars)
+{
+    if (program.empty() || program.size() > fused_ns::max_fused_instructions) {
+        throw py::value_error("Fused program must have between 1 and " +
+                              std::to_string(fused_ns::max_fused_instructions) +
+                              " instructions");
+    }
+
+    static constexpr int num_opcodes =
+        static_cast<int>(FusedOpCode::num_opcodes);
+    static constexpr int first_unary = static_cast<int>(FusedOpCode::negative);
+    static constexpr int first_binary = static_cast<int>(FusedOpCode::add);
+
+    std::vector<FusedInstruction> code;
+    code.reserve(program.size());
+
+    std::size_t depth = 0;
+    for (const auto &[opcode, arg] : program) {
+        if (opcode < 0 || opcode >= num_opcodes) {
+            throw py::value_error("Unrecognized fused operation code " +
+                                  std::to_string(opcode));
+        }
+        if (opcode == static_cast<int>(FusedOpCode::load_input)) {
+            if (arg < 0 || static_cast<std::size_t>(arg) >= n_inputs) {
+                throw py::value_error("Fused program references input " +
+                                      std::to_string(arg) + " out of range");
+            }
+            ++depth;
+        }
+        else if (opcode == static_cast<int>(FusedOpCode::load_scalar)) {
+            if (arg < 0 || static_cast<std::size_t>(arg) >= n_scalars) {
+                throw py::value_error("Fused program references scalar " +
+                                      std::to_string(arg) + " out of range");
+            }
+            ++depth;
+        }
+        else if (opcode >= first_unary && opcode < first_binary) {
+            if (depth < 1) {
+                throw py::value_error("Malformed fused program");
+            }
+        }
+        else {
+            if (depth < 2) {
+                throw py::value_error("Malformed fused program");
+            }
+            --depth;
+        }
+        if (depth > fused_ns::max_fused_stack_depth) {
+            throw py::value_error("Fused program is too deeply nested");
+        }
+        code.push_back(FusedInstruction{static_cast<std::uint8_t>(opcode),
+                                        static_cast<std::uint8_t>(arg)});
+    }
+
+    if (depth != 1) {
+        throw py::value_error("Malformed fused program");
+    }
+
+    return code;
+}
+
+std::pair<sycl::event, sycl::event>
+py_fused_elementwise(const std::vector<dpctl::tensor::usm_ndarray> &srcs,
+                     const dpctl::tensor::usm_ndarray &dst,
+                     const std::vector<std::pair<int, int>> &program,
+                     const std::vector<double> &scalars,
+                     sycl::queue &exec_q,
+                     const std::vector<sycl::event> &depends)
+{
+    const std::size_t n_inputs = srcs.size();
+    if (n_inputs == 0 || n_inputs > fused_ns::max_fused_inputs) {
+        throw py::value_error("Fused expression must have between 1 and " +
+                              std::to_string(fused_ns::max_fused_inputs) +
+                              " array inputs");
+    }
+    if (scalars.size() > fused_ns::max_fused_scalars) {
+        throw py::value_error("Fused expression must have at most " +
+                              std::to_string(fused_ns::max_fused_scalars) +
+                              " scalar constants");
+    }
+
+    const auto &code =
+        validate_fused_program(program, n_inputs, scalars.size());
+
+    const auto &array_types = td_ns::usm_ndarray_types();
+    const int dst_typeid = array_types.typenum_to_lookup_id(dst.get_typenum());
+
+    auto fn = fused_elementwise_dispatch_vector[dst_typeid];
+    if (fn == nullptr) {
+        throw py::value_error(
+            "Fused expressions are not supported for the output data type");
+    }
+
+    dpctl::tensor::validation::CheckWritable::throw_if_not_writable(dst);
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {dst})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    const int nd = dst.get_ndim();
+    const py::ssize_t *dst_shape = dst.get_shape_raw();
+
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    auto const &same_logical_tensors =
+        dpctl::tensor::overlap::SameLogicalTensors();
+
+    bool all_c_contig = dst.is_c_contiguous();
+    bool all_f_contig = dst.is_f_contiguous();
+    for (const auto &src : srcs) {
+        if (src.get_typenum() != dst.get_typenum()) {
+            throw py::value_error(
+                "Inputs and output of fused expression must have the same "
+                "data type");
+        }
+        if (!dpctl::utils::queues_are_compatible(exec_q, {src})) {
+            throw py::value_error(
+                "Execution queue is not compatible with allocation queues");
+        }
+        if (src.get_ndim() != nd) {
+            throw py::value_error("Array dimensions are not the same.");
+        }
+        const py::ssize_t *src_shape = src.get_shape_raw();
+        for (int i = 0; i < nd; ++i) {
+            if (src_shape[i] != dst_shape[i]) {
+                throw py::value_error("Array shapes are not the same.");
+            }
+        }
+        if (overlap(src, dst) && !same_logical_tensors(src, dst)) {
+            throw py::value_error(
+                "Arrays index overlapping segments of memory");
+        }
+        all_c_contig = all_c_contig && src.is_c_contiguous();
+        all_f_contig = all_f_contig && src.is_f_contiguous();
+    }
+
+    const std::size_t nelems = dst.get_size();
+    if (nelems == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    dpctl::tensor::validation::AmpleMemory::throw_if_not_ample(dst, nelems);
+
+    std::vector<const char *> src_ps;
+    src_ps.reserve(n_inputs);
+    for (const auto &src : srcs) {
+        src_ps.push_back(src.get_data());
+    }
+    char *dst_p = dst.get_data();
+
+    // keep-alive list has fixed size, unused entries repeat the output
+    py::object ka_objs[fused_ns::max_fused_inputs + 1];
+    for (std::size_t k = 0; k <= fused_ns::max_fused_inputs; ++k) {
+        ka_objs[k] = (k < n_inputs) ? py::object(srcs[k]) : py::object(dst);
+    }
+
+    if (all_c_contig || all_f_contig) {
+        sycl::event comp_ev = fn(exec_q, nelems, 0, nullptr, src_ps, dst_p,
+                                 code, scalars, depends);
+        sycl::event ht_ev =
+            dpctl::utils::keep_args_alive(exec_q, ka_objs, {comp_ev});
+
+        return std::make_pair(ht_ev, comp_ev);
+    }
+
+    using shT = std::vector<py::ssize_t>;
+    shT packed_shape_strides(dst_shape, dst_shape + nd);
+    packed_shape_strides.reserve(nd * (n_inputs + 2));
+    for (const auto &src : srcs) {
+        const auto &src_strides = src.get_strides_vector();
+        packed_shape_strides.insert(packed_shape_strides.end(),
+                                    src_strides.begin(), src_strides.end());
+    }
+    const auto &dst_strides = dst.get_strides_vector();
+    packed_shape_strides.insert(packed_shape_strides.end(),
+                                dst_strides.begin(), dst_strides.end());
+
+    using dpctl::tensor::offset_utils::max_inline_nd;
+    if (nd <= max_inline_nd) {
+        // shape and strides are copied into kernel functor by value
+        sycl::event comp_ev =
+            fn(exec_q, nelems, nd, packed_shape_strides.data(), src_ps, dst_p,
+               code, scalars, depends);
+        sycl::event ht_ev =
+            dpctl::utils::keep_args_alive(exec_q, ka_objs, {comp_ev});
+
+        return std::make_pair(ht_ev, comp_ev);
+    }
+
+    using dpctl::tensor::alloc_utils::get_packed_metadata_arena;
+    auto lease = get_packed_metadata_arena<py::ssize_t>(exec_q).acquire(
+        exec_q, packed_shape_strides);
+
+    std::vector<sycl::event> all_deps;
+    all_deps.reserve(depends.size() + 1);
+    all_deps.insert(all_deps.end(), depends.begin(), depends.end());
+    all_deps.push_back(lease.get_copy_event());
+
+    sycl::event comp_ev = fn(exec_q, nelems, nd, lease.get(), src_ps, dst_p,
+                             code, scalars, all_deps);
+    lease.release_after({comp_ev});
+
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, ka_objs, {comp_ev});
+
+    return std::make_pair(ht_ev, comp_ev);
+}
+
+bool py_fused_elementwise_supports_dtype(const py::dtype &dtype)
+{
+    const auto &array_types = td_ns::usm_ndarray_types();
+    const int tid = array_types.typenum_to_lookup_id(dtype.num());
+
+    return (fused_elementwise_dispatch_vector[tid] != nullptr);
+}
+
+} // namespace impl
+
+void init_fused(py::module_ m)
+{
+    impl::populate_fused_elementwise_dispatch_vector();
+
+    m.def("_fused_elementwise", &impl::py_fused_elementwise,
+          "Evaluates fused elementwise expression encoded as a program for "
+          "a stack machine, reading each input and writing output once.",
+          py::arg("srcs"), py::arg("dst"), py::arg("program"),
+          py::arg("scalars"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+
+    m.def("_fused_elementwise_supports_dtype",
+          &impl::py_fused_elementwise_supports_dtype, py::arg("dtype"));
+
+    namespace fused_ns = dpctl::tensor::kernels::fused;
+    m.attr("_fused_max_inputs") = py::int_(fused_ns::max_fused_inputs);
+    m.attr("_fused_max_instructions") =
+        py::int_(fused_ns::max_fused_instructions);
+    m.attr("_fused_max_scalars") = py::int_(fused_ns::max_fused_scalars);
+    m.attr("_fused_max_stack_depth") =
+        py::int_(fused_ns::max_fused_stack_depth);
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
@@ -28,6 +28,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <stdexcept>
+#include <string>
 #include <sycl/sycl.hpp>
 #include <utility>
 
@@ -45,11 +46,19 @@
 #include "utils/type_utils.hpp"
 
 #include "integer_advanced_indexing.hpp"
+#include "reductions/reduction_atomic_support.hpp"
 
 #define INDEXING_MODES 2
 #define WRAP_MODE 0
 #define CLIP_MODE 1
 
+#define PUT_REDUCE_OPS 4
+#define PUT_REDUCE_NONE 0
+#define PUT_REDUCE_ADD 1
+#define PUT_REDUCE_MUL 2
+#define PUT_REDUCE_MAX 3
+#define PUT_REDUCE_MIN 4
+
 namespace dpctl
 {
 namespace tensor
@@ -68,6 +77,14 @@ static take_fn_ptr_t take_dispatch_table[INDEXING_MODES][td_ns::num_types]
 static put_fn_ptr_t put_dispatch_table[INDEXING_MODES][td_ns::num_types]
                                       [td_ns::num_types];
 
+// indexed by reduction operation minus one, mode, value type, index type
+static put_fn_ptr_t put_atomic_dispatch_table[PUT_REDUCE_OPS][INDEXING_MODES]
+                                             [td_ns::num_types]
+                                             [td_ns::num_types];
+
+using dpctl::tensor::py_internal::atomic_support::atomic_support_fn_ptr_t;
+static atomic_support_fn_ptr_t put_atomic_support_vector[td_ns::num_types];
+
 namespace py = pybind11;
 
 using dpctl::utils::keep_args_alive;
@@ -521,7 +538,8 @@ usm_ndarray_put(const dpctl::tensor::usm_ndarray &dst,
                 int axis_start,
                 std::uint8_t mode,
                 sycl::queue &exec_q,
-                const std::vector<sycl::event> &depends)
+                const std::vector<sycl::event> &depends,
+                std::uint8_t reduce_op)
 {
     std::vector<dpctl::tensor::usm_ndarray> ind = parse_py_ind(exec_q, py_ind);
     int k = ind.size();
@@ -539,6 +557,11 @@ usm_ndarray_put(const dpctl::tensor::usm_ndarray &dst,
         throw py::value_error("Mode must be 0 or 1.");
     }
 
+    if (reduce_op > PUT_REDUCE_OPS) {
+        throw py::value_error("Reduction operation must be between 0 and " +
+                              std::to_string(PUT_REDUCE_OPS));
+    }
+
     dpctl::tensor::validation::CheckWritable::throw_if_not_writable(dst);
 
     const dpctl::tensor::usm_ndarray ind_rep = ind[0];
@@ -620,6 +643,15 @@ usm_ndarray_put(const dpctl::tensor::usm_ndarray &dst,
         throw py::type_error("Array data types are not the same.");
     }
 
+    if (reduce_op != PUT_REDUCE_NONE) {
+        const auto &ctx = exec_q.get_context();
+        auto usm_type = sycl::get_pointer_type(dst_data, ctx);
+        if (!put_atomic_support_vector[dst_type_id](exec_q, usm_type)) {
+            throw py::value_error("Atomic operations are not supported for "
+                                  "the destination array");
+        }
+    }
+
     const py::ssize_t *ind_shape = ind_rep.get_shape_raw();
 
     int ind_typenum = ind_rep.get_typenum();
@@ -755,10 +787,20 @@ usm_ndarray_put(const dpctl::tensor::usm_ndarray &dst,
                     std::end(pack_deps));
     all_deps.insert(std::end(all_deps), std::begin(depends), std::end(depends));
 
-    auto fn = put_dispatch_table[mode][dst_type_id][ind_type_id];
+    auto fn =
+        (reduce_op == PUT_REDUCE_NONE)
+            ? put_dispatch_table[mode][dst_type_id][ind_type_id]
+            : put_atomic_dispatch_table[reduce_op - 1][mode][dst_type_id]
+                                       [ind_type_id];
 
     if (fn == nullptr) {
         sycl::event::wait(host_task_events);
+        if (reduce_op != PUT_REDUCE_NONE) {
+            throw std::runtime_error(
+                "Put with reduction is not supported for array data type " +
+                std::to_string(dst_type_id) + " and indices data type " +
+                std::to_string(ind_type_id));
+        }
         throw std::runtime_error("Indices must be integer type, got " +
                                  std::to_string(ind_type_id));
     }
@@ -783,6 +825,55 @@ usm_ndarray_put(const dpctl::tensor::usm_ndarray &dst,
     return std::make_pair(arg_cleanup_ev, put_generic_ev);
 }
 
+bool put_reduce_atomic_supported(const py::dtype &dtype,
+                                 std::uint8_t reduce_op,
+                                 const std::string &dst_usm_type,
+                                 sycl::queue &q)
+{
+    if (reduce_op == PUT_REDUCE_NONE || reduce_op > PUT_REDUCE_OPS) {
+        throw py::value_error("Reduction operation must be between 1 and " +
+                              std::to_string(PUT_REDUCE_OPS));
+    }
+
+    int typeid_ = -1;
+    auto array_types = td_ns::usm_ndarray_types();
+    try {
+        // NumPy type numbers are the same as in dpctl
+        typeid_ = array_types.typenum_to_lookup_id(dtype.num());
+    } catch (const std::exception &e) {
+        throw py::value_error(e.what());
+    }
+
+    sycl::usm::alloc kind = sycl::usm::alloc::unknown;
+    if (dst_usm_type == "device") {
+        kind = sycl::usm::alloc::device;
+    }
+    else if (dst_usm_type == "shared") {
+        kind = sycl::usm::alloc::shared;
+    }
+    else if (dst_usm_type == "host") {
+        kind = sycl::usm::alloc::host;
+    }
+    else {
+        throw py::value_error("Unrecognized `dst_usm_type` argument.");
+    }
+
+    // support of the data type does not depend on the mode or index type
+    static constexpr int ind_typeid = static_cast<int>(td_ns::typenum_t::INT64);
+    if (put_atomic_dispatch_table[reduce_op - 1][WRAP_MODE][typeid_]
+                                 [ind_typeid] == nullptr)
+    {
+        return false;
+    }
+
+    return put_atomic_support_vector[typeid_](q, kind);
+}
+
+template <typename fnT, typename T> struct PutAtomicSupportFactory
+{
+    fnT get() { return atomic_support::check_atomic_support<T>; }
+};
+
 void init_advanced_indexing_dispatch_tables(void)
 {
     using namespace td_ns;
@@ -804,6 +895,59 @@ void init_advanced_indexing_dispatch_tables(void)
     using dpctl::tensor::kernels::indexing::PutWrapFactory;
     DispatchTableBuilder<put_fn_ptr_t, PutWrapFactory, num_types> dtb_putwrap;
     dtb_putwrap.populate_dispatch_table(put_dispatch_table[WRAP_MODE]);
+
+    using dpctl::tensor::kernels::indexing::PutAddClipFactory;
+    DispatchTableBuilder<put_fn_ptr_t, PutAddClipFactory, num_types>
+        dtb_addclip;
+    dtb_addclip.populate_dispatch_table(
+        put_atomic_dispatch_table[PUT_REDUCE_ADD - 1][CLIP_MODE]);
+
+    using dpctl::tensor::kernels::indexing::PutAddWrapFactory;
+    DispatchTableBuilder<put_fn_ptr_t, PutAddWrapFactory, num_types>
+        dtb_addwrap;
+    dtb_addwrap.populate_dispatch_table(
+        put_atomic_dispatch_table[PUT_REDUCE_ADD - 1][WRAP_MODE]);
+
+    using dpctl::tensor::kernels::indexing::PutMultiplyClipFactory;
+    DispatchTableBuilder<put_fn_ptr_t, PutMultiplyClipFactory, num_types>
+        dtb_mulclip;
+    dtb_mulclip.populate_dispatch_table(
+        put_atomic_dispatch_table[PUT_REDUCE_MUL - 1][CLIP_MODE]);
+
+    using dpctl::tensor::kernels::indexing::PutMultiplyWrapFactory;
+    DispatchTableBuilder<put_fn_ptr_t, PutMultiplyWrapFactory, num_types>
+        dtb_mulwrap;
+    dtb_mulwrap.populate_dispatch_table(
+        put_atomic_dispatch_table[PUT_REDUCE_MUL - 1][WRAP_MODE]);
+
+    using dpctl::tensor::kernels::indexing::PutMaxClipFactory;
+    DispatchTableBuilder<put_fn_ptr_t, PutMaxClipFactory, num_types>
+        dtb_maxclip;
+    dtb_maxclip.populate_dispatch_table(
+        put_atomic_dispatch_table[PUT_REDUCE_MAX - 1][CLIP_MODE]);
+
+    using dpctl::tensor::kernels::indexing::PutMaxWrapFactory;
+    DispatchTableBuilder<put_fn_ptr_t, PutMaxWrapFactory, num_types>
+        dtb_maxwrap;
+    dtb_maxwrap.populate_dispatch_table(
+        put_atomic_dispatch_table[PUT_REDUCE_MAX - 1][WRAP_MODE]);
+
+    using dpctl::tensor::kernels::indexing::PutMinClipFactory;
+    DispatchTableBuilder<put_fn_ptr_t, PutMinClipFactory, num_types>
+        dtb_minclip;
+    dtb_minclip.populate_dispatch_table(
+        put_atomic_dispatch_table[PUT_REDUCE_MIN - 1][CLIP_MODE]);
+
+    using dpctl::tensor::kernels::indexing::PutMinWrapFactory;
+    DispatchTableBuilder<put_fn_ptr_t, PutMinWrapFactory, num_types>
+        dtb_minwrap;
+    dtb_minwrap.populate_dispatch_table(
+        put_atomic_dispatch_table[PUT_REDUCE_MIN - 1][WRAP_MODE]);
+
+    DispatchVectorBuilder<atomic_support_fn_ptr_t, PutAtomicSupportFactory,
+                          num_types>
+        dvb_atomic_support;
+    dvb_atomic_support.populate_dispatch_vector(put_atomic_support_vector);
 }
 
 } // namespace py_internal
@@ -24,6 +24,7 @@
 //===----------------------------------------------------------------------===//
 
 #pragma once
+#include <string>
 #include <sycl/sycl.hpp>
 #include <utility>
 #include <vector>
@@ -54,7 +55,13 @@ usm_ndarray_put(const dpctl::tensor::usm_ndarray &,
                 int,
                 std::uint8_t,
                 sycl::queue &,
-                const std::vector<sycl::event> & = {});
+                const std::vector<sycl::event> & = {},
+                std::uint8_t = 0);
+
+extern bool put_reduce_atomic_supported(const py::dtype &,
+                                        std::uint8_t,
+                                        const std::string &,
+                                        sycl::queue &);
 
 extern void init_advanced_indexing_dispatch_tables(void);
 
@@ -0,0 +1,59 @@
+//===-- ------------ Implementation of _tensor_impl module  ----*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===--------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines a function exposing statistics of the kernel launch
+/// cache of a dpctl.tensor extension module
+//===--------------------------------------------------------------------===//
+
+#include <pybind11/pybind11.h>
+
+#include "kernel_launch_cache_stats.hpp"
+#include "utils/kernel_launch_cache.hpp"
+
+namespace py = pybind11;
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+void init_kernel_launch_cache_stats(py::module_ m)
+{
+    auto stats = []() {
+        using dpctl::tensor::sycl_utils::KernelLaunchCache;
+        KernelLaunchCache &cache = KernelLaunchCache::get();
+
+        py::dict res;
+        res["hits"] = cache.get_num_hits();
+        res["misses"] = cache.get_num_misses();
+        res["entries"] = cache.get_num_entries();
+        return res;
+    };
+    m.def("_kernel_launch_cache_stats", stats,
+          "Returns dictionary with numbers of hits, misses and entries of "
+          "the cache of kernel bundles used by kernels of this module");
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
@@ -25,6 +25,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <optional>
 #include <stdexcept>
 #include <sycl/sycl.hpp>
 #include <utility>
@@ -38,9 +39,11 @@
 #include "dot.hpp"
 #include "dot_atomic_support.hpp"
 #include "dot_dispatch.hpp"
+#include "gemm_tuning.hpp"
 #include "elementwise_functions/elementwise_functions_type_utils.hpp"
 #include "kernels/linalg_functions/dot_product.hpp"
 #include "kernels/linalg_functions/gemm.hpp"
+#include "kernels/linalg_functions/gemm_tiled.hpp"
 #include "reductions/reduction_atomic_support.hpp"
 #include "simplify_iteration_space.hpp"
 #include "utils/memory_overlap.hpp"
@@ -101,6 +104,14 @@ static gemm_batch_contig_impl_fn_ptr_t
 static gemm_batch_contig_impl_fn_ptr_t
     gemm_batch_contig_temps_dispatch_table[td_ns::num_types][td_ns::num_types];
 
+using dpctl::tensor::kernels::gemm_batch_contig_tiled_impl_fn_ptr_t;
+static gemm_batch_contig_tiled_impl_fn_ptr_t
+    gemm_batch_contig_tiled_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+using dpctl::tensor::kernels::gemm_batch_strided_tiled_impl_fn_ptr_t;
+static gemm_batch_strided_tiled_impl_fn_ptr_t
+    gemm_batch_strided_tiled_dispatch_table[td_ns::num_types][td_ns::num_types];
+
 void init_dot_dispatch_tables(void)
 {
     using dpctl::tensor::py_internal::DotTypeMapFactory;
@@ -179,6 +190,16 @@ void init_dot_dispatch_tables(void)
                                 td_ns::num_types>
         dtb13;
     dtb13.populate_dispatch_table(dot_product_contig_temps_dispatch_table);
+
+    td_ns::DispatchTableBuilder<gemm_batch_contig_tiled_impl_fn_ptr_t,
+                                GemmBatchContigTiledFactory, td_ns::num_types>
+        dtb14;
+    dtb14.populate_dispatch_table(gemm_batch_contig_tiled_dispatch_table);
+
+    td_ns::DispatchTableBuilder<gemm_batch_strided_tiled_impl_fn_ptr_t,
+                                GemmBatchStridedTiledFactory, td_ns::num_types>
+        dtb15;
+    dtb15.populate_dispatch_table(gemm_batch_strided_tiled_dispatch_table);
 }
 
 using atomic_support::atomic_support_fn_ptr_t;
@@ -194,6 +215,82 @@ void init_dot_atomic_support_vector(void)
     dvb.populate_dispatch_vector(dot_atomic_support_vector);
 }
 
+/*! @brief Submits tiled GEMM of `batches` C-contiguous matrices if it
+ *         supports their data types and sizes, returns `std::nullopt`
+ *         otherwise */
+static std::optional<sycl::event>
+try_gemm_batch_contig_tiled(sycl::queue &exec_q,
+                            int x1_typeid,
+                            int x2_typeid,
+                            int dst_typeid,
+                            std::size_t dst_elem_size,
+                            const char *x1_data,
+                            const char *x2_data,
+                            char *dst_data,
+                            std::size_t batches,
+                            std::size_t n,
+                            std::size_t k,
+                            std::size_t m,
+                            py::ssize_t x1_batch_offset,
+                            py::ssize_t x2_batch_offset,
+                            py::ssize_t dst_batch_offset,
+                            const std::vector<sycl::event> &depends)
+{
+    auto fn = gemm_batch_contig_tiled_dispatch_table[x1_typeid][x2_typeid];
+    if (fn == nullptr || !use_tiled_gemm(n, k, m)) {
+        return std::nullopt;
+    }
+
+    const int config_id =
+        get_gemm_tile_config(exec_q, dst_typeid, dst_elem_size, fn, n, k, m);
+
+    return fn(exec_q, x1_data, x2_data, dst_data, batches, n, k, m,
+              x1_batch_offset, x2_batch_offset, dst_batch_offset, config_id,
+              depends);
+}
+
+/*! @brief Submits tiled GEMM of `batches` matrices with given batch, row
+ *         and column strides if it supports their data types and sizes,
+ *         returns `std::nullopt` otherwise */
+static std::optional<sycl::event>
+try_gemm_batch_strided_tiled(sycl::queue &exec_q,
+                             int x1_typeid,
+                             int x2_typeid,
+                             int dst_typeid,
+                             std::size_t dst_elem_size,
+                             const char *x1_data,
+                             const char *x2_data,
+                             char *dst_data,
+                             std::size_t batches,
+                             std::size_t n,
+                             std::size_t k,
+                             std::size_t m,
+                             py::ssize_t x1_offset,
+                             const py::ssize_t (&x1_strides)[3],
+                             py::ssize_t x2_offset,
+                             const py::ssize_t (&x2_strides)[3],
+                             py::ssize_t dst_offset,
+                             const py::ssize_t (&dst_strides)[3],
+                             const std::vector<sycl::event> &depends)
+{
+    auto fn = gemm_batch_strided_tiled_dispatch_table[x1_typeid][x2_typeid];
+    if (fn == nullptr || !use_tiled_gemm(n, k, m)) {
+        return std::nullopt;
+    }
+
+    // tile configurations are tuned on contiguous operands
+    auto tuning_fn =
+        gemm_batch_contig_tiled_dispatch_table[x1_typeid][x2_typeid];
+    const int config_id = get_gemm_tile_config(
+        exec_q, dst_typeid, dst_elem_size, tuning_fn, n, k, m);
+
+    return fn(exec_q, x1_data, x2_data, dst_data, batches, n, k, m, x1_offset,
+              x1_strides[0], x1_strides[1], x1_strides[2], x2_offset,
+              x2_strides[0], x2_strides[1], x2_strides[2], dst_offset,
+              dst_strides[0], dst_strides[1], dst_strides[2], config_id,
+              depends);
+}
+
 std::pair<sycl::event, sycl::event>
 py_dot(const dpctl::tensor::usm_ndarray &x1,
        const dpctl::tensor::usm_ndarray &x2,
@@ -517,6 +614,21 @@ py_dot(const dpctl::tensor::usm_ndarray &x1,
     else { // if (!call_vecdot)
         if (!call_batched) {
             if ((is_x1_c_contig && is_x2_c_contig && is_dst_c_contig)) {
+                static constexpr std::size_t single_batch = 1;
+                static constexpr py::ssize_t zero_offset = 0;
+                auto tiled_ev = try_gemm_batch_contig_tiled(
+                    exec_q, x1_typeid, x2_typeid, dst_typeid,
+                    dst.get_elemsize(), x1_data, x2_data, dst_data,
+                    single_batch, x1_outer_nelems, inner_nelems,
+                    x2_outer_nelems, zero_offset, zero_offset, zero_offset,
+                    depends);
+                if (tiled_ev) {
+                    dot_ev = *tiled_ev;
+                    return std::make_pair(dpctl::utils::keep_args_alive(
+                                              exec_q, {x1, x2, dst}, {dot_ev}),
+                                          dot_ev);
+                }
+
                 gemm_contig_impl_fn_ptr_t fn = nullptr;
                 if (supports_atomics) {
                     fn =
@@ -536,6 +648,29 @@ py_dot(const dpctl::tensor::usm_ndarray &x1,
                                           dot_ev);
                 }
             }
+            if (x1_outer_dims == 1 && x2_outer_dims == 1 && inner_dims == 1) {
+                // matrices with arbitrary strides, e.g. transposed
+                static constexpr std::size_t single_batch = 1;
+                static constexpr py::ssize_t zero_offset = 0;
+                const py::ssize_t x1_mat_strides[3] = {0, x1_strides_vec[0],
+                                                       x1_strides_vec[1]};
+                const py::ssize_t x2_mat_strides[3] = {0, x2_strides_vec[0],
+                                                       x2_strides_vec[1]};
+                const py::ssize_t dst_mat_strides[3] = {0, dst_strides_vec[0],
+                                                        dst_strides_vec[1]};
+                auto tiled_ev = try_gemm_batch_strided_tiled(
+                    exec_q, x1_typeid, x2_typeid, dst_typeid,
+                    dst.get_elemsize(), x1_data, x2_data, dst_data,
+                    single_batch, x1_outer_nelems, inner_nelems,
+                    x2_outer_nelems, zero_offset, x1_mat_strides, zero_offset,
+                    x2_mat_strides, zero_offset, dst_mat_strides, depends);
+                if (tiled_ev) {
+                    dot_ev = *tiled_ev;
+                    return std::make_pair(dpctl::utils::keep_args_alive(
+                                              exec_q, {x1, x2, dst}, {dot_ev}),
+                                          dot_ev);
+                }
+            }
             gemm_impl_fn_ptr_t fn = nullptr;
             if (supports_atomics) {
                 fn = gemm_atomic_dispatch_table[x1_typeid][x2_typeid];
@@ -591,6 +726,19 @@ py_dot(const dpctl::tensor::usm_ndarray &x1,
             assert(inner_dims == 1);
 
             if ((is_x1_c_contig && is_x2_c_contig && is_dst_c_contig)) {
+                static constexpr py::ssize_t zero_offset = 0;
+                auto tiled_ev = try_gemm_batch_contig_tiled(
+                    exec_q, x1_typeid, x2_typeid, dst_typeid,
+                    dst.get_elemsize(), x1_data, x2_data, dst_data, batches,
+                    x1_outer_nelems, inner_nelems, x2_outer_nelems,
+                    zero_offset, zero_offset, zero_offset, depends);
+                if (tiled_ev) {
+                    dot_ev = *tiled_ev;
+                    return std::make_pair(dpctl::utils::keep_args_alive(
+                                              exec_q, {x1, x2, dst}, {dot_ev}),
+                                          dot_ev);
+                }
+
                 gemm_batch_contig_impl_fn_ptr_t fn = nullptr;
                 if (supports_atomics) {
                     fn = gemm_batch_contig_atomic_dispatch_table[x1_typeid]
@@ -698,6 +846,20 @@ py_dot(const dpctl::tensor::usm_ndarray &x1,
                 }
 
                 if (gemm_batch_c_contig) {
+                    auto tiled_ev = try_gemm_batch_contig_tiled(
+                        exec_q, x1_typeid, x2_typeid, dst_typeid,
+                        dst.get_elemsize(), x1_data, x2_data, dst_data,
+                        batches, x1_outer_nelems, inner_nelems,
+                        x2_outer_nelems, x1_batch_offset, x2_batch_offset,
+                        dst_batch_offset, depends);
+                    if (tiled_ev) {
+                        dot_ev = *tiled_ev;
+                        return std::make_pair(
+                            dpctl::utils::keep_args_alive(exec_q, {x1, x2, dst},
+                                                          {dot_ev}),
+                            dot_ev);
+                    }
+
                     gemm_batch_contig_impl_fn_ptr_t fn = nullptr;
                     if (supports_atomics) {
                         fn = gemm_batch_contig_atomic_dispatch_table[x1_typeid]
@@ -720,6 +882,31 @@ py_dot(const dpctl::tensor::usm_ndarray &x1,
                             dot_ev);
                     }
                 }
+
+                // matrices with arbitrary strides, e.g. transposed or
+                // broadcast along the batch dimension
+                const py::ssize_t x1_mat_strides[3] = {
+                    simplified_batch_x1_strides[0], outer_inner_x1_strides[0],
+                    outer_inner_x1_strides[1]};
+                const py::ssize_t x2_mat_strides[3] = {
+                    simplified_batch_x2_strides[0], outer_inner_x2_strides[0],
+                    outer_inner_x2_strides[1]};
+                const py::ssize_t dst_mat_strides[3] = {
+                    simplified_batch_dst_strides[0],
+                    outer_inner_dst_strides[0], outer_inner_dst_strides[1]};
+                auto tiled_ev = try_gemm_batch_strided_tiled(
+                    exec_q, x1_typeid, x2_typeid, dst_typeid,
+                    dst.get_elemsize(), x1_data, x2_data, dst_data, batches,
+                    x1_outer_nelems, inner_nelems, x2_outer_nelems,
+                    x1_batch_offset, x1_mat_strides, x2_batch_offset,
+                    x2_mat_strides, dst_batch_offset, dst_mat_strides,
+                    depends);
+                if (tiled_ev) {
+                    dot_ev = *tiled_ev;
+                    return std::make_pair(dpctl::utils::keep_args_alive(
+                                              exec_q, {x1, x2, dst}, {dot_ev}),
+                                          dot_ev);
+                }
             }
 
             gemm_batch_impl_fn_ptr_t fn = nullptr;
@@ -30,6 +30,7 @@
 
 #include "kernels/linalg_functions/dot_product.hpp"
 #include "kernels/linalg_functions/gemm.hpp"
+#include "kernels/linalg_functions/gemm_tiled.hpp"
 #include "utils/type_dispatch_building.hpp"
 
 namespace dpctl
@@ -315,6 +316,48 @@ struct GemmBatchContigTempsFactory
     }
 };
 
+template <typename fnT, typename T1, typename T2>
+struct GemmBatchContigTiledFactory
+{
+    fnT get()
+    {
+        // tiled GEMM is only provided for real floating point types
+        if constexpr (std::is_same_v<T1, T2> &&
+                      (std::is_same_v<T1, float> ||
+                       std::is_same_v<T1, double>))
+        {
+            using dpctl::tensor::kernels::gemm_batch_contig_tiled_impl;
+            fnT fn = gemm_batch_contig_tiled_impl<T1, T2, T1>;
+            return fn;
+        }
+        else {
+            fnT fn = nullptr;
+            return fn;
+        }
+    }
+};
+
+template <typename fnT, typename T1, typename T2>
+struct GemmBatchStridedTiledFactory
+{
+    fnT get()
+    {
+        // tiled GEMM is only provided for real floating point types
+        if constexpr (std::is_same_v<T1, T2> &&
+                      (std::is_same_v<T1, float> ||
+                       std::is_same_v<T1, double>))
+        {
+            using dpctl::tensor::kernels::gemm_batch_strided_tiled_impl;
+            fnT fn = gemm_batch_strided_tiled_impl<T1, T2, T1>;
+            return fn;
+        }
+        else {
+            fnT fn = nullptr;
+            return fn;
+        }
+    }
+};
+
 template <typename fnT, typename T1, typename T2> struct DotProductAtomicFactory
 {
     fnT get()
@@ -0,0 +1,335 @@
+//===-- ------------ Implementation of _tensor_impl module  ----*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines selection of tile configurations of tiled GEMM
+/// kernels, tuned once per device and persisted on disk.
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <sycl/sycl.hpp>
+#include <unordered_map>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+
+#include "gemm_tuning.hpp"
+#include "kernels/linalg_functions/gemm_tiled.hpp"
+#include "utils/sycl_alloc_utils.hpp"
+
+namespace py = pybind11;
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+namespace
+{
+
+using dpctl::tensor::kernels::gemm_batch_contig_tiled_impl_fn_ptr_t;
+
+/*! @brief Size class of a matrix dimension, and its representative size
+ *         used for tuning */
+int size_class(std::size_t d) { return (d < 128) ? 0 : ((d < 1024) ? 1 : 2); }
+
+std::size_t size_class_representative(int cls)
+{
+    static constexpr std::size_t representatives[] = {64, 512, 1024};
+    return representatives[cls];
+}
+
+std::string gemm_tuning_cache_path()
+{
+    if (const char *path = std::getenv("DPCTL_GEMM_TUNING_CACHE")) {
+        // empty value disables persisting of tuning results
+        return std::string(path);
+    }
+    const char *xdg_cache = std::getenv("XDG_CACHE_HOME");
+    if (xdg_cache && *xdg_cache) {
+        return std::string(xdg_cache) + "/dpctl/gemm_tuning.txt";
+    }
+#ifdef _WIN32
+    const char *local_app_data = std::getenv("LOCALAPPDATA");
+    if (local_app_data && *local_app_data) {
+        return std::string(local_app_data) + "\\dpctl\\gemm_tuning.txt";
+    }
+#else
+    const char *home = std::getenv("HOME");
+    if (home && *home) {
+        return std::string(home) + "/.cache/dpctl/gemm_tuning.txt";
+    }
+#endif
+    return std::string{};
+}
+
+bool gemm_autotuning_enabled()
+{
+    const char *flag = std::getenv("DPCTL_GEMM_AUTOTUNE");
+    return !(flag && std::string(flag) == "0");
+}
+
+/*! @brief Tile configurations chosen for keys describing device, data type
+ *         and size classes, backed by a text file with lines
+ *         `<config_id> <key>` */
+class GemmTuningCache
+{
+private:
+    std::mutex mu_{};
+    bool loaded_ = false;
+    std::string path_{};
+    std::unordered_map<std::string, int> choices_{};
+
+    void load(const std::string &path)
+    {
+        loaded_ = true;
+        path_ = path;
+        choices_.clear();
+        if (path_.empty()) {
+            return;
+        }
+        std::ifstream in(path_);
+        std::string line;
+        while (std::getline(in, line)) {
+            std::istringstream line_stream(line);
+            int config_id = -1;
+            if (!(line_stream >> config_id) || config_id < 0 ||
+                config_id >= dpctl::tensor::kernels::gemm_tiled_num_configs)
+            {
+                continue;
+            }
+            std::string key;
+            std::getline(line_stream >> std::ws, key);
+            if (!key.empty()) {
+                // later entries take precedence
+                choices_[key] = config_id;
+            }
+        }
+    }
+
+public:
+    std::mutex &mutex() { return mu_; }
+
+    std::optional<int> lookup(const std::string &key)
+    {
+        // the cache file is chosen by the environment, which may change
+        // between calls
+        const std::string &path = gemm_tuning_cache_path();
+        if (!loaded_ || path != path_) {
+            load(path);
+        }
+        const auto &pos = choices_.find(key);
+        if (pos == choices_.end()) {
+            return std::nullopt;
+        }
+        return pos->second;
+    }
+
+    void store(const std::string &key, int config_id)
+    {
+        choices_[key] = config_id;
+        if (path_.empty()) {
+            return;
+        }
+        // cache is best effort, failures to persist are ignored
+        std::error_code ec;
+        const std::filesystem::path cache_path(path_);
+        if (cache_path.has_parent_path()) {
+            std::filesystem::create_directories(cache_path.parent_path(), ec);
+        }
+        std::ofstream out(path_, std::ios::app);
+        if (out) {
+            out << config_id << " " << key << "\n";
+        }
+    }
+};
+
+GemmTuningCache &get_gemm_tuning_cache()
+{
+    static GemmTuningCache cache{};
+    return cache;
+}
+
+std::string gemm_tuning_key(const sycl::device &dev,
+                            int type_id,
+                            std::size_t n,
+                            std::size_t k,
+                            std::size_t m)
+{
+    std::ostringstream key;
+    key << dev.get_info<sycl::info::device::name>() << ";"
+        << dev.get_info<sycl::info::device::driver_version>() << ";"
+        << type_id << ";" << size_class(n) << size_class(k) << size_class(m);
+    return key.str();
+}
+
+int default_gemm_tile_config(const sycl::device &dev,
+                             std::size_t elem_size,
+                             std::size_t n,
+                             std::size_t m)
+{
+    // larger tiles only pay off when the result is large enough to
+    // keep all compute units busy
+    if (std::min(n, m) >= 512 &&
+        dpctl::tensor::kernels::gemm_tiled_config_is_supported(dev, 1,
+                                                               elem_size))
+    {
+        return 1;
+    }
+    return 0;
+}
+
+int tune_gemm_tile_config(sycl::queue &exec_q,
+                          std::size_t elem_size,
+                          gemm_batch_contig_tiled_impl_fn_ptr_t fn,
+                          std::size_t n,
+                          std::size_t k,
+                          std::size_t m)
+{
+    const sycl::device &dev = exec_q.get_device();
+
+    const std::size_t n_rep = size_class_representative(size_class(n));
+    const std::size_t k_rep = size_class_representative(size_class(k));
+    const std::size_t m_rep = size_class_representative(size_class(m));
+
+    using dpctl::tensor::alloc_utils::smart_malloc_device;
+    const std::size_t lhs_nbytes = n_rep * k_rep * elem_size;
+    const std::size_t rhs_nbytes = k_rep * m_rep * elem_size;
+    const std::size_t res_nbytes = n_rep * m_rep * elem_size;
+    auto lhs_owner = smart_malloc_device<char>(lhs_nbytes, exec_q);
+    auto rhs_owner = smart_malloc_device<char>(rhs_nbytes, exec_q);
+    auto res_owner = smart_malloc_device<char>(res_nbytes, exec_q);
+
+    // all-zero bits represent zero of every supported type
+    sycl::event fill_lhs_ev = exec_q.memset(lhs_owner.get(), 0, lhs_nbytes);
+    sycl::event fill_rhs_ev = exec_q.memset(rhs_owner.get(), 0, rhs_nbytes);
+    sycl::event::wait({fill_lhs_ev, fill_rhs_ev});
+
+    static constexpr int n_timed_runs = 2;
+    static constexpr std::size_t single_batch = 1;
+    static constexpr py::ssize_t zero_offset = 0;
+
+    int best_config = default_gemm_tile_config(dev, elem_size, n, m);
+    double best_time = std::numeric_limits<double>::infinity();
+    for (int config_id = 0;
+         config_id < dpctl::tensor::kernels::gemm_tiled_num_configs;
+         ++config_id)
+    {
+        if (!dpctl::tensor::kernels::gemm_tiled_config_is_supported(
+                dev, config_id, elem_size))
+        {
+            continue;
+        }
+        try {
+            // warm-up run triggers JIT compilation of the kernel
+            fn(exec_q, lhs_owner.get(), rhs_owner.get(), res_owner.get(),
+               single_batch, n_rep, k_rep, m_rep, zero_offset, zero_offset,
+               zero_offset, config_id, {})
+                .wait();
+
+            const auto start = std::chrono::steady_clock::now();
+            for (int run = 0; run < n_timed_runs; ++run) {
+                fn(exec_q, lhs_owner.get(), rhs_owner.get(), res_owner.get(),
+                   single_batch, n_rep, k_rep, m_rep, zero_offset, zero_offset,
+                   zero_offset, config_id, {})
+                    .wait();
+            }
+            const std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+
+            if (elapsed.count() < best_time) {
+                best_time = elapsed.count();
+                best_config = config_id;
+            }
+        } catch (const std::exception &) {
+            // configuration failed to build or run on this device
+            continue;
+        }
+    }
+
+    return best_config;
+}
+
+} // end of anonymous namespace
+
+bool use_tiled_gemm(std::size_t n, std::size_t k, std::size_t m)
+{
+    // small problems are better served by kernels parallelizing over
+    // the inner dimension
+    return (std::min(n, m) >= 32) && (k >= 16);
+}
+
+int get_gemm_tile_config(sycl::queue &exec_q,
+                         int type_id,
+                         std::size_t elem_size,
+                         gemm_batch_contig_tiled_impl_fn_ptr_t fn,
+                         std::size_t n,
+                         std::size_t k,
+                         std::size_t m)
+{
+    const sycl::device &dev = exec_q.get_device();
+    const std::string &key = gemm_tuning_key(dev, type_id, n, k, m);
+
+    GemmTuningCache &cache = get_gemm_tuning_cache();
+
+    // the mutex is held while tuning synchronizes with the device, and host
+    // tasks of previously submitted operations may need the GIL to complete,
+    // so never wait for the mutex while holding the GIL
+    py::gil_scoped_release release{};
+
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex());
+        if (auto config_id = cache.lookup(key)) {
+            return *config_id;
+        }
+    }
+
+    // default configuration is not cached, so that enabling autotuning
+    // later takes effect
+    if (!gemm_autotuning_enabled()) {
+        return default_gemm_tile_config(dev, elem_size, n, m);
+    }
+
+    std::lock_guard<std::mutex> lock(cache.mutex());
+    if (auto cached_id = cache.lookup(key)) {
+        return *cached_id;
+    }
+    const int config_id = tune_gemm_tile_config(exec_q, elem_size, fn, n, k, m);
+    cache.store(key, config_id);
+
+    return config_id;
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
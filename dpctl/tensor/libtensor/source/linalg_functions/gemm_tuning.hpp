@@ -0,0 +1,63 @@
+//===-- ------------ Implementation of _tensor_impl module  ----*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file declares selection of tile configurations of tiled GEMM
+/// kernels, tuned once per device and persisted on disk.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+#include <cstddef>
+#include <sycl/sycl.hpp>
+
+#include "kernels/linalg_functions/gemm_tiled.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+/*! @brief Whether tiled GEMM should be used to multiply matrices of shapes
+ *         `(n, k)` and `(k, m)` */
+extern bool use_tiled_gemm(std::size_t n, std::size_t k, std::size_t m);
+
+/*! @brief Returns tile configuration of tiled GEMM to multiply matrices of
+ *         shapes `(n, k)` and `(k, m)` with elements of type `type_id`.
+ *
+ * The configuration is chosen per device, data type, and size class of
+ * every dimension. Unless found in the on-disk cache, it is selected by
+ * timing `fn` for every configuration supported by the device, and the
+ * choice is persisted. Setting environment variable `DPCTL_GEMM_AUTOTUNE`
+ * to `0` disables timing in favor of a default configuration.
+ */
+extern int get_gemm_tile_config(
+    sycl::queue &exec_q,
+    int type_id,
+    std::size_t elem_size,
+    dpctl::tensor::kernels::gemm_batch_contig_tiled_impl_fn_ptr_t fn,
+    std::size_t n,
+    std::size_t k,
+    std::size_t m);
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
@@ -0,0 +1,355 @@
+//===-- ------------ Implementation of _tensor_impl module  ----*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===--------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_impl extensions
+//===--------------------------------------------------------------------===//
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "dpctl4pybind11.hpp"
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <sycl/sycl.hpp>
+
+#include "kernels/histogram.hpp"
+#include "reduction_atomic_support.hpp"
+#include "utils/memory_overlap.hpp"
+#include "utils/output_validation.hpp"
+#include "utils/type_dispatch.hpp"
+
+#include "histogram.hpp"
+
+namespace py = pybind11;
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+namespace td_ns = dpctl::tensor::type_dispatch;
+
+namespace impl
+{
+
+using dpctl::tensor::kernels::histogram::bincount_fn_ptr_t;
+using dpctl::tensor::kernels::histogram::histogram_fn_ptr_t;
+
+static bincount_fn_ptr_t bincount_dispatch_table[td_ns::num_types]
+                                                [td_ns::num_types];
+static histogram_fn_ptr_t histogram_dispatch_table[td_ns::num_types]
+                                                  [td_ns::num_types];
+
+using atomic_support::atomic_support_fn_ptr_t;
+static atomic_support_fn_ptr_t
+    histogram_atomic_support_vector[td_ns::num_types];
+
+/*! @brief Types of bins: counts, or sums of real floating-point weights */
+template <typename resT> struct HistogramBinsTypeSupport
+{
+    static constexpr bool is_defined =
+        std::is_same_v<resT, std::int64_t> || std::is_same_v<resT, float> ||
+        std::is_same_v<resT, double>;
+};
+
+template <typename fnT, typename T1, typename T2> struct BincountFactory
+{
+    fnT get()
+    {
+        if constexpr (std::is_integral_v<T1> && !std::is_same_v<T1, bool> &&
+                      HistogramBinsTypeSupport<T2>::is_defined)
+        {
+            using dpctl::tensor::kernels::histogram::bincount_impl;
+            return bincount_impl<T1, T2>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename T1, typename T2> struct HistogramFactory
+{
+    fnT get()
+    {
+        if constexpr ((std::is_same_v<T1, float> ||
+                       std::is_same_v<T1, double>) &&
+                      HistogramBinsTypeSupport<T2>::is_defined)
+        {
+            using dpctl::tensor::kernels::histogram::histogram_by_edges_impl;
+            return histogram_by_edges_impl<T1, T2>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename T> struct HistogramAtomicSupportFactory
+{
+    // bins are accumulated atomically regardless of their type, merging
+    // does not change the order of accumulation
+    fnT get() { return atomic_support::check_atomic_support<T>; }
+};
+
+void populate_histogram_dispatch_tables(void)
+{
+    td_ns::DispatchTableBuilder<bincount_fn_ptr_t, BincountFactory,
+                                td_ns::num_types>
+        dtb1;
+    dtb1.populate_dispatch_table(bincount_dispatch_table);
+
+    td_ns::DispatchTableBuilder<histogram_fn_ptr_t, HistogramFactory,
+                                td_ns::num_types>
+        dtb2;
+    dtb2.populate_dispatch_table(histogram_dispatch_table);
+
+    td_ns::DispatchVectorBuilder<atomic_support_fn_ptr_t,
+                                 HistogramAtomicSupportFactory,
+                                 td_ns::num_types>
+        dvb;
+    dvb.populate_dispatch_vector(histogram_atomic_support_vector);
+}
+
+} // namespace impl
+
+namespace
+{
+
+/*! @brief Validates arguments common to histogram functions and returns
+ *  type id of bins */
+int validate_histogram_args(
+    const dpctl::tensor::usm_ndarray &src,
+    const std::optional<dpctl::tensor::usm_ndarray> &weights,
+    const dpctl::tensor::usm_ndarray &dst,
+    sycl::queue &exec_q)
+{
+    if (src.get_ndim() != 1) {
+        throw py::value_error("Input array must be a vector");
+    }
+    if (dst.get_ndim() != 1 || !dst.is_c_contiguous()) {
+        throw py::value_error("Array of bins must be a contiguous vector");
+    }
+    if (dst.get_size() == 0) {
+        throw py::value_error("Array of bins must not be empty");
+    }
+    if (weights) {
+        if (weights->get_ndim() != 1 ||
+            weights->get_size() != src.get_size())
+        {
+            throw py::value_error(
+                "Weights must be a vector with the shape of the input array");
+        }
+        if (weights->get_typenum() != dst.get_typenum()) {
+            throw py::value_error(
+                "Weights and bins must have the same data type");
+        }
+    }
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {src, dst}) ||
+        (weights && !dpctl::utils::queues_are_compatible(exec_q, {*weights})))
+    {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    dpctl::tensor::validation::CheckWritable::throw_if_not_writable(dst);
+
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(dst, src) || (weights && overlap(dst, *weights))) {
+        throw py::value_error("Array of bins overlaps with inputs");
+    }
+
+    const auto &array_types = td_ns::usm_ndarray_types();
+    const int dst_typeid = array_types.typenum_to_lookup_id(dst.get_typenum());
+
+    // weights are accumulated atomically, while counts are accumulated
+    // with 32-bit counters on devices without 64-bit atomics
+    if (weights && dst.get_elemsize() == 8 &&
+        !exec_q.get_device().has(sycl::aspect::atomic64))
+    {
+        throw py::value_error("Histogram with 64-bit weights requires device "
+                              "support of 64-bit atomic operations");
+    }
+
+    return dst_typeid;
+}
+
+bool bins_support_atomics(const dpctl::tensor::usm_ndarray &dst,
+                          int dst_typeid,
+                          sycl::queue &exec_q)
+{
+    const auto &ctx = exec_q.get_context();
+    auto usm_type = sycl::get_pointer_type(dst.get_data(), ctx);
+
+    return impl::histogram_atomic_support_vector[dst_typeid](exec_q,
+                                                              usm_type);
+}
+
+} // end of anonymous namespace
+
+std::pair<sycl::event, sycl::event>
+py_bincount(const dpctl::tensor::usm_ndarray &src,
+            const std::optional<dpctl::tensor::usm_ndarray> &weights,
+            const dpctl::tensor::usm_ndarray &dst,
+            sycl::queue &exec_q,
+            const std::vector<sycl::event> &depends)
+{
+    const int dst_typeid = validate_histogram_args(src, weights, dst, exec_q);
+
+    const auto &array_types = td_ns::usm_ndarray_types();
+    const int src_typeid = array_types.typenum_to_lookup_id(src.get_typenum());
+
+    auto fn = impl::bincount_dispatch_table[src_typeid][dst_typeid];
+    if (fn == nullptr) {
+        throw py::value_error("Bincount is not supported for the data types");
+    }
+
+    const std::size_t n = src.get_size();
+    const std::size_t nbins = dst.get_size();
+
+    const py::ssize_t src_stride = (n > 1) ? src.get_strides_vector()[0] : 1;
+    const char *w_data = (weights) ? weights->get_data() : nullptr;
+    const py::ssize_t w_stride =
+        (weights && n > 1) ? weights->get_strides_vector()[0] : 1;
+
+    const bool supports_atomics = bins_support_atomics(dst, dst_typeid, exec_q);
+
+    sycl::event comp_ev =
+        fn(exec_q, n, src.get_data(), src_stride, w_data, w_stride, nbins,
+           dst.get_data(), supports_atomics, depends);
+
+    // keep-alive list has fixed size, absent weights repeat the input
+    const py::object ka_objs[] = {
+        py::object(src), py::object(dst),
+        (weights) ? py::object(*weights) : py::object(src)};
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, ka_objs, {comp_ev});
+
+    return std::make_pair(ht_ev, comp_ev);
+}
+
+std::pair<sycl::event, sycl::event>
+py_histogram(const dpctl::tensor::usm_ndarray &src,
+             const std::optional<dpctl::tensor::usm_ndarray> &weights,
+             const dpctl::tensor::usm_ndarray &edges,
+             const dpctl::tensor::usm_ndarray &dst,
+             const std::optional<std::pair<double, double>> &uniform_range,
+             sycl::queue &exec_q,
+             const std::vector<sycl::event> &depends)
+{
+    const int dst_typeid = validate_histogram_args(src, weights, dst, exec_q);
+
+    const std::size_t nbins = dst.get_size();
+    if (edges.get_ndim() != 1 || !edges.is_c_contiguous() ||
+        edges.get_size() != nbins + 1)
+    {
+        throw py::value_error("Edges must be a contiguous vector with one "
+                              "more element than the array of bins");
+    }
+    if (edges.get_typenum() != src.get_typenum()) {
+        throw py::value_error(
+            "Edges and input array must have the same data type");
+    }
+    if (!dpctl::utils::queues_are_compatible(exec_q, {edges})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(dst, edges)) {
+        throw py::value_error("Array of bins overlaps with inputs");
+    }
+
+    const auto &array_types = td_ns::usm_ndarray_types();
+    const int src_typeid = array_types.typenum_to_lookup_id(src.get_typenum());
+
+    auto fn = impl::histogram_dispatch_table[src_typeid][dst_typeid];
+    if (fn == nullptr) {
+        throw py::value_error("Histogram is not supported for the data types");
+    }
+
+    bool uniform = false;
+    double norm = 0.0;
+    if (uniform_range) {
+        const auto &[first, last] = *uniform_range;
+        if (!(last > first)) {
+            throw py::value_error("Range of uniform bins must be non-empty");
+        }
+        uniform = true;
+        norm = static_cast<double>(nbins) / (last - first);
+    }
+
+    const std::size_t n = src.get_size();
+
+    const py::ssize_t src_stride = (n > 1) ? src.get_strides_vector()[0] : 1;
+    const char *w_data = (weights) ? weights->get_data() : nullptr;
+    const py::ssize_t w_stride =
+        (weights && n > 1) ? weights->get_strides_vector()[0] : 1;
+
+    const bool supports_atomics = bins_support_atomics(dst, dst_typeid, exec_q);
+
+    sycl::event comp_ev =
+        fn(exec_q, n, src.get_data(), src_stride, w_data, w_stride,
+           edges.get_data(), nbins, uniform, norm, dst.get_data(),
+           supports_atomics, depends);
+
+    // keep-alive list has fixed size, absent weights repeat the input
+    const py::object ka_objs[] = {
+        py::object(src), py::object(edges), py::object(dst),
+        (weights) ? py::object(*weights) : py::object(src)};
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, ka_objs, {comp_ev});
+
+    return std::make_pair(ht_ev, comp_ev);
+}
+
+void init_histogram(py::module_ m)
+{
+    impl::populate_histogram_dispatch_tables();
+
+    m.def("_bincount", &py_bincount,
+          "Counts occurrences of non-negative integers of vector `src`, "
+          "optionally weighted by vector `weights`, into contiguous vector "
+          "`dst` of bins. Values not less than the number of bins are "
+          "ignored.",
+          py::arg("src"), py::arg("weights"), py::arg("dst"),
+          py::arg("sycl_queue"), py::arg("depends") = py::list());
+
+    m.def("_histogram", &py_histogram,
+          "Computes histogram of vector `src`, optionally weighted by vector "
+          "`weights`, into contiguous vector `dst` of bins delimited by "
+          "sorted `edges`. If `uniform_range` is given, edges are equally "
+          "spaced over that range.",
+          py::arg("src"), py::arg("weights"), py::arg("edges"),
+          py::arg("dst"), py::arg("uniform_range"),
+          py::arg("sycl_queue"), py::arg("depends") = py::list());
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
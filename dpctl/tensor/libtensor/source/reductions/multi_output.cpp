@@ -0,0 +1,547 @@
+//===-- ------------ Implementation of _tensor_impl module  ----*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===--------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_impl extensions
+//===--------------------------------------------------------------------===//
+
+
+#include "dpctl4pybind11.hpp"
+#include <complex>
+#include <cstdint>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <sycl/sycl.hpp>
+#include <type_traits>
+#include <vector>
+
+#include "kernels/reductions.hpp"
+#include "reduction_over_axis.hpp"
+#include "utils/type_dispatch_building.hpp"
+
+namespace py = pybind11;
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+namespace td_ns = dpctl::tensor::type_dispatch;
+
+namespace impl
+{
+
+using dpctl::tensor::kernels::MaxArgMaxReductionOp;
+using dpctl::tensor::kernels::MinMaxReductionOp;
+using dpctl::tensor::kernels::multi_output_reduction_contig_impl_fn_ptr;
+using dpctl::tensor::kernels::multi_output_reduction_strided_impl_fn_ptr;
+using dpctl::tensor::kernels::SumSumSqReductionOp;
+
+static multi_output_reduction_strided_impl_fn_ptr
+    minmax_over_axis_strided_dispatch_table[td_ns::num_types]
+                                           [td_ns::num_types];
+static multi_output_reduction_contig_impl_fn_ptr
+    minmax_over_axis1_contig_dispatch_table[td_ns::num_types]
+                                           [td_ns::num_types];
+static multi_output_reduction_contig_impl_fn_ptr
+    minmax_over_axis0_contig_dispatch_table[td_ns::num_types]
+                                           [td_ns::num_types];
+
+static multi_output_reduction_strided_impl_fn_ptr
+    sum_sumsq_over_axis_strided_dispatch_table[td_ns::num_types]
+                                              [td_ns::num_types];
+static multi_output_reduction_contig_impl_fn_ptr
+    sum_sumsq_over_axis1_contig_dispatch_table[td_ns::num_types]
+                                              [td_ns::num_types];
+static multi_output_reduction_contig_impl_fn_ptr
+    sum_sumsq_over_axis0_contig_dispatch_table[td_ns::num_types]
+                                              [td_ns::num_types];
+
+static multi_output_reduction_strided_impl_fn_ptr
+    max_argmax_over_axis_strided_dispatch_table[td_ns::num_types]
+                                               [td_ns::num_types];
+static multi_output_reduction_contig_impl_fn_ptr
+    max_argmax_over_axis1_contig_dispatch_table[td_ns::num_types]
+                                               [td_ns::num_types];
+static multi_output_reduction_contig_impl_fn_ptr
+    max_argmax_over_axis0_contig_dispatch_table[td_ns::num_types]
+                                               [td_ns::num_types];
+
+/*! @brief Type pairs supported by reductions comparing elements, whose
+ *  first result has the type of the input */
+template <typename argTy, typename outTy>
+struct TypePairSupportForComparisonReduction
+{
+
+    static constexpr bool is_defined = std::disjunction<
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, bool>,
+        td_ns::TypePairDefinedEntry<argTy, std::int8_t, outTy, std::int8_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, std::uint8_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::int16_t, outTy, std::int16_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint16_t, outTy, std::uint16_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::int32_t, outTy, std::int32_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint32_t, outTy, std::uint32_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::int64_t, outTy, std::int64_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint64_t, outTy, std::uint64_t>,
+        td_ns::TypePairDefinedEntry<argTy, sycl::half, outTy, sycl::half>,
+        td_ns::TypePairDefinedEntry<argTy, float, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, double, outTy, double>,
+        td_ns::TypePairDefinedEntry<argTy,
+                                    std::complex<float>,
+                                    outTy,
+                                    std::complex<float>>,
+        td_ns::TypePairDefinedEntry<argTy,
+                                    std::complex<double>,
+                                    outTy,
+                                    std::complex<double>>,
+
+        // fall-through
+        td_ns::NotDefinedEntry>::is_defined;
+};
+
+/*! @brief Type pairs supported by sum and sum of squares reduction, same as
+ *  for sum */
+template <typename argTy, typename outTy>
+struct TypePairSupportForSumSumSqReduction
+{
+
+    static constexpr bool is_defined = std::disjunction<
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, std::int8_t>,
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, std::uint8_t>,
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, std::int16_t>,
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, std::uint16_t>,
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, std::int32_t>,
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, std::uint32_t>,
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, std::int64_t>,
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, std::uint64_t>,
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, double>,
+
+        // input int8_t
+        td_ns::TypePairDefinedEntry<argTy, std::int8_t, outTy, std::int8_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::int8_t, outTy, std::int16_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::int8_t, outTy, std::int32_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::int8_t, outTy, std::int64_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::int8_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::int8_t, outTy, double>,
+
+        // input uint8_t
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, std::uint8_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, std::int16_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, std::uint16_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, std::int32_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, std::uint32_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, std::int64_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, std::uint64_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, double>,
+
+        // input int16_t
+        td_ns::TypePairDefinedEntry<argTy, std::int16_t, outTy, std::int16_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::int16_t, outTy, std::int32_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::int16_t, outTy, std::int64_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::int16_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::int16_t, outTy, double>,
+
+        // input uint16_t
+        td_ns::TypePairDefinedEntry<argTy, std::uint16_t, outTy, std::uint16_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint16_t, outTy, std::int32_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint16_t, outTy, std::uint32_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint16_t, outTy, std::int64_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint16_t, outTy, std::uint64_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint16_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint16_t, outTy, double>,
+
+        // input int32_t
+        td_ns::TypePairDefinedEntry<argTy, std::int32_t, outTy, std::int32_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::int32_t, outTy, std::int64_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::int32_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::int32_t, outTy, double>,
+
+        // input uint32_t
+        td_ns::TypePairDefinedEntry<argTy, std::uint32_t, outTy, std::uint32_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint32_t, outTy, std::uint64_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint32_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint32_t, outTy, double>,
+
+        // input int64_t
+        td_ns::TypePairDefinedEntry<argTy, std::int64_t, outTy, std::int64_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::int64_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::int64_t, outTy, double>,
+
+        // input uint64_t
+        td_ns::TypePairDefinedEntry<argTy, std::uint64_t, outTy, std::uint64_t>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint64_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint64_t, outTy, double>,
+
+        // input half
+        td_ns::TypePairDefinedEntry<argTy, sycl::half, outTy, sycl::half>,
+        td_ns::TypePairDefinedEntry<argTy, sycl::half, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, sycl::half, outTy, double>,
+
+        // input float
+        td_ns::TypePairDefinedEntry<argTy, float, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, float, outTy, double>,
+
+        // input double
+        td_ns::TypePairDefinedEntry<argTy, double, outTy, double>,
+
+        // input std::complex
+        td_ns::TypePairDefinedEntry<argTy,
+                                    std::complex<float>,
+                                    outTy,
+                                    std::complex<float>>,
+        td_ns::TypePairDefinedEntry<argTy,
+                                    std::complex<float>,
+                                    outTy,
+                                    std::complex<double>>,
+
+        td_ns::TypePairDefinedEntry<argTy,
+                                    std::complex<double>,
+                                    outTy,
+                                    std::complex<double>>,
+
+        // fall-through
+        td_ns::NotDefinedEntry>::is_defined;
+};
+
+template <typename fnT, typename srcTy, typename dstTy>
+struct MinMaxOverAxisStridedFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportForComparisonReduction<srcTy,
+                                                            dstTy>::is_defined)
+        {
+            using OpT = MinMaxReductionOp<dstTy>;
+            return dpctl::tensor::kernels::
+                multi_output_over_group_temps_strided_impl<srcTy, OpT>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename srcTy, typename dstTy>
+struct MinMaxOverAxisAxis1ContigFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportForComparisonReduction<srcTy,
+                                                            dstTy>::is_defined)
+        {
+            using OpT = MinMaxReductionOp<dstTy>;
+            return dpctl::tensor::kernels::
+                multi_output_axis1_over_group_temps_contig_impl<srcTy, OpT>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename srcTy, typename dstTy>
+struct MinMaxOverAxisAxis0ContigFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportForComparisonReduction<srcTy,
+                                                            dstTy>::is_defined)
+        {
+            using OpT = MinMaxReductionOp<dstTy>;
+            return dpctl::tensor::kernels::
+                multi_output_axis0_over_group_temps_contig_impl<srcTy, OpT>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename srcTy, typename dstTy>
+struct SumSumSqOverAxisStridedFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportForSumSumSqReduction<srcTy,
+                                                          dstTy>::is_defined)
+        {
+            using OpT = SumSumSqReductionOp<dstTy>;
+            return dpctl::tensor::kernels::
+                multi_output_over_group_temps_strided_impl<srcTy, OpT>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename srcTy, typename dstTy>
+struct SumSumSqOverAxisAxis1ContigFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportForSumSumSqReduction<srcTy,
+                                                          dstTy>::is_defined)
+        {
+            using OpT = SumSumSqReductionOp<dstTy>;
+            return dpctl::tensor::kernels::
+                multi_output_axis1_over_group_temps_contig_impl<srcTy, OpT>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename srcTy, typename dstTy>
+struct SumSumSqOverAxisAxis0ContigFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportForSumSumSqReduction<srcTy,
+                                                          dstTy>::is_defined)
+        {
+            using OpT = SumSumSqReductionOp<dstTy>;
+            return dpctl::tensor::kernels::
+                multi_output_axis0_over_group_temps_contig_impl<srcTy, OpT>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename srcTy, typename dstTy>
+struct MaxArgMaxOverAxisStridedFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportForComparisonReduction<srcTy,
+                                                            dstTy>::is_defined)
+        {
+            using OpT = MaxArgMaxReductionOp<dstTy, std::int64_t>;
+            return dpctl::tensor::kernels::
+                multi_output_over_group_temps_strided_impl<srcTy, OpT>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename srcTy, typename dstTy>
+struct MaxArgMaxOverAxisAxis1ContigFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportForComparisonReduction<srcTy,
+                                                            dstTy>::is_defined)
+        {
+            using OpT = MaxArgMaxReductionOp<dstTy, std::int64_t>;
+            return dpctl::tensor::kernels::
+                multi_output_axis1_over_group_temps_contig_impl<srcTy, OpT>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename srcTy, typename dstTy>
+struct MaxArgMaxOverAxisAxis0ContigFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportForComparisonReduction<srcTy,
+                                                            dstTy>::is_defined)
+        {
+            using OpT = MaxArgMaxReductionOp<dstTy, std::int64_t>;
+            return dpctl::tensor::kernels::
+                multi_output_axis0_over_group_temps_contig_impl<srcTy, OpT>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+void populate_multi_output_dispatch_tables(void)
+{
+    using namespace td_ns;
+
+    DispatchTableBuilder<multi_output_reduction_strided_impl_fn_ptr,
+                         MinMaxOverAxisStridedFactory, num_types>
+        dtb1;
+    dtb1.populate_dispatch_table(minmax_over_axis_strided_dispatch_table);
+
+    DispatchTableBuilder<multi_output_reduction_contig_impl_fn_ptr,
+                         MinMaxOverAxisAxis1ContigFactory, num_types>
+        dtb2;
+    dtb2.populate_dispatch_table(minmax_over_axis1_contig_dispatch_table);
+
+    DispatchTableBuilder<multi_output_reduction_contig_impl_fn_ptr,
+                         MinMaxOverAxisAxis0ContigFactory, num_types>
+        dtb3;
+    dtb3.populate_dispatch_table(minmax_over_axis0_contig_dispatch_table);
+
+    DispatchTableBuilder<multi_output_reduction_strided_impl_fn_ptr,
+                         SumSumSqOverAxisStridedFactory, num_types>
+        dtb4;
+    dtb4.populate_dispatch_table(sum_sumsq_over_axis_strided_dispatch_table);
+
+    DispatchTableBuilder<multi_output_reduction_contig_impl_fn_ptr,
+                         SumSumSqOverAxisAxis1ContigFactory, num_types>
+        dtb5;
+    dtb5.populate_dispatch_table(sum_sumsq_over_axis1_contig_dispatch_table);
+
+    DispatchTableBuilder<multi_output_reduction_contig_impl_fn_ptr,
+                         SumSumSqOverAxisAxis0ContigFactory, num_types>
+        dtb6;
+    dtb6.populate_dispatch_table(sum_sumsq_over_axis0_contig_dispatch_table);
+
+    DispatchTableBuilder<multi_output_reduction_strided_impl_fn_ptr,
+                         MaxArgMaxOverAxisStridedFactory, num_types>
+        dtb7;
+    dtb7.populate_dispatch_table(max_argmax_over_axis_strided_dispatch_table);
+
+    DispatchTableBuilder<multi_output_reduction_contig_impl_fn_ptr,
+                         MaxArgMaxOverAxisAxis1ContigFactory, num_types>
+        dtb8;
+    dtb8.populate_dispatch_table(max_argmax_over_axis1_contig_dispatch_table);
+
+    DispatchTableBuilder<multi_output_reduction_contig_impl_fn_ptr,
+                         MaxArgMaxOverAxisAxis0ContigFactory, num_types>
+        dtb9;
+    dtb9.populate_dispatch_table(max_argmax_over_axis0_contig_dispatch_table);
+}
+
+} // namespace impl
+
+void init_multi_output(py::module_ m)
+{
+    using arrayT = dpctl::tensor::usm_ndarray;
+    using event_vecT = std::vector<sycl::event>;
+
+    impl::populate_multi_output_dispatch_tables();
+
+    using dpctl::tensor::py_internal::py_multi_output_reduction_over_axis;
+
+    {
+        using impl::minmax_over_axis0_contig_dispatch_table;
+        using impl::minmax_over_axis1_contig_dispatch_table;
+        using impl::minmax_over_axis_strided_dispatch_table;
+
+        auto minmax_pyapi = [&](const arrayT &src, int trailing_dims_to_reduce,
+                                const arrayT &dst_min, const arrayT &dst_max,
+                                sycl::queue &exec_q,
+                                const event_vecT &depends = {}) {
+            const auto &array_types = td_ns::usm_ndarray_types();
+            const int dst_typeid =
+                array_types.typenum_to_lookup_id(dst_min.get_typenum());
+            return py_multi_output_reduction_over_axis(
+                src, trailing_dims_to_reduce, dst_min, dst_max, dst_typeid,
+                exec_q, depends, minmax_over_axis_strided_dispatch_table,
+                minmax_over_axis0_contig_dispatch_table,
+                minmax_over_axis1_contig_dispatch_table);
+        };
+        m.def("_minmax_over_axis", minmax_pyapi,
+              "Computes minimum and maximum over trailing dimensions in a "
+              "single pass",
+              py::arg("src"), py::arg("trailing_dims_to_reduce"),
+              py::arg("dst_min"), py::arg("dst_max"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+    }
+
+    {
+        using impl::sum_sumsq_over_axis0_contig_dispatch_table;
+        using impl::sum_sumsq_over_axis1_contig_dispatch_table;
+        using impl::sum_sumsq_over_axis_strided_dispatch_table;
+
+        auto sum_sumsq_pyapi = [&](const arrayT &src,
+                                   int trailing_dims_to_reduce,
+                                   const arrayT &dst_sum,
+                                   const arrayT &dst_sumsq,
+                                   sycl::queue &exec_q,
+                                   const event_vecT &depends = {}) {
+            const auto &array_types = td_ns::usm_ndarray_types();
+            const int dst_typeid =
+                array_types.typenum_to_lookup_id(dst_sum.get_typenum());
+            return py_multi_output_reduction_over_axis(
+                src, trailing_dims_to_reduce, dst_sum, dst_sumsq, dst_typeid,
+                exec_q, depends, sum_sumsq_over_axis_strided_dispatch_table,
+                sum_sumsq_over_axis0_contig_dispatch_table,
+                sum_sumsq_over_axis1_contig_dispatch_table);
+        };
+        m.def("_sum_and_sumsq_over_axis", sum_sumsq_pyapi,
+              "Computes sum of elements and sum of their squares over "
+              "trailing dimensions in a single pass",
+              py::arg("src"), py::arg("trailing_dims_to_reduce"),
+              py::arg("dst_sum"), py::arg("dst_sumsq"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+
+        auto sum_sumsq_dtype_supported = [&](const py::dtype &input_dtype,
+                                             const py::dtype &output_dtype) {
+            using dpctl::tensor::py_internal::py_tree_reduction_dtype_supported;
+            return py_tree_reduction_dtype_supported(
+                input_dtype, output_dtype,
+                sum_sumsq_over_axis_strided_dispatch_table);
+        };
+        m.def("_sum_and_sumsq_over_axis_dtype_supported",
+              sum_sumsq_dtype_supported, "", py::arg("arg_dtype"),
+              py::arg("out_dtype"));
+    }
+
+    {
+        using impl::max_argmax_over_axis0_contig_dispatch_table;
+        using impl::max_argmax_over_axis1_contig_dispatch_table;
+        using impl::max_argmax_over_axis_strided_dispatch_table;
+
+        auto max_argmax_pyapi = [&](const arrayT &src,
+                                    int trailing_dims_to_reduce,
+                                    const arrayT &dst_max,
+                                    const arrayT &dst_argmax,
+                                    sycl::queue &exec_q,
+                                    const event_vecT &depends = {}) {
+            static constexpr int index_typeid =
+                static_cast<int>(td_ns::typenum_t::INT64);
+            return py_multi_output_reduction_over_axis(
+                src, trailing_dims_to_reduce, dst_max, dst_argmax,
+                index_typeid, exec_q, depends,
+                max_argmax_over_axis_strided_dispatch_table,
+                max_argmax_over_axis0_contig_dispatch_table,
+                max_argmax_over_axis1_contig_dispatch_table);
+        };
+        m.def("_max_with_argmax_over_axis", max_argmax_pyapi,
+              "Computes maximum over trailing dimensions and flat index of "
+              "its first occurrence in a single pass",
+              py::arg("src"), py::arg("trailing_dims_to_reduce"),
+              py::arg("dst_max"), py::arg("dst_argmax"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+    }
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
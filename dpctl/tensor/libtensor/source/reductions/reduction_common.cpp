@@ -28,12 +28,16 @@
 #include "any.hpp"
 #include "argmax.hpp"
 #include "argmin.hpp"
+#include "histogram.hpp"
 #include "logsumexp.hpp"
 #include "max.hpp"
 #include "min.hpp"
+#include "multi_output.hpp"
 #include "prod.hpp"
 #include "reduce_hypot.hpp"
+#include "segment_reduce.hpp"
 #include "sum.hpp"
+#include "var_std.hpp"
 
 namespace py = pybind11;
 
@@ -51,12 +55,16 @@ void init_reduction_functions(py::module_ m)
     init_any(m);
     init_argmax(m);
     init_argmin(m);
+    init_histogram(m);
     init_logsumexp(m);
     init_max(m);
     init_min(m);
+    init_multi_output(m);
     init_prod(m);
     init_reduce_hypot(m);
+    init_segment_reduce(m);
     init_sum(m);
+    init_var_std(m);
 }
 
 } // namespace py_internal
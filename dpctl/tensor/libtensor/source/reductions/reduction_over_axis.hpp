@@ -1313,6 +1313,517 @@ py_boolean_reduction(const dpctl::tensor::usm_ndarray &src,
     return std::make_pair(keep_args_event, red_ev);
 }
 
+/* ================= Variance reductions ====================== */
+
+/*! @brief Template implementing Python API for single-pass computation of
+ * variance, or standard deviation, over trailing axes */
+template <typename strided_fnT, typename contig_fnT>
+std::pair<sycl::event, sycl::event> py_welford_reduction_over_axis(
+    const dpctl::tensor::usm_ndarray &src,
+    int trailing_dims_to_reduce, // comp over this many trailing indexes
+    const dpctl::tensor::usm_ndarray &dst,
+    double correction,
+    bool take_sqrt,
+    sycl::queue &exec_q,
+    const std::vector<sycl::event> &depends,
+    const strided_fnT &strided_dispatch_table,
+    const contig_fnT &axis0_dispatch_table,
+    const contig_fnT &axis1_dispatch_table)
+{
+    int src_nd = src.get_ndim();
+    int iteration_nd = src_nd - trailing_dims_to_reduce;
+    if (trailing_dims_to_reduce <= 0 || iteration_nd < 0) {
+        throw py::value_error("Trailing_dim_to_reduce must be positive, but no "
+                              "greater than rank of the array being reduced");
+    }
+
+    int dst_nd = dst.get_ndim();
+    if (dst_nd != iteration_nd) {
+        throw py::value_error("Destination array rank does not match input "
+                              "array rank and number of reduced dimensions");
+    }
+
+    const py::ssize_t *src_shape_ptr = src.get_shape_raw();
+    const py::ssize_t *dst_shape_ptr = dst.get_shape_raw();
+
+    bool same_shapes = true;
+    for (int i = 0; same_shapes && (i < dst_nd); ++i) {
+        same_shapes = same_shapes && (src_shape_ptr[i] == dst_shape_ptr[i]);
+    }
+
+    if (!same_shapes) {
+        throw py::value_error("Destination shape does not match unreduced "
+                              "dimensions of the input shape");
+    }
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {src, dst})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    dpctl::tensor::validation::CheckWritable::throw_if_not_writable(dst);
+
+    std::size_t dst_nelems = dst.get_size();
+
+    if (dst_nelems == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    std::size_t reduction_nelems(1);
+    for (int i = dst_nd; i < src_nd; ++i) {
+        reduction_nelems *= static_cast<std::size_t>(src_shape_ptr[i]);
+    }
+
+    // check that dst and src do not overlap
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(src, dst)) {
+        throw py::value_error("Arrays index overlapping segments of memory");
+    }
+
+    dpctl::tensor::validation::AmpleMemory::throw_if_not_ample(dst, dst_nelems);
+
+    int src_typenum = src.get_typenum();
+    int dst_typenum = dst.get_typenum();
+
+    namespace td_ns = dpctl::tensor::type_dispatch;
+    const auto &array_types = td_ns::usm_ndarray_types();
+    int src_typeid = array_types.typenum_to_lookup_id(src_typenum);
+    int dst_typeid = array_types.typenum_to_lookup_id(dst_typenum);
+
+    auto strided_fn = strided_dispatch_table[src_typeid][dst_typeid];
+    if (strided_fn == nullptr) {
+        throw std::runtime_error("Datatypes are not supported");
+    }
+
+    // handle special case when both reduction and iteration are 1D contiguous
+    bool is_src_c_contig = src.is_c_contiguous();
+    bool is_dst_c_contig = dst.is_c_contiguous();
+    bool is_src_f_contig = src.is_f_contiguous();
+
+    static constexpr py::ssize_t zero_offset = 0;
+
+    if ((is_src_c_contig && is_dst_c_contig) ||
+        (is_src_f_contig && dst_nelems == 1))
+    {
+        auto fn = axis1_dispatch_table[src_typeid][dst_typeid];
+        if (fn != nullptr) {
+            sycl::event red_ev =
+                fn(exec_q, dst_nelems, reduction_nelems, src.get_data(),
+                   dst.get_data(), correction, take_sqrt, zero_offset,
+                   zero_offset, zero_offset, depends);
+
+            sycl::event keep_args_event =
+                dpctl::utils::keep_args_alive(exec_q, {src, dst}, {red_ev});
+
+            return std::make_pair(keep_args_event, red_ev);
+        }
+    }
+    else if (is_src_f_contig &&
+             ((is_dst_c_contig && dst_nd == 1) || dst.is_f_contiguous()))
+    {
+        auto fn = axis0_dispatch_table[src_typeid][dst_typeid];
+        if (fn != nullptr) {
+            sycl::event red_ev =
+                fn(exec_q, dst_nelems, reduction_nelems, src.get_data(),
+                   dst.get_data(), correction, take_sqrt, zero_offset,
+                   zero_offset, zero_offset, depends);
+
+            sycl::event keep_args_event =
+                dpctl::utils::keep_args_alive(exec_q, {src, dst}, {red_ev});
+
+            return std::make_pair(keep_args_event, red_ev);
+        }
+    }
+
+    using dpctl::tensor::py_internal::simplify_iteration_space;
+    using dpctl::tensor::py_internal::simplify_iteration_space_1;
+
+    auto const &src_strides_vecs = src.get_strides_vector();
+    auto const &dst_strides_vecs = dst.get_strides_vector();
+
+    int reduction_nd = trailing_dims_to_reduce;
+    const py::ssize_t *reduction_shape_ptr = src_shape_ptr + dst_nd;
+    using shT = std::vector<py::ssize_t>;
+    shT reduction_src_strides(std::begin(src_strides_vecs) + dst_nd,
+                              std::end(src_strides_vecs));
+
+    shT simplified_reduction_shape;
+    shT simplified_reduction_src_strides;
+    py::ssize_t reduction_src_offset(0);
+
+    simplify_iteration_space_1(
+        reduction_nd, reduction_shape_ptr, reduction_src_strides,
+        // output
+        simplified_reduction_shape, simplified_reduction_src_strides,
+        reduction_src_offset);
+
+    const py::ssize_t *iteration_shape_ptr = src_shape_ptr;
+
+    shT iteration_src_strides(std::begin(src_strides_vecs),
+                              std::begin(src_strides_vecs) + iteration_nd);
+    shT const &iteration_dst_strides = dst_strides_vecs;
+
+    shT simplified_iteration_shape;
+    shT simplified_iteration_src_strides;
+    shT simplified_iteration_dst_strides;
+    py::ssize_t iteration_src_offset(0);
+    py::ssize_t iteration_dst_offset(0);
+
+    if (iteration_nd == 0) {
+        if (dst_nelems != 1) {
+            throw std::runtime_error("iteration_nd == 0, but dst_nelems != 1");
+        }
+        iteration_nd = 1;
+        simplified_iteration_shape.push_back(1);
+        simplified_iteration_src_strides.push_back(0);
+        simplified_iteration_dst_strides.push_back(0);
+    }
+    else {
+        simplify_iteration_space(iteration_nd, iteration_shape_ptr,
+                                 iteration_src_strides, iteration_dst_strides,
+                                 // output
+                                 simplified_iteration_shape,
+                                 simplified_iteration_src_strides,
+                                 simplified_iteration_dst_strides,
+                                 iteration_src_offset, iteration_dst_offset);
+    }
+
+    if ((reduction_nd == 1) && (iteration_nd == 1)) {
+        bool mat_reduce_over_axis1 = false;
+        bool mat_reduce_over_axis0 = false;
+        bool array_reduce_all_elems = false;
+        std::size_t iter_nelems = dst_nelems;
+
+        if (simplified_reduction_src_strides[0] == 1) {
+            array_reduce_all_elems = (simplified_iteration_shape[0] == 1);
+            mat_reduce_over_axis1 =
+                (simplified_iteration_dst_strides[0] == 1) &&
+                (static_cast<std::size_t>(
+                     simplified_iteration_src_strides[0]) == reduction_nelems);
+        }
+        else if (static_cast<std::size_t>(
+                     simplified_reduction_src_strides[0]) == iter_nelems)
+        {
+            mat_reduce_over_axis0 =
+                (simplified_iteration_dst_strides[0] == 1) &&
+                (simplified_iteration_src_strides[0] == 1);
+        }
+
+        if (mat_reduce_over_axis1 || array_reduce_all_elems ||
+            mat_reduce_over_axis0)
+        {
+            auto contig_fn = (mat_reduce_over_axis0)
+                                 ? axis0_dispatch_table[src_typeid][dst_typeid]
+                                 : axis1_dispatch_table[src_typeid][dst_typeid];
+            if (contig_fn != nullptr) {
+                sycl::event red_ev = contig_fn(
+                    exec_q, iter_nelems, reduction_nelems, src.get_data(),
+                    dst.get_data(), correction, take_sqrt,
+                    iteration_src_offset, iteration_dst_offset,
+                    reduction_src_offset, depends);
+
+                sycl::event keep_args_event = dpctl::utils::keep_args_alive(
+                    exec_q, {src, dst}, {red_ev});
+
+                return std::make_pair(keep_args_event, red_ev);
+            }
+        }
+    }
+
+    using dpctl::tensor::offset_utils::device_allocate_and_pack_cached;
+    auto shape_strides_lease = device_allocate_and_pack_cached<py::ssize_t>(
+        exec_q,
+        // iteration metadata
+        simplified_iteration_shape, simplified_iteration_src_strides,
+        simplified_iteration_dst_strides,
+        // reduction metadata
+        simplified_reduction_shape, simplified_reduction_src_strides);
+    const py::ssize_t *iter_shape_and_strides = shape_strides_lease.get();
+    const py::ssize_t *reduction_shape_stride =
+        iter_shape_and_strides + 3 * simplified_iteration_shape.size();
+
+    std::vector<sycl::event> all_deps;
+    all_deps.reserve(depends.size() + 1);
+    all_deps.insert(all_deps.end(), depends.begin(), depends.end());
+    all_deps.push_back(shape_strides_lease.get_copy_event());
+
+    sycl::event red_ev = strided_fn(
+        exec_q, dst_nelems, reduction_nelems, src.get_data(), dst.get_data(),
+        correction, take_sqrt, iteration_nd, iter_shape_and_strides,
+        iteration_src_offset, iteration_dst_offset, reduction_nd,
+        reduction_shape_stride, reduction_src_offset, all_deps);
+
+    // metadata block is recycled by the arena after red_ev
+    shape_strides_lease.release_after({red_ev});
+
+    sycl::event keep_args_event =
+        dpctl::utils::keep_args_alive(exec_q, {src, dst}, {red_ev});
+
+    return std::make_pair(keep_args_event, red_ev);
+}
+
+/* ================= Multi-output reductions ====================== */
+
+/*! @brief Template implementing Python API for reductions computing two
+ * results over trailing axes in a single pass.
+ *
+ * Both destination arrays must have the same shape and strides. Reduced
+ * dimensions are traversed in C-contiguous order, so that positions of
+ * reduced elements seen by the reduction operation are their flat indices.
+ */
+template <typename strided_fnT, typename contig_fnT>
+std::pair<sycl::event, sycl::event> py_multi_output_reduction_over_axis(
+    const dpctl::tensor::usm_ndarray &src,
+    int trailing_dims_to_reduce, // comp over this many trailing indexes
+    const dpctl::tensor::usm_ndarray &dst1,
+    const dpctl::tensor::usm_ndarray &dst2,
+    int expected_dst2_typeid,
+    sycl::queue &exec_q,
+    const std::vector<sycl::event> &depends,
+    const strided_fnT &strided_dispatch_table,
+    const contig_fnT &axis0_dispatch_table,
+    const contig_fnT &axis1_dispatch_table)
+{
+    int src_nd = src.get_ndim();
+    int iteration_nd = src_nd - trailing_dims_to_reduce;
+    if (trailing_dims_to_reduce <= 0 || iteration_nd < 0) {
+        throw py::value_error("Trailing_dim_to_reduce must be positive, but no "
+                              "greater than rank of the array being reduced");
+    }
+
+    int dst_nd = dst1.get_ndim();
+    if (dst_nd != iteration_nd) {
+        throw py::value_error("Destination array rank does not match input "
+                              "array rank and number of reduced dimensions");
+    }
+
+    const py::ssize_t *src_shape_ptr = src.get_shape_raw();
+    const py::ssize_t *dst_shape_ptr = dst1.get_shape_raw();
+
+    bool same_shapes = true;
+    for (int i = 0; same_shapes && (i < dst_nd); ++i) {
+        same_shapes = same_shapes && (src_shape_ptr[i] == dst_shape_ptr[i]);
+    }
+
+    if (!same_shapes) {
+        throw py::value_error("Destination shape does not match unreduced "
+                              "dimensions of the input shape");
+    }
+
+    auto const &dst1_strides_vecs = dst1.get_strides_vector();
+    if (dst2.get_ndim() != dst_nd ||
+        !std::equal(dst_shape_ptr, dst_shape_ptr + dst_nd,
+                    dst2.get_shape_raw()) ||
+        dst2.get_strides_vector() != dst1_strides_vecs)
+    {
+        throw py::value_error(
+            "Destination arrays must have the same shape and strides");
+    }
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {src, dst1, dst2})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    dpctl::tensor::validation::CheckWritable::throw_if_not_writable(dst1);
+    dpctl::tensor::validation::CheckWritable::throw_if_not_writable(dst2);
+
+    std::size_t dst_nelems = dst1.get_size();
+
+    if (dst_nelems == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    std::size_t reduction_nelems(1);
+    for (int i = dst_nd; i < src_nd; ++i) {
+        reduction_nelems *= static_cast<std::size_t>(src_shape_ptr[i]);
+    }
+
+    // check that destinations do not overlap with each other and with src
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(src, dst1) || overlap(src, dst2) || overlap(dst1, dst2)) {
+        throw py::value_error("Arrays index overlapping segments of memory");
+    }
+
+    dpctl::tensor::validation::AmpleMemory::throw_if_not_ample(dst1,
+                                                               dst_nelems);
+    dpctl::tensor::validation::AmpleMemory::throw_if_not_ample(dst2,
+                                                               dst_nelems);
+
+    int src_typenum = src.get_typenum();
+    int dst1_typenum = dst1.get_typenum();
+    int dst2_typenum = dst2.get_typenum();
+
+    namespace td_ns = dpctl::tensor::type_dispatch;
+    const auto &array_types = td_ns::usm_ndarray_types();
+    int src_typeid = array_types.typenum_to_lookup_id(src_typenum);
+    int dst1_typeid = array_types.typenum_to_lookup_id(dst1_typenum);
+    int dst2_typeid = array_types.typenum_to_lookup_id(dst2_typenum);
+
+    auto strided_fn = strided_dispatch_table[src_typeid][dst1_typeid];
+    if (strided_fn == nullptr || dst2_typeid != expected_dst2_typeid) {
+        throw std::runtime_error("Datatypes are not supported");
+    }
+
+    // handle special case when both reduction and iteration are 1D contiguous
+    bool is_src_c_contig = src.is_c_contiguous();
+    bool is_dst_c_contig = dst1.is_c_contiguous();
+    bool is_src_f_contig = src.is_f_contiguous();
+
+    static constexpr py::ssize_t zero_offset = 0;
+
+    if (is_src_c_contig && is_dst_c_contig) {
+        auto fn = axis1_dispatch_table[src_typeid][dst1_typeid];
+        if (fn != nullptr) {
+            sycl::event red_ev =
+                fn(exec_q, dst_nelems, reduction_nelems, src.get_data(),
+                   dst1.get_data(), dst2.get_data(), zero_offset, zero_offset,
+                   zero_offset, depends);
+
+            sycl::event keep_args_event = dpctl::utils::keep_args_alive(
+                exec_q, {src, dst1, dst2}, {red_ev});
+
+            return std::make_pair(keep_args_event, red_ev);
+        }
+    }
+    else if (is_src_f_contig && is_dst_c_contig && dst_nd == 1 &&
+             trailing_dims_to_reduce == 1)
+    {
+        auto fn = axis0_dispatch_table[src_typeid][dst1_typeid];
+        if (fn != nullptr) {
+            sycl::event red_ev =
+                fn(exec_q, dst_nelems, reduction_nelems, src.get_data(),
+                   dst1.get_data(), dst2.get_data(), zero_offset, zero_offset,
+                   zero_offset, depends);
+
+            sycl::event keep_args_event = dpctl::utils::keep_args_alive(
+                exec_q, {src, dst1, dst2}, {red_ev});
+
+            return std::make_pair(keep_args_event, red_ev);
+        }
+    }
+
+    using dpctl::tensor::py_internal::simplify_iteration_space;
+
+    auto const &src_strides_vecs = src.get_strides_vector();
+
+    int reduction_nd = trailing_dims_to_reduce;
+    const py::ssize_t *reduction_shape_ptr = src_shape_ptr + dst_nd;
+    using shT = std::vector<py::ssize_t>;
+    shT reduction_src_strides(std::begin(src_strides_vecs) + dst_nd,
+                              std::end(src_strides_vecs));
+
+    // unlike simplification, compacting preserves order of reduced elements
+    shT compact_reduction_shape;
+    shT compact_reduction_src_strides;
+    py::ssize_t reduction_src_offset(0);
+
+    compact_iteration_space(
+        reduction_nd, reduction_shape_ptr, reduction_src_strides,
+        // output
+        compact_reduction_shape, compact_reduction_src_strides);
+
+    const py::ssize_t *iteration_shape_ptr = src_shape_ptr;
+
+    shT iteration_src_strides(std::begin(src_strides_vecs),
+                              std::begin(src_strides_vecs) + iteration_nd);
+    shT const &iteration_dst_strides = dst1_strides_vecs;
+
+    shT simplified_iteration_shape;
+    shT simplified_iteration_src_strides;
+    shT simplified_iteration_dst_strides;
+    py::ssize_t iteration_src_offset(0);
+    py::ssize_t iteration_dst_offset(0);
+
+    if (iteration_nd == 0) {
+        if (dst_nelems != 1) {
+            throw std::runtime_error("iteration_nd == 0, but dst_nelems != 1");
+        }
+        iteration_nd = 1;
+        simplified_iteration_shape.push_back(1);
+        simplified_iteration_src_strides.push_back(0);
+        simplified_iteration_dst_strides.push_back(0);
+    }
+    else {
+        simplify_iteration_space(iteration_nd, iteration_shape_ptr,
+                                 iteration_src_strides, iteration_dst_strides,
+                                 // output
+                                 simplified_iteration_shape,
+                                 simplified_iteration_src_strides,
+                                 simplified_iteration_dst_strides,
+                                 iteration_src_offset, iteration_dst_offset);
+    }
+
+    if ((reduction_nd == 1) && (iteration_nd == 1)) {
+        bool mat_reduce_over_axis1 = false;
+        bool mat_reduce_over_axis0 = false;
+        std::size_t iter_nelems = dst_nelems;
+
+        if (compact_reduction_src_strides[0] == 1) {
+            mat_reduce_over_axis1 =
+                (simplified_iteration_dst_strides[0] == 1) &&
+                (static_cast<std::size_t>(
+                     simplified_iteration_src_strides[0]) == reduction_nelems);
+        }
+        else if (static_cast<std::size_t>(compact_reduction_src_strides[0]) ==
+                 iter_nelems)
+        {
+            mat_reduce_over_axis0 =
+                (simplified_iteration_dst_strides[0] == 1) &&
+                (simplified_iteration_src_strides[0] == 1);
+        }
+
+        if (mat_reduce_over_axis1 || mat_reduce_over_axis0) {
+            auto contig_fn =
+                (mat_reduce_over_axis0)
+                    ? axis0_dispatch_table[src_typeid][dst1_typeid]
+                    : axis1_dispatch_table[src_typeid][dst1_typeid];
+            if (contig_fn != nullptr) {
+                sycl::event red_ev = contig_fn(
+                    exec_q, iter_nelems, reduction_nelems, src.get_data(),
+                    dst1.get_data(), dst2.get_data(), iteration_src_offset,
+                    iteration_dst_offset, reduction_src_offset, depends);
+
+                sycl::event keep_args_event = dpctl::utils::keep_args_alive(
+                    exec_q, {src, dst1, dst2}, {red_ev});
+
+                return std::make_pair(keep_args_event, red_ev);
+            }
+        }
+    }
+
+    using dpctl::tensor::offset_utils::device_allocate_and_pack_cached;
+    auto shape_strides_lease = device_allocate_and_pack_cached<py::ssize_t>(
+        exec_q,
+        // iteration metadata
+        simplified_iteration_shape, simplified_iteration_src_strides,
+        simplified_iteration_dst_strides,
+        // reduction metadata
+        compact_reduction_shape, compact_reduction_src_strides);
+    const py::ssize_t *iter_shape_and_strides = shape_strides_lease.get();
+    const py::ssize_t *reduction_shape_stride =
+        iter_shape_and_strides + 3 * simplified_iteration_shape.size();
+
+    std::vector<sycl::event> all_deps;
+    all_deps.reserve(depends.size() + 1);
+    all_deps.insert(all_deps.end(), depends.begin(), depends.end());
+    all_deps.push_back(shape_strides_lease.get_copy_event());
+
+    sycl::event red_ev = strided_fn(
+        exec_q, dst_nelems, reduction_nelems, src.get_data(), dst1.get_data(),
+        dst2.get_data(), iteration_nd, iter_shape_and_strides,
+        iteration_src_offset, iteration_dst_offset, reduction_nd,
+        reduction_shape_stride, reduction_src_offset, all_deps);
+
+    // metadata block is recycled by the arena after red_ev
+    shape_strides_lease.release_after({red_ev});
+
+    sycl::event keep_args_event =
+        dpctl::utils::keep_args_alive(exec_q, {src, dst1, dst2}, {red_ev});
+
+    return std::make_pair(keep_args_event, red_ev);
+}
+
 extern void init_reduction_functions(py::module_ m);
 
 } // namespace py_internal
@@ -0,0 +1,324 @@
+//===-- ------------ Implementation of _tensor_impl module  ----*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===--------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_impl extensions
+//===--------------------------------------------------------------------===//
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "dpctl4pybind11.hpp"
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <sycl/sycl.hpp>
+
+#include "kernels/segment_reduce.hpp"
+#include "utils/memory_overlap.hpp"
+#include "utils/output_validation.hpp"
+#include "utils/sycl_utils.hpp"
+#include "utils/type_dispatch.hpp"
+
+#include "segment_reduce.hpp"
+
+#define SEGMENT_REDUCE_OPS 7
+#define SEGMENT_REDUCE_SUM 0
+#define SEGMENT_REDUCE_PROD 1
+#define SEGMENT_REDUCE_MIN 2
+#define SEGMENT_REDUCE_MAX 3
+#define SEGMENT_REDUCE_ARGMIN 4
+#define SEGMENT_REDUCE_ARGMAX 5
+#define SEGMENT_REDUCE_LOGSUMEXP 6
+
+namespace py = pybind11;
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+namespace td_ns = dpctl::tensor::type_dispatch;
+namespace su_ns = dpctl::tensor::sycl_utils;
+
+namespace impl
+{
+
+using dpctl::tensor::kernels::segment_reduce::segment_reduction_fn_ptr_t;
+
+static segment_reduction_fn_ptr_t
+    segment_reduction_dispatch_table[SEGMENT_REDUCE_OPS][td_ns::num_types];
+
+template <typename T>
+using SegmentMaximumT = std::conditional_t<std::is_integral_v<T> &&
+                                               !std::is_same_v<T, bool>,
+                                           sycl::maximum<T>,
+                                           su_ns::Maximum<T>>;
+
+template <typename T>
+using SegmentMinimumT = std::conditional_t<std::is_integral_v<T> &&
+                                               !std::is_same_v<T, bool>,
+                                           sycl::minimum<T>,
+                                           su_ns::Minimum<T>>;
+
+template <typename fnT, typename T> struct SegmentSumFactory
+{
+    fnT get()
+    {
+        // booleans are summed in the default integral data type
+        if constexpr (!std::is_same_v<T, bool>) {
+            using dpctl::tensor::kernels::segment_reduce::
+                segment_reduction_impl;
+            return segment_reduction_impl<T, sycl::plus<T>>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename T> struct SegmentProdFactory
+{
+    fnT get()
+    {
+        if constexpr (!std::is_same_v<T, bool>) {
+            using dpctl::tensor::kernels::segment_reduce::
+                segment_reduction_impl;
+            return segment_reduction_impl<T, sycl::multiplies<T>>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename T> struct SegmentMinFactory
+{
+    fnT get()
+    {
+        using dpctl::tensor::kernels::segment_reduce::segment_reduction_impl;
+        return segment_reduction_impl<T, SegmentMinimumT<T>>;
+    }
+};
+
+template <typename fnT, typename T> struct SegmentMaxFactory
+{
+    fnT get()
+    {
+        using dpctl::tensor::kernels::segment_reduce::segment_reduction_impl;
+        return segment_reduction_impl<T, SegmentMaximumT<T>>;
+    }
+};
+
+template <typename fnT, typename T> struct SegmentArgMinFactory
+{
+    fnT get()
+    {
+        using dpctl::tensor::kernels::segment_reduce::
+            segment_search_reduction_impl;
+        return segment_search_reduction_impl<T, std::int64_t,
+                                             SegmentMinimumT<T>>;
+    }
+};
+
+template <typename fnT, typename T> struct SegmentArgMaxFactory
+{
+    fnT get()
+    {
+        using dpctl::tensor::kernels::segment_reduce::
+            segment_search_reduction_impl;
+        return segment_search_reduction_impl<T, std::int64_t,
+                                             SegmentMaximumT<T>>;
+    }
+};
+
+template <typename fnT, typename T> struct SegmentLogSumExpFactory
+{
+    fnT get()
+    {
+        if constexpr (std::is_same_v<T, sycl::half> ||
+                      std::is_same_v<T, float> || std::is_same_v<T, double>)
+        {
+            using dpctl::tensor::kernels::segment_reduce::
+                segment_reduction_impl;
+            return segment_reduction_impl<T, su_ns::LogSumExp<T>>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+void populate_segment_reduction_dispatch_tables(void)
+{
+    td_ns::DispatchVectorBuilder<segment_reduction_fn_ptr_t,
+                                 SegmentSumFactory, td_ns::num_types>
+        dvb1;
+    dvb1.populate_dispatch_vector(
+        segment_reduction_dispatch_table[SEGMENT_REDUCE_SUM]);
+
+    td_ns::DispatchVectorBuilder<segment_reduction_fn_ptr_t,
+                                 SegmentProdFactory, td_ns::num_types>
+        dvb2;
+    dvb2.populate_dispatch_vector(
+        segment_reduction_dispatch_table[SEGMENT_REDUCE_PROD]);
+
+    td_ns::DispatchVectorBuilder<segment_reduction_fn_ptr_t,
+                                 SegmentMinFactory, td_ns::num_types>
+        dvb3;
+    dvb3.populate_dispatch_vector(
+        segment_reduction_dispatch_table[SEGMENT_REDUCE_MIN]);
+
+    td_ns::DispatchVectorBuilder<segment_reduction_fn_ptr_t,
+                                 SegmentMaxFactory, td_ns::num_types>
+        dvb4;
+    dvb4.populate_dispatch_vector(
+        segment_reduction_dispatch_table[SEGMENT_REDUCE_MAX]);
+
+    td_ns::DispatchVectorBuilder<segment_reduction_fn_ptr_t,
+                                 SegmentArgMinFactory, td_ns::num_types>
+        dvb5;
+    dvb5.populate_dispatch_vector(
+        segment_reduction_dispatch_table[SEGMENT_REDUCE_ARGMIN]);
+
+    td_ns::DispatchVectorBuilder<segment_reduction_fn_ptr_t,
+                                 SegmentArgMaxFactory, td_ns::num_types>
+        dvb6;
+    dvb6.populate_dispatch_vector(
+        segment_reduction_dispatch_table[SEGMENT_REDUCE_ARGMAX]);
+
+    td_ns::DispatchVectorBuilder<segment_reduction_fn_ptr_t,
+                                 SegmentLogSumExpFactory, td_ns::num_types>
+        dvb7;
+    dvb7.populate_dispatch_vector(
+        segment_reduction_dispatch_table[SEGMENT_REDUCE_LOGSUMEXP]);
+}
+
+} // namespace impl
+
+std::pair<sycl::event, sycl::event>
+py_segment_reduce(const dpctl::tensor::usm_ndarray &src,
+                  const dpctl::tensor::usm_ndarray &offsets,
+                  const dpctl::tensor::usm_ndarray &dst,
+                  std::uint8_t reduction_op,
+                  sycl::queue &exec_q,
+                  const std::vector<sycl::event> &depends)
+{
+    if (reduction_op >= SEGMENT_REDUCE_OPS) {
+        throw py::value_error("Segmented reduction id must be less than " +
+                              std::to_string(SEGMENT_REDUCE_OPS));
+    }
+    if (src.get_ndim() != 1) {
+        throw py::value_error("Input array must be a vector");
+    }
+    if (offsets.get_ndim() != 1 || !offsets.is_c_contiguous() ||
+        offsets.get_size() == 0)
+    {
+        throw py::value_error("Offsets must be a non-empty contiguous vector");
+    }
+    const std::size_t nseg = offsets.get_size() - 1;
+    if (dst.get_ndim() != 1 || !dst.is_c_contiguous() ||
+        dst.get_size() != nseg)
+    {
+        throw py::value_error("Output array must be a contiguous vector with "
+                              "one element per segment");
+    }
+
+    if (!dpctl::utils::queues_are_compatible(exec_q, {src, offsets, dst})) {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    dpctl::tensor::validation::CheckWritable::throw_if_not_writable(dst);
+
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    if (overlap(dst, src) || overlap(dst, offsets)) {
+        throw py::value_error("Output array overlaps with inputs");
+    }
+
+    const auto &array_types = td_ns::usm_ndarray_types();
+    const int src_typeid = array_types.typenum_to_lookup_id(src.get_typenum());
+    const int offsets_typeid =
+        array_types.typenum_to_lookup_id(offsets.get_typenum());
+    const int dst_typeid = array_types.typenum_to_lookup_id(dst.get_typenum());
+
+    static constexpr int int64_typeid =
+        static_cast<int>(td_ns::typenum_t::INT64);
+    if (offsets_typeid != int64_typeid) {
+        throw py::value_error("Offsets must have int64 data type");
+    }
+
+    const bool is_search = (reduction_op == SEGMENT_REDUCE_ARGMIN ||
+                            reduction_op == SEGMENT_REDUCE_ARGMAX);
+    if (is_search && dst_typeid != int64_typeid) {
+        throw py::value_error("Output array of indices must have int64 data "
+                              "type");
+    }
+    if (!is_search && dst_typeid != src_typeid) {
+        throw py::value_error(
+            "Output array must have the same data type as the input array");
+    }
+
+    auto fn = impl::segment_reduction_dispatch_table[reduction_op][src_typeid];
+    if (fn == nullptr) {
+        throw py::value_error(
+            "Segmented reduction is not supported for the data type");
+    }
+
+    if (nseg == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    const std::size_t n = src.get_size();
+    const py::ssize_t src_stride = (n > 1) ? src.get_strides_vector()[0] : 1;
+
+    sycl::event comp_ev =
+        fn(exec_q, n, src.get_data(), src_stride, nseg, offsets.get_data(),
+           dst.get_data(), depends);
+
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, {src, offsets, dst}, {comp_ev});
+
+    return std::make_pair(ht_ev, comp_ev);
+}
+
+void init_segment_reduce(py::module_ m)
+{
+    impl::populate_segment_reduction_dispatch_tables();
+
+    m.def("_segment_reduce", &py_segment_reduce,
+          "Reduces segments of vector `src` delimited by int64 vector "
+          "`offsets`, segment `i` spanning `src[offsets[i]:offsets[i+1]]`, "
+          "into contiguous vector `dst`. Reduction `reduction_op` is one of "
+          "sum (0), prod (1), min (2), max (3), argmin (4), argmax (5) and "
+          "logsumexp (6).",
+          py::arg("src"), py::arg("offsets"), py::arg("dst"),
+          py::arg("reduction_op"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
@@ -0,0 +1,253 @@
+//===-- ------------ Implementation of _tensor_impl module  ----*-C++-*-/===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===--------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_impl extensions
+//===--------------------------------------------------------------------===//
+
+
+#include "dpctl4pybind11.hpp"
+#include <cstdint>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <sycl/sycl.hpp>
+#include <type_traits>
+#include <vector>
+
+#include "kernels/reductions.hpp"
+#include "reduction_over_axis.hpp"
+#include "utils/type_dispatch_building.hpp"
+
+namespace py = pybind11;
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+namespace td_ns = dpctl::tensor::type_dispatch;
+
+namespace impl
+{
+
+using dpctl::tensor::kernels::welford_reduction_strided_impl_fn_ptr;
+static welford_reduction_strided_impl_fn_ptr
+    var_over_axis_strided_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+using dpctl::tensor::kernels::welford_reduction_contig_impl_fn_ptr;
+static welford_reduction_contig_impl_fn_ptr
+    var_over_axis1_contig_dispatch_table[td_ns::num_types][td_ns::num_types];
+static welford_reduction_contig_impl_fn_ptr
+    var_over_axis0_contig_dispatch_table[td_ns::num_types][td_ns::num_types];
+
+template <typename argTy, typename outTy>
+struct TypePairSupportDataForVarReduction
+{
+
+    static constexpr bool is_defined = std::disjunction<
+        // input bool
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, bool, outTy, double>,
+
+        // input int8_t
+        td_ns::TypePairDefinedEntry<argTy, std::int8_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::int8_t, outTy, double>,
+
+        // input uint8_t
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint8_t, outTy, double>,
+
+        // input int16_t
+        td_ns::TypePairDefinedEntry<argTy, std::int16_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::int16_t, outTy, double>,
+
+        // input uint16_t
+        td_ns::TypePairDefinedEntry<argTy, std::uint16_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint16_t, outTy, double>,
+
+        // input int32_t
+        td_ns::TypePairDefinedEntry<argTy, std::int32_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::int32_t, outTy, double>,
+
+        // input uint32_t
+        td_ns::TypePairDefinedEntry<argTy, std::uint32_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint32_t, outTy, double>,
+
+        // input int64_t
+        td_ns::TypePairDefinedEntry<argTy, std::int64_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::int64_t, outTy, double>,
+
+        // input uint64_t
+        td_ns::TypePairDefinedEntry<argTy, std::uint64_t, outTy, float>,
+        td_ns::TypePairDefinedEntry<argTy, std::uint64_t, outTy, double>,
+
+        // input half
+        td_ns::TypePairDefinedEntry<argTy, sycl::half, outTy, sycl::half>,
+
+        // input float
+        td_ns::TypePairDefinedEntry<argTy, float, outTy, float>,
+
+        // input double
+        td_ns::TypePairDefinedEntry<argTy, double, outTy, double>,
+
+        // fall-through
+        td_ns::NotDefinedEntry>::is_defined;
+};
+
+template <typename fnT, typename srcTy, typename dstTy>
+struct VarOverAxisStridedFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportDataForVarReduction<srcTy,
+                                                         dstTy>::is_defined)
+        {
+            return dpctl::tensor::kernels::
+                welford_over_group_temps_strided_impl<srcTy, dstTy>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename srcTy, typename dstTy>
+struct VarOverAxis1ContigFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportDataForVarReduction<srcTy,
+                                                         dstTy>::is_defined)
+        {
+            return dpctl::tensor::kernels::
+                welford_axis1_over_group_temps_contig_impl<srcTy, dstTy>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+template <typename fnT, typename srcTy, typename dstTy>
+struct VarOverAxis0ContigFactory
+{
+    fnT get() const
+    {
+        if constexpr (TypePairSupportDataForVarReduction<srcTy,
+                                                         dstTy>::is_defined)
+        {
+            return dpctl::tensor::kernels::
+                welford_axis0_over_group_temps_contig_impl<srcTy, dstTy>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+void populate_var_over_axis_dispatch_tables(void)
+{
+    using dpctl::tensor::kernels::welford_reduction_contig_impl_fn_ptr;
+    using dpctl::tensor::kernels::welford_reduction_strided_impl_fn_ptr;
+    using namespace td_ns;
+
+    DispatchTableBuilder<welford_reduction_strided_impl_fn_ptr,
+                         VarOverAxisStridedFactory, num_types>
+        dtb1;
+    dtb1.populate_dispatch_table(var_over_axis_strided_dispatch_table);
+
+    DispatchTableBuilder<welford_reduction_contig_impl_fn_ptr,
+                         VarOverAxis1ContigFactory, num_types>
+        dtb2;
+    dtb2.populate_dispatch_table(var_over_axis1_contig_dispatch_table);
+
+    DispatchTableBuilder<welford_reduction_contig_impl_fn_ptr,
+                         VarOverAxis0ContigFactory, num_types>
+        dtb3;
+    dtb3.populate_dispatch_table(var_over_axis0_contig_dispatch_table);
+}
+
+} // namespace impl
+
+void init_var_std(py::module_ m)
+{
+    using arrayT = dpctl::tensor::usm_ndarray;
+    using event_vecT = std::vector<sycl::event>;
+    {
+        using impl::populate_var_over_axis_dispatch_tables;
+        populate_var_over_axis_dispatch_tables();
+        using impl::var_over_axis0_contig_dispatch_table;
+        using impl::var_over_axis1_contig_dispatch_table;
+        using impl::var_over_axis_strided_dispatch_table;
+
+        auto var_pyapi = [&](const arrayT &src, int trailing_dims_to_reduce,
+                             const arrayT &dst, double correction,
+                             sycl::queue &exec_q,
+                             const event_vecT &depends = {}) {
+            using dpctl::tensor::py_internal::py_welford_reduction_over_axis;
+            return py_welford_reduction_over_axis(
+                src, trailing_dims_to_reduce, dst, correction, false, exec_q,
+                depends, var_over_axis_strided_dispatch_table,
+                var_over_axis0_contig_dispatch_table,
+                var_over_axis1_contig_dispatch_table);
+        };
+        m.def("_var_over_axis", var_pyapi,
+              "Computes variance over trailing dimensions in a single pass "
+              "using Welford's algorithm",
+              py::arg("src"), py::arg("trailing_dims_to_reduce"),
+              py::arg("dst"), py::arg("correction"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+
+        auto std_pyapi = [&](const arrayT &src, int trailing_dims_to_reduce,
+                             const arrayT &dst, double correction,
+                             sycl::queue &exec_q,
+                             const event_vecT &depends = {}) {
+            using dpctl::tensor::py_internal::py_welford_reduction_over_axis;
+            return py_welford_reduction_over_axis(
+                src, trailing_dims_to_reduce, dst, correction, true, exec_q,
+                depends, var_over_axis_strided_dispatch_table,
+                var_over_axis0_contig_dispatch_table,
+                var_over_axis1_contig_dispatch_table);
+        };
+        m.def("_std_over_axis", std_pyapi,
+              "Computes standard deviation over trailing dimensions in a "
+              "single pass using Welford's algorithm",
+              py::arg("src"), py::arg("trailing_dims_to_reduce"),
+              py::arg("dst"), py::arg("correction"), py::arg("sycl_queue"),
+              py::arg("depends") = py::list());
+
+        auto var_dtype_supported = [&](const py::dtype &input_dtype,
+                                       const py::dtype &output_dtype) {
+            using dpctl::tensor::py_internal::py_tree_reduction_dtype_supported;
+            return py_tree_reduction_dtype_supported(
+                input_dtype, output_dtype,
+                var_over_axis_strided_dispatch_table);
+        };
+        m.def("_var_over_axis_dtype_supported", var_dtype_supported, "",
+              py::arg("arg_dtype"), py::arg("out_dtype"));
+    }
+}
+
+} // namespace py_internal
+} // namespace tensor
+} // namespace dpctl
@@ -88,6 +88,29 @@ struct use_radix_sort<
 {
 };
 
+template <typename T, typename = void>
+struct use_radix_select : public std::false_type
+{
+};
+
+template <typename T>
+struct use_radix_select<
+    T,
+    std::enable_if_t<std::disjunction<std::is_same<T, std::uint8_t>,
+                                      std::is_same<T, std::int8_t>,
+                                      std::is_same<T, std::uint16_t>,
+                                      std::is_same<T, std::int16_t>,
+                                      std::is_same<T, std::uint32_t>,
+                                      std::is_same<T, std::int32_t>,
+                                      std::is_same<T, std::uint64_t>,
+                                      std::is_same<T, std::int64_t>,
+                                      std::is_same<T, sycl::half>,
+                                      std::is_same<T, float>,
+                                      std::is_same<T, double>>::value>>
+    : public std::true_type
+{
+};
+
 template <typename argTy, typename IndexTy>
 sycl::event topk_caller(sycl::queue &exec_q,
                         std::size_t iter_nelems, // number of sub-arrays
@@ -99,6 +122,17 @@ sycl::event topk_caller(sycl::queue &exec_q,
                         char *inds_cp,
                         const std::vector<sycl::event> &depends)
 {
+    if constexpr (use_radix_select<argTy>::value) {
+        using dpctl::tensor::kernels::use_topk_radix_select;
+        if (use_topk_radix_select(axis_nelems, k)) {
+            using dpctl::tensor::kernels::topk_radix_select_impl;
+            auto ascending = !largest;
+            return topk_radix_select_impl<argTy, IndexTy>(
+                exec_q, iter_nelems, axis_nelems, k, ascending, arg_cp, vals_cp,
+                inds_cp, depends);
+        }
+    }
+
     if constexpr (use_radix_sort<argTy>::value) {
         using dpctl::tensor::kernels::topk_radix_impl;
         auto ascending = !largest;
@@ -215,7 +249,7 @@ py_topk(const dpctl::tensor::usm_ndarray &src,
     dpctl::tensor::validation::CheckWritable::throw_if_not_writable(vals);
     dpctl::tensor::validation::CheckWritable::throw_if_not_writable(inds);
 
-    if ((iter_nelems == 0) || (axis_nelems == 0)) {
+    if ((iter_nelems == 0) || (axis_nelems == 0) || (k == 0)) {
         // Nothing to do
         return std::make_pair(sycl::event(), sycl::event());
     }
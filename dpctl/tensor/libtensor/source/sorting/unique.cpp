@@ -0,0 +1,244 @@
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===--------------------------------------------------------------------===//
+///
+/// \file
+/// This file defines functions of dpctl.tensor._tensor_sorting_impl
+/// extension.
+//===--------------------------------------------------------------------===//
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sycl/sycl.hpp>
+
+#include "dpctl4pybind11.hpp"
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "utils/memory_overlap.hpp"
+#include "utils/output_validation.hpp"
+#include "utils/type_dispatch.hpp"
+
+#include "kernels/sorting/unique.hpp"
+
+#include "radix_sort_support.hpp"
+#include "unique.hpp"
+
+namespace dpctl
+{
+namespace tensor
+{
+namespace py_internal
+{
+
+namespace td_ns = dpctl::tensor::type_dispatch;
+
+using dpctl::tensor::kernels::unique_contig_impl_fn_ptr_t;
+static unique_contig_impl_fn_ptr_t
+    unique_contig_dispatch_vector[td_ns::num_types];
+
+template <typename fnT, typename argTy> struct UniqueContigFactory
+{
+    fnT get()
+    {
+        if constexpr (RadixSortSupportVector<argTy>::is_defined) {
+            using dpctl::tensor::kernels::unique_contig_impl;
+            return unique_contig_impl<argTy>;
+        }
+        else {
+            return nullptr;
+        }
+    }
+};
+
+void init_unique_dispatch_vectors(void)
+{
+    td_ns::DispatchVectorBuilder<unique_contig_impl_fn_ptr_t,
+                                 UniqueContigFactory, td_ns::num_types>
+        dvb;
+    dvb.populate_dispatch_vector(unique_contig_dispatch_vector);
+}
+
+namespace
+{
+
+void validate_int64_vector(const dpctl::tensor::usm_ndarray &arr,
+                           std::size_t min_size,
+                           const char *name)
+{
+    const auto &array_types = td_ns::usm_ndarray_types();
+    const int type_id = array_types.typenum_to_lookup_id(arr.get_typenum());
+    if (type_id != static_cast<int>(td_ns::typenum_t::INT64)) {
+        throw py::value_error(std::string("Array `") + name +
+                              "` must have int64 data type");
+    }
+    if (arr.get_ndim() != 1 || !arr.is_c_contiguous()) {
+        throw py::value_error(std::string("Array `") + name +
+                              "` must be a contiguous vector");
+    }
+    if (arr.get_size() < min_size) {
+        throw py::value_error(std::string("Array `") + name +
+                              "` is too small");
+    }
+    dpctl::tensor::validation::CheckWritable::throw_if_not_writable(arr);
+}
+
+} // end of anonymous namespace
+
+std::pair<sycl::event, sycl::event>
+py_unique(const dpctl::tensor::usm_ndarray &src,
+          const dpctl::tensor::usm_ndarray &values,
+          const std::optional<dpctl::tensor::usm_ndarray> &counts,
+          const std::optional<dpctl::tensor::usm_ndarray> &inverse,
+          const dpctl::tensor::usm_ndarray &n_uniques,
+          sycl::queue &exec_q,
+          const std::vector<sycl::event> &depends)
+{
+    if (src.get_ndim() != 1 || !src.is_c_contiguous()) {
+        throw py::value_error("Input array must be a contiguous vector");
+    }
+    if (values.get_ndim() != 1 || !values.is_c_contiguous()) {
+        throw py::value_error("Array of values must be a contiguous vector");
+    }
+    if (src.get_typenum() != values.get_typenum()) {
+        throw py::value_error(
+            "Input array and array of values must have the same data type");
+    }
+
+    const std::size_t n = src.get_size();
+    if (values.get_size() < n) {
+        throw py::value_error("Array of values is too small");
+    }
+    dpctl::tensor::validation::CheckWritable::throw_if_not_writable(values);
+
+    validate_int64_vector(n_uniques, 1, "n_uniques");
+    if (counts) {
+        validate_int64_vector(*counts, n, "counts");
+    }
+    if (inverse) {
+        validate_int64_vector(*inverse, n, "inverse");
+    }
+
+    if (!dpctl::utils::queues_are_compatible(exec_q,
+                                             {src, values, n_uniques}) ||
+        (counts && !dpctl::utils::queues_are_compatible(exec_q, {*counts})) ||
+        (inverse && !dpctl::utils::queues_are_compatible(exec_q, {*inverse})))
+    {
+        throw py::value_error(
+            "Execution queue is not compatible with allocation queues");
+    }
+
+    auto const &overlap = dpctl::tensor::overlap::MemoryOverlap();
+    std::vector<const dpctl::tensor::usm_ndarray *> outputs = {&values,
+                                                               &n_uniques};
+    if (counts) {
+        outputs.push_back(&(*counts));
+    }
+    if (inverse) {
+        outputs.push_back(&(*inverse));
+    }
+    for (std::size_t i = 0; i < outputs.size(); ++i) {
+        if (overlap(src, *outputs[i])) {
+            throw py::value_error(
+                "Arrays index overlapping segments of memory");
+        }
+        for (std::size_t j = i + 1; j < outputs.size(); ++j) {
+            if (overlap(*outputs[i], *outputs[j])) {
+                throw py::value_error(
+                    "Arrays index overlapping segments of memory");
+            }
+        }
+    }
+
+    const auto &array_types = td_ns::usm_ndarray_types();
+    const int src_typeid = array_types.typenum_to_lookup_id(src.get_typenum());
+
+    auto fn = unique_contig_dispatch_vector[src_typeid];
+    if (fn == nullptr) {
+        throw py::value_error("Unique is not supported for the data type");
+    }
+
+    if (n == 0) {
+        return std::make_pair(sycl::event(), sycl::event());
+    }
+
+    std::int64_t *counts_tp =
+        (counts) ? reinterpret_cast<std::int64_t *>(counts->get_data())
+                 : nullptr;
+    std::int64_t *inverse_tp =
+        (inverse) ? reinterpret_cast<std::int64_t *>(inverse->get_data())
+                  : nullptr;
+    std::int64_t *n_uniques_tp =
+        reinterpret_cast<std::int64_t *>(n_uniques.get_data());
+
+    std::vector<sycl::event> host_task_events;
+    sycl::event comp_ev =
+        fn(exec_q, n, src.get_data(), values.get_data(), counts_tp,
+           inverse_tp, n_uniques_tp, host_task_events, depends);
+    host_task_events.push_back(comp_ev);
+
+    // keep-alive list has fixed size, absent outputs repeat the input
+    const py::object ka_objs[] = {
+        py::object(src), py::object(values), py::object(n_uniques),
+        (counts) ? py::object(*counts) : py::object(src),
+        (inverse) ? py::object(*inverse) : py::object(src)};
+    sycl::event ht_ev =
+        dpctl::utils::keep_args_alive(exec_q, ka_objs, host_task_events);
+
+    return std::make_pair(ht_ev, comp_ev);
+}
+
+bool py_unique_defined(int typenum)
+{
+    const auto &array_types = td_ns::usm_ndarray_types();
+
+    try {
+        int type_id = array_types.typenum_to_lookup_id(typenum);
+        return (nullptr != unique_contig_dispatch_vector[type_id]);
+    } catch (const std::exception &e) {
+        return false;
+    }
+}
+
+void init_unique_functions(py::module_ m)
+{
+    dpctl::tensor::py_internal::init_unique_dispatch_vectors();
+
+    m.def("_unique", &py_unique,
+          "Computes sorted unique elements of contiguous vector `src` "
+          "into `values`, their number into device scalar `n_uniques`, and "
+          "optionally their `counts` and `inverse` indices, without "
+          "synchronizing with the host.",
+          py::arg("src"), py::arg("values"), py::arg("counts"),
+          py::arg("inverse"), py::arg("n_uniques"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+
+    m.def("_unique_dtype_supported", py_unique_defined);
+
+    return;
+}
+
+} // namespace py_internal
+} // end of namespace tensor
+} // end of namespace dpctl
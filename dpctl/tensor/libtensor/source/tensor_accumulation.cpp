@@ -26,10 +26,12 @@
 #include <pybind11/pybind11.h>
 
 #include "accumulators/accumulators_common.hpp"
+#include "kernel_launch_cache_stats.hpp"
 
 namespace py = pybind11;
 
 PYBIND11_MODULE(_tensor_accumulation_impl, m)
 {
     dpctl::tensor::py_internal::init_accumulator_functions(m);
+    dpctl::tensor::py_internal::init_kernel_launch_cache_stats(m);
 }
@@ -47,6 +47,7 @@
 #include "eye_ctor.hpp"
 #include "full_ctor.hpp"
 #include "integer_advanced_indexing.hpp"
+#include "kernel_launch_cache_stats.hpp"
 #include "kernels/dpctl_tensor_types.hpp"
 #include "linear_sequences.hpp"
 #include "repeat.hpp"
@@ -86,6 +87,7 @@ using dpctl::tensor::py_internal::copy_usm_ndarray_for_roll_nd;
 /* ============= Copy from numpy.ndarray to usm_ndarray ==================== */
 
 using dpctl::tensor::py_internal::copy_numpy_ndarray_into_usm_ndarray;
+using dpctl::tensor::py_internal::copy_numpy_ndarray_into_usm_ndarray_async;
 
 /* ============= linear-sequence ==================== */
 
@@ -101,11 +103,13 @@ using dpctl::tensor::py_internal::usm_ndarray_full;
 using dpctl::tensor::py_internal::usm_ndarray_zeros;
 
 /* ============== Advanced Indexing ============= */
+using dpctl::tensor::py_internal::put_reduce_atomic_supported;
 using dpctl::tensor::py_internal::usm_ndarray_put;
 using dpctl::tensor::py_internal::usm_ndarray_take;
 
 using dpctl::tensor::py_internal::py_extract;
 using dpctl::tensor::py_internal::py_mask_positions;
+using dpctl::tensor::py_internal::py_mask_positions_async;
 using dpctl::tensor::py_internal::py_nonzero;
 using dpctl::tensor::py_internal::py_place;
 
@@ -315,6 +319,14 @@ PYBIND11_MODULE(_tensor_impl, m)
           py::arg("src"), py::arg("dst"), py::arg("sycl_queue"),
           py::arg("depends") = py::list());
 
+    m.def("_copy_numpy_ndarray_into_usm_ndarray_async",
+          &copy_numpy_ndarray_into_usm_ndarray_async,
+          "Copy from C-contiguous numpy array `src` into C-contiguous "
+          "usm_ndarray `dst` through pinned staging buffers, without "
+          "synchronizing. Returns a tuple of events: (hev, ev)",
+          py::arg("src"), py::arg("dst"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+
     m.def("_zeros_usm_ndarray", &usm_ndarray_zeros,
           "Populate usm_ndarray `dst` with zeros.", py::arg("dst"),
           py::arg("sycl_queue"), py::arg("depends") = py::list());
@@ -340,7 +352,15 @@ PYBIND11_MODULE(_tensor_impl, m)
           "Returns a tuple of events: (hev, ev)",
           py::arg("dst"), py::arg("ind"), py::arg("val"), py::arg("axis_start"),
           py::arg("mode"), py::arg("sycl_queue"),
-          py::arg("depends") = py::list());
+          py::arg("depends") = py::list(), py::arg("reduce_op") = 0);
+
+    m.def("_put_reduce_atomic_supported", &put_reduce_atomic_supported,
+          "Returns True if elements of array with data type `dtype` and USM "
+          "allocation type `dst_usm_type` can be updated by put with "
+          "reduction `reduce_op` using atomic operations on the device of "
+          "`sycl_queue`",
+          py::arg("dtype"), py::arg("reduce_op"), py::arg("dst_usm_type"),
+          py::arg("sycl_queue"));
 
     m.def("_eye", &usm_ndarray_eye,
           "Fills input 2D contiguous usm_ndarray `dst` with "
@@ -406,6 +426,12 @@ PYBIND11_MODULE(_tensor_impl, m)
           py::arg("cumsum"), py::arg("sycl_queue"),
           py::arg("depends") = py::list());
 
+    m.def("_mask_positions_async", &py_mask_positions_async,
+          "Submits computation of positions of set mask elements without "
+          "waiting for their count, which is the last element of `cumsum`",
+          py::arg("mask"), py::arg("cumsum"), py::arg("sycl_queue"),
+          py::arg("depends") = py::list());
+
     m.def("_cumsum_1d", &py_cumsum_1d, "", py::arg("src"), py::arg("cumsum"),
           py::arg("sycl_queue"), py::arg("depends") = py::list());
 
@@ -489,4 +515,6 @@ PYBIND11_MODULE(_tensor_impl, m)
           "Returns a tuple of events: (hev, ev)",
           py::arg("src"), py::arg("min"), py::arg("max"), py::arg("dst"),
           py::arg("sycl_queue"), py::arg("depends") = py::list());
+
+    dpctl::tensor::py_internal::init_kernel_launch_cache_stats(m);
 }
@@ -23,6 +23,7 @@
 /// This file defines functions of dpctl.tensor._tensor_impl extensions
 //===----------------------------------------------------------------------===//
 
+#include "kernel_launch_cache_stats.hpp"
 #include "linalg_functions/dot.hpp"
 #include <pybind11/pybind11.h>
 
@@ -31,4 +32,5 @@ namespace py = pybind11;
 PYBIND11_MODULE(_tensor_linalg_impl, m)
 {
     dpctl::tensor::py_internal::init_dot(m);
+    dpctl::tensor::py_internal::init_kernel_launch_cache_stats(m);
 }
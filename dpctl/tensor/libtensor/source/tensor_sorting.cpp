@@ -25,12 +25,14 @@
 
 #include <pybind11/pybind11.h>
 
+#include "kernel_launch_cache_stats.hpp"
 #include "sorting/merge_argsort.hpp"
 #include "sorting/merge_sort.hpp"
 #include "sorting/radix_argsort.hpp"
 #include "sorting/radix_sort.hpp"
 #include "sorting/searchsorted.hpp"
 #include "sorting/topk.hpp"
+#include "sorting/unique.hpp"
 
 namespace py = pybind11;
 
@@ -42,4 +44,6 @@ PYBIND11_MODULE(_tensor_sorting_impl, m)
     dpctl::tensor::py_internal::init_radix_sort_functions(m);
     dpctl::tensor::py_internal::init_radix_argsort_functions(m);
     dpctl::tensor::py_internal::init_topk_functions(m);
+    dpctl::tensor::py_internal::init_unique_functions(m);
+    dpctl::tensor::py_internal::init_kernel_launch_cache_stats(m);
 }
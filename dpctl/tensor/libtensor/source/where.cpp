@@ -204,6 +204,26 @@ py_where(const dpctl::tensor::usm_ndarray &condition,
 
     auto fn = where_strided_dispatch_table[x1_typeid][cond_typeid];
 
+    using dpctl::tensor::offset_utils::max_inline_nd;
+    if (nd <= max_inline_nd) {
+        // shape and strides are copied into kernel functor by value
+        using dpctl::tensor::offset_utils::host_pack;
+        const auto &packed_shape_strides = host_pack<py::ssize_t>(
+            // common shape and strides
+            simplified_shape, simplified_cond_strides, simplified_x1_strides,
+            simplified_x2_strides, simplified_dst_strides);
+
+        sycl::event where_ev =
+            fn(exec_q, nelems, nd, cond_data, x1_data, x2_data, dst_data,
+               packed_shape_strides.data(), cond_offset, x1_offset, x2_offset,
+               dst_offset, depends);
+
+        sycl::event arg_cleanup_ev =
+            keep_args_alive(exec_q, {x1, x2, condition, dst}, {where_ev});
+
+        return std::make_pair(arg_cleanup_ev, where_ev);
+    }
+
     std::vector<sycl::event> host_task_events;
     host_task_events.reserve(2);
 
@@ -42,6 +42,16 @@ __all__ = [
 ]
 
 
+@pytest.fixture(autouse=True, scope="session")
+def gemm_tuning_cache(tmp_path_factory):
+    """Keeps GEMM tile configurations tuned by the test suite out of the
+    user's cache"""
+    cache_dir = tmp_path_factory.mktemp("gemm_tuning")
+    with pytest.MonkeyPatch.context() as mp:
+        mp.setenv("DPCTL_GEMM_TUNING_CACHE", str(cache_dir / "gemm_tuning.txt"))
+        yield
+
+
 def pytest_configure(config):
     config.addinivalue_line(
         "markers",
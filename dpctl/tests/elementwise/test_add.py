@@ -572,3 +572,69 @@ def test_add_out_need_temporary():
     dpt.add(x[:6], 1, out=x[-6:])
 
     assert dpt.all(x[:-6] == 1) and dpt.all(x[-6:] == 2)
+
+
+def test_add_strided_repeated_metadata():
+    get_queue_or_skip()
+
+    x1 = dpt.reshape(dpt.arange(60, dtype="i4"), (3, 4, 5))
+    x2 = dpt.reshape(dpt.arange(60, 120, dtype="i4"), (3, 4, 5))
+    x1_np = dpt.asnumpy(x1)
+    x2_np = dpt.asnumpy(x2)
+
+    # same strided layouts issued repeatedly reuse packed shape/strides,
+    # interleaved with a different layout of the same size
+    for _ in range(3):
+        r = dpt.add(x1[:, ::-1, ::2], x2[::-1, :, ::2])
+        expected = np.add(x1_np[:, ::-1, ::2], x2_np[::-1, :, ::2])
+        assert (dpt.asnumpy(r) == expected).all()
+
+        r = dpt.add(x1[::-1, ::2, :3], x2[:, ::2, 2:])
+        expected = np.add(x1_np[::-1, ::2, :3], x2_np[:, ::2, 2:])
+        assert (dpt.asnumpy(r) == expected).all()
+
+
+@pytest.mark.parametrize("nd", [3, 8, 9])
+def test_add_strided_nd(nd):
+    get_queue_or_skip()
+
+    # strides of sliced array do not collapse, so iteration space keeps
+    # `nd` dimensions, covering by-value and USM packed metadata
+    x1 = dpt.reshape(dpt.arange(3**nd, dtype="i4"), (3,) * nd)
+    x1 = x1[(slice(None, None, 2),) * nd]
+    x2 = dpt.ones((2,) * nd, dtype="i4")
+
+    r = dpt.add(x1, x2)
+    expected = np.add(dpt.asnumpy(x1), dpt.asnumpy(x2))
+    assert (dpt.asnumpy(r) == expected).all()
+
+    x2 += x1
+    assert (dpt.asnumpy(x2) == expected).all()
+
+
+def test_add_plan_cache():
+    q = get_queue_or_skip()
+    import dpctl.tensor._tensor_elementwise_impl as tei
+
+    tei._elementwise_plan_cache_clear()
+    info = tei._elementwise_plan_cache_info()
+    assert info["hits"] == 0 and info["misses"] == 0 and info["size"] == 0
+
+    x = dpt.reshape(dpt.arange(24, dtype="i4", sycl_queue=q), (4, 6))
+    n_calls = 5
+    for _ in range(n_calls):
+        r = dpt.add(x[:, ::2], x[:, 1::2])
+    expected = np.add(dpt.asnumpy(x)[:, ::2], dpt.asnumpy(x)[:, 1::2])
+    assert (dpt.asnumpy(r) == expected).all()
+
+    info = tei._elementwise_plan_cache_info()
+    assert info["misses"] >= 1
+    assert info["hits"] >= n_calls - info["misses"]
+    assert 0 < info["size"] <= info["capacity"]
+
+    # broadcasting of a row over C-contiguous matrix
+    m = dpt.ones((5, 16), dtype="f4", sycl_queue=q)
+    v = dpt.arange(16, dtype="f4", sycl_queue=q)
+    for _ in range(3):
+        r = dpt.add(m, v)
+    assert (dpt.asnumpy(r) == 1 + np.arange(16, dtype="f4")).all()
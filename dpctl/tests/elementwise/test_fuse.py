@@ -0,0 +1,127 @@
+#                       Data Parallel Control (dpctl)
+#
+#  Copyright 2020-2025 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+
+import numpy as np
+import pytest
+from numpy.testing import assert_allclose, assert_array_equal
+
+import dpctl.tensor as dpt
+from dpctl.tests.helper import get_queue_or_skip, skip_if_dtype_not_supported
+
+
+@pytest.mark.parametrize("dtype", ["f2", "f4", "f8"])
+def test_fuse_fma_contig(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    n = 1027
+    a_np = np.linspace(-1, 1, num=n, dtype=dtype)
+    b_np = np.linspace(0, 2, num=n, dtype=dtype)
+    c_np = np.linspace(3, 5, num=n, dtype=dtype)
+    a, b, c = (dpt.asarray(v, sycl_queue=q) for v in (a_np, b_np, c_np))
+
+    fma = dpt.fuse(lambda x, y, z: x * y + z)
+    r = fma(a, b, c)
+    assert r.dtype == a.dtype
+    assert r.shape == a.shape
+
+    tol = 8 * dpt.finfo(dtype).resolution
+    assert_allclose(dpt.asnumpy(r), a_np * b_np + c_np, atol=tol, rtol=tol)
+
+
+@pytest.mark.parametrize("dtype", ["f4", "f8"])
+def test_fuse_strided_broadcast_and_scalars(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    x_np = np.arange(60, dtype=dtype).reshape(3, 4, 5) / 60
+    m_np = np.max(x_np, axis=-1, keepdims=True)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    m = dpt.asarray(m_np, sycl_queue=q)
+
+    fn = dpt.fuse(lambda v, w: dpt.exp(v - w) / 2.0 + dpt.abs(-v) ** 2)
+    r = fn(x[:, ::-1, ::2], m)
+    xs_np = x_np[:, ::-1, ::2]
+    expected = np.exp(xs_np - m_np) / 2.0 + np.abs(-xs_np) ** 2
+
+    tol = 8 * dpt.finfo(dtype).resolution
+    assert r.shape == expected.shape
+    assert_allclose(dpt.asnumpy(r), expected, atol=tol, rtol=tol)
+
+    out = dpt.empty_like(r)
+    r2 = fn(x[:, ::-1, ::2], m, out=out)
+    assert r2 is out
+    assert_allclose(dpt.asnumpy(out), expected, atol=tol, rtol=tol)
+
+
+def test_fuse_captured_array_and_inplace_out():
+    q = get_queue_or_skip()
+
+    x = dpt.arange(100, dtype="f4", sycl_queue=q)
+    s = dpt.full(100, 3, dtype="f4", sycl_queue=q)
+    fn = dpt.fuse(lambda v: dpt.maximum(v, s) - dpt.minimum(v, s))
+    expected = np.abs(np.arange(100, dtype="f4") - 3)
+    assert_array_equal(dpt.asnumpy(fn(x)), expected)
+
+    fn(x, out=x)
+    assert_array_equal(dpt.asnumpy(x), expected)
+
+
+def test_fuse_signed_zero_scalars():
+    q = get_queue_or_skip()
+
+    x = dpt.ones(10, dtype="f4", sycl_queue=q)
+    fn = dpt.fuse(lambda v: 1 / (v * -0.0) + 1 / (v * 0.0))
+    r = dpt.asnumpy(fn(x))
+    assert np.all(np.isnan(r))
+
+    fn = dpt.fuse(lambda v: (v * 0.0) + 1 / (v * -0.0))
+    r = dpt.asnumpy(fn(x))
+    assert np.all(np.isneginf(r))
+
+
+def test_fuse_fallback():
+    q = get_queue_or_skip()
+
+    # integer data type and operations not implemented by fused kernel
+    x = dpt.arange(10, dtype="i4", sycl_queue=q)
+    fn = dpt.fuse(lambda v: dpt.remainder(v * v + 1, 7))
+    x_np = np.arange(10, dtype="i4")
+    assert_array_equal(dpt.asnumpy(fn(x)), np.remainder(x_np * x_np + 1, 7))
+
+    # mixed data types follow type promotion of element-wise functions
+    y = dpt.ones(10, dtype="f4", sycl_queue=q)
+    r = dpt.fuse(lambda a, b: a + b)(x, y)
+    assert r.dtype == dpt.result_type(x, y)
+
+    # expression without operations returns a copy
+    r = dpt.fuse(lambda a: a)(y)
+    assert r is not y
+    assert_array_equal(dpt.asnumpy(r), dpt.asnumpy(y))
+
+
+def test_fuse_validation():
+    q = get_queue_or_skip()
+    x = dpt.ones(10, dtype="f4", sycl_queue=q)
+
+    with pytest.raises(TypeError):
+        dpt.fuse(None)
+    with pytest.raises(TypeError):
+        dpt.fuse(lambda a: a + 1)(np.ones(10))
+    with pytest.raises(TypeError):
+        dpt.fuse(lambda a: dpt.exp(a, out=x))(x)
+    with pytest.raises(ValueError):
+        dpt.fuse(lambda a: a + 1)(x, out=dpt.empty(5, dtype="f4"))
@@ -0,0 +1,106 @@
+#                      Data Parallel Control (dpctl)
+#
+# Copyright 2020-2025 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+""" Defines unit test cases for recording and replay of offloaded
+operations with dpctl.graph.
+"""
+
+import numpy as np
+import pytest
+
+import dpctl
+import dpctl.graph
+import dpctl.tensor as dpt
+from dpctl.tests.helper import get_queue_or_skip
+
+
+def _native_modes(q):
+    return [False, True] if dpctl.graph.is_supported(q) else [False]
+
+
+def test_capture_validation():
+    with pytest.raises(TypeError):
+        with dpctl.graph.capture(dict()):
+            pass
+    with pytest.raises(TypeError):
+        dpctl.graph.Graph()
+
+
+@pytest.mark.parametrize("native", [False, True])
+def test_capture_call_replay(native):
+    q = get_queue_or_skip()
+    if native and not dpctl.graph.is_supported(q):
+        pytest.skip("Device does not support SYCL command graphs")
+
+    x = dpt.arange(64, dtype="i4", sycl_queue=q)
+    y = dpt.empty_like(x)
+    with dpctl.graph.capture(q, native=native) as g:
+        g.call(dpt.multiply, x, 2, out=y)
+        z = g.call(dpt.add, y, 1)
+    assert g.is_native == native
+    assert g.num_commands > 0
+
+    g.replay()
+    g.wait()
+    expected = 2 * np.arange(64, dtype="i4") + 1
+    assert np.array_equal(dpt.asnumpy(z), expected)
+
+    x_new = dpt.full(64, 3, dtype="i4", sycl_queue=q)
+    z_out = dpt.empty_like(z)
+    for _ in range(3):
+        g.replay(inputs=[(x, x_new)], outputs=[(z, z_out)])
+    g.wait()
+    assert dpt.all(z_out == 7)
+    assert dpt.all(x == 3)
+
+    with pytest.raises(ValueError):
+        g.replay(inputs=[(x, dpt.ones(8, dtype="i4", sycl_queue=q))])
+
+
+def test_capture_fallback_rejects_untracked_operations():
+    q = get_queue_or_skip()
+    x = dpt.ones(16, dtype="f4", sycl_queue=q)
+    with pytest.raises(RuntimeError):
+        with dpctl.graph.capture(q, native=False):
+            dpt.add(x, x)
+
+
+def test_capture_native_records_all_operations():
+    q = get_queue_or_skip()
+    if not dpctl.graph.is_supported(q):
+        pytest.skip("Device does not support SYCL command graphs")
+
+    x = dpt.ones((8, 8), dtype="f4", sycl_queue=q)
+    with dpctl.graph.capture(q) as g:
+        y = dpt.sum(x.T + 1, axis=0)
+    del x
+    for _ in range(2):
+        g.replay()
+    g.wait()
+    assert np.array_equal(dpt.asnumpy(y), np.full(8, 16, dtype="f4"))
+
+
+def test_capture_discards_on_error():
+    q = get_queue_or_skip()
+    for native in _native_modes(q):
+        with pytest.raises(ZeroDivisionError):
+            with dpctl.graph.capture(q, native=native) as g:
+                1 / 0
+        with pytest.raises(RuntimeError):
+            g.replay()
+        # the order manager is usable again
+        x = dpt.ones(4, dtype="i4", sycl_queue=q)
+        assert dpt.all(x + 1 == 2)
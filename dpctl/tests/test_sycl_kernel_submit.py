@@ -320,3 +320,54 @@ def test_submit_local_accessor_arg():
         2 * lws
     )
     assert dpt.all(x == expected)
+
+
+def test_prepared_launch():
+    try:
+        q = dpctl.SyclQueue("opencl")
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("OpenCL queue could not be created")
+    oclSrc = (
+        "kernel void axpy(global int *a, global int *b, int d) {"
+        "   size_t index = get_global_id(0);"
+        "   b[index] = d * a[index] + b[index];"
+        "}"
+    )
+    prog = dpctl_prog.create_program_from_source(q, oclSrc)
+    axpyKernel = prog.get_sycl_kernel("axpy")
+
+    n = 1024
+    a = dpt.arange(n, dtype="i4", sycl_queue=q)
+    b = dpt.zeros(n, dtype="i4", sycl_queue=q)
+    launch = q.prepare_launch(
+        axpyKernel, [a.usm_data, b.usm_data, ctypes.c_int(2)], [n], [64]
+    )
+    assert isinstance(launch, dpctl.SyclKernelLaunch)
+    assert launch.num_args == 3
+    assert launch.sycl_queue == q
+
+    e = launch.submit_async()
+    launch.submit([e])
+    expected = 4 * np.arange(n, dtype="i4")
+    assert np.array_equal(dpt.asnumpy(b), expected)
+
+    c = dpt.ones(n, dtype="i4", sycl_queue=q)
+    launch.set_arg(1, c.usm_data)
+    launch.set_arg(2, ctypes.c_int(3))
+    launch.submit()
+    assert np.array_equal(dpt.asnumpy(c), 3 * np.arange(n, dtype="i4") + 1)
+    # previously bound output is not modified by later submissions
+    assert np.array_equal(dpt.asnumpy(b), expected)
+
+    with pytest.raises(TypeError):
+        launch.set_arg(2, ctypes.c_double(3))
+    with pytest.raises(TypeError):
+        launch.set_arg(2, 3)
+    with pytest.raises(IndexError):
+        launch.set_arg(3, ctypes.c_int(3))
+    with pytest.raises(dpctl.SyclKernelInvalidRangeError):
+        q.prepare_launch(axpyKernel, [], [1, 1, 1, 1])
+    with pytest.raises(ValueError):
+        q.prepare_launch(axpyKernel, [], [n], [8, 8])
+    with pytest.raises(TypeError):
+        dpctl.SyclKernelLaunch()
@@ -263,3 +263,59 @@ def test_create_program_from_invalid_src_ocl():
     }"
     with pytest.raises(dpctl_prog.SyclProgramCompilationError):
         dpctl_prog.create_program_from_source(q, invalid_oclSrc)
+
+
+def test_program_cache_ocl(tmp_path):
+    try:
+        q = dpctl.SyclQueue("opencl")
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("No OpenCL queue is available")
+    spirv_file = get_spirv_abspath("multi_kernel.spv")
+    with open(spirv_file, "rb") as fin:
+        spirv = fin.read()
+
+    saved_dir = dpctl_prog.get_program_cache_dir()
+    saved_limits = dpctl_prog.get_program_cache_limits()
+    try:
+        dpctl_prog.set_program_cache_dir(tmp_path)
+        assert dpctl_prog.get_program_cache_dir() == str(tmp_path)
+        dpctl_prog.clear_program_cache()
+
+        stats = dpctl_prog.get_program_cache_stats()
+        prog = dpctl_prog.create_program_from_spirv(q, spirv)
+        _check_multi_kernel_program(prog)
+        assert any(tmp_path.glob("*.bin"))
+        new_stats = dpctl_prog.get_program_cache_stats()
+        assert new_stats["misses"] == stats["misses"] + 1
+        assert new_stats["disk_hits"] == stats["disk_hits"]
+
+        # drop binaries kept in memory to load the program from disk
+        dpctl_prog.clear_program_cache(disk=False)
+        stats = new_stats
+        prog = dpctl_prog.create_program_from_spirv(q, spirv)
+        _check_multi_kernel_program(prog)
+        new_stats = dpctl_prog.get_program_cache_stats()
+        assert new_stats["disk_hits"] == stats["disk_hits"] + 1
+        assert new_stats["misses"] == stats["misses"]
+        assert new_stats["rejected"] == stats["rejected"]
+
+        # the loaded binary is kept in memory for subsequent builds
+        stats = new_stats
+        prog = dpctl_prog.create_program_from_spirv(q, spirv)
+        _check_multi_kernel_program(prog)
+        new_stats = dpctl_prog.get_program_cache_stats()
+        assert new_stats["memory_hits"] == stats["memory_hits"] + 1
+        assert new_stats["disk_hits"] == stats["disk_hits"]
+
+        dpctl_prog.set_program_cache_limits(memory=0, disk=0)
+        assert dpctl_prog.get_program_cache_limits() == {
+            "memory": 0,
+            "disk": 0,
+        }
+        assert not any(tmp_path.glob("*.bin"))
+        with pytest.raises(ValueError):
+            dpctl_prog.set_program_cache_limits(memory=-1)
+    finally:
+        dpctl_prog.set_program_cache_dir(saved_dir)
+        dpctl_prog.set_program_cache_limits(**saved_limits)
+        dpctl_prog.clear_program_cache()
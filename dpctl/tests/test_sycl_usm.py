@@ -678,3 +678,124 @@ def test_memset():
     m_ho.memset(ord("7"))
     m_ho.copy_to_host(host_buf)
     assert host_buf == b"7" * n
+
+
+def test_usm_pool():
+    from dpctl.memory import (
+        disable_pool,
+        enable_pool,
+        is_pool_enabled,
+        pool_stats,
+        trim,
+    )
+
+    try:
+        q = dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Default queue could not be created")
+
+    assert not is_pool_enabled()
+    enable_pool(max_cached_bytes=1 << 20)
+    try:
+        assert is_pool_enabled()
+        stats0 = pool_stats()["device"]
+        assert stats0["max_cached_bytes"] == 1 << 20
+
+        m = MemoryUSMDevice(1000, queue=q)
+        ptr = m._pointer
+        del m
+        stats1 = pool_stats()["device"]
+        assert stats1["misses"] == stats0["misses"] + 1
+        assert stats1["cached_bytes"] >= 1000
+
+        # request of the same size class reuses the block
+        m = MemoryUSMDevice(900, queue=q)
+        assert m._pointer == ptr
+        assert m.nbytes == 900
+        stats2 = pool_stats()["device"]
+        assert stats2["hits"] == stats1["hits"] + 1
+        assert stats2["in_use_bytes"] >= 900
+
+        host_buf = bytearray(b"a" * 900)
+        m.copy_from_host(host_buf)
+        copy_buf = bytearray(900)
+        m.copy_to_host(copy_buf)
+        assert host_buf == copy_buf
+        del m
+
+        assert trim("device") > 0
+        assert pool_stats()["device"]["cached_bytes"] == 0
+        assert trim() == 0
+        with pytest.raises(ValueError):
+            trim("unknown")
+        with pytest.raises(ValueError):
+            enable_pool(max_cached_bytes=-1)
+    finally:
+        disable_pool()
+    assert not is_pool_enabled()
+    assert pool_stats()["device"]["cached_bytes"] == 0
+
+
+def test_memory_release_after_last_use():
+    try:
+        q = dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Default queue could not be created")
+
+    n = 1 << 20
+    src = MemoryUSMHost(n, queue=q)
+    src.memset(ord("d"))
+    dst = MemoryUSMHost(n, queue=q)
+    dst.memset()
+
+    tmp = MemoryUSMDevice(n, queue=q)
+    e1 = q.memcpy_async(tmp, src, n)
+    e2 = q.memcpy_async(dst, tmp, n, [e1])
+    # release of the temporary is deferred until copies complete
+    del tmp
+    e2.wait()
+    q.wait()
+
+    assert dst.tobytes() == b"d" * n
+
+
+def test_memory_release_deferred_until_last_use():
+    from dpctl.memory import disable_pool, enable_pool, pool_stats
+
+    try:
+        q = dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Default queue could not be created")
+
+    n = 1 << 24
+    src = MemoryUSMHost(n, queue=q)
+    src.memset(ord("d"))
+    dst = MemoryUSMHost(n, queue=q)
+    dst.memset()
+
+    enable_pool(max_cached_bytes=1 << 27)
+    try:
+        tmp = MemoryUSMDevice(n, queue=q)
+        unused = MemoryUSMDevice(n, queue=q)
+        e1 = q.memcpy_async(tmp, src, n)
+        e2 = q.memcpy_async(dst, tmp, n, [e1])
+
+        # allocation not used by pending tasks is released immediately
+        cached0 = pool_stats()["device"]["cached_bytes"]
+        del unused
+        cached1 = pool_stats()["device"]["cached_bytes"]
+        assert cached1 >= cached0 + n
+
+        del tmp
+        cached2 = pool_stats()["device"]["cached_bytes"]
+        if e2.execution_status != dpctl.event_status_type.complete:
+            # the copy reading the temporary has not completed by the time
+            # the pool was queried, so the temporary is still in use
+            assert cached2 == cached1
+
+        e2.wait()
+        q.wait()
+        assert pool_stats()["device"]["cached_bytes"] >= cached1 + n
+        assert dst.tobytes() == b"d" * n
+    finally:
+        disable_pool()
@@ -433,3 +433,20 @@ def test_gh_2017(dt):
     x = dpt.asarray([-1, 1], dtype=dpt.dtype(dt), sycl_queue=q)
     r = dpt.cumulative_sum(x, dtype="?")
     assert dpt.all(r)
+
+
+@pytest.mark.parametrize("include_initial", [False, True])
+def test_cumulative_sum_many_tiles(include_initial):
+    get_queue_or_skip()
+
+    n_rows, n = 3, 70001
+    dt = dpt.int64
+    inp = dpt.ones((n_rows, n), dtype=dt)
+    r = dpt.cumulative_sum(inp, axis=1, include_initial=include_initial)
+    start = 0 if include_initial else 1
+    expected = dpt.arange(start, n + 1, dtype=dt)
+    assert dpt.all(r == expected[dpt.newaxis, :])
+
+    # strided input
+    r = dpt.cumulative_sum(inp.mT[::-1, :], axis=0)
+    assert dpt.all(r == dpt.arange(1, n + 1, dtype=dt)[:, dpt.newaxis])
@@ -14,10 +14,14 @@
 #  See the License for the specific language governing permissions and
 #  limitations under the License.
 
+import numpy as np
 import pytest
 
 import dpctl.tensor as dpt
-from dpctl.tensor._tensor_impl import default_device_fp_type
+from dpctl.tensor._tensor_impl import (
+    default_device_fp_type,
+    default_device_index_type,
+)
 from dpctl.tests.helper import get_queue_or_skip, skip_if_dtype_not_supported
 
 _no_complex_dtypes = [
@@ -225,6 +229,35 @@ def test_var_axis_length_correction():
     assert dpt.all(dpt.isnan(r))
 
 
+@pytest.mark.parametrize("dt", ["i4", "f4", "f8"])
+def test_var_std_large_reductions(dt):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+
+    # reductions large enough to require combining partial results
+    # computed by different work-groups, over contiguous and strided axes
+    x_np = (np.arange(3 * 40007) % 97).astype(dt).reshape(3, 40007)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    res_dt = dpt.var(x).dtype
+    tol = 1e-4 if res_dt == dpt.float32 else 1e-10
+
+    for axis, correction in [(None, 0), (1, 1), (0, 0.5)]:
+        r = dpt.var(x, axis=axis, correction=correction)
+        expected = np.var(x_np.astype("f8"), axis=axis, ddof=correction)
+        assert np.allclose(dpt.asnumpy(r), expected, rtol=tol)
+
+        r = dpt.std(x.mT, axis=axis, correction=correction)
+        expected = np.std(x_np.T.astype("f8"), axis=axis, ddof=correction)
+        assert np.allclose(dpt.asnumpy(r), expected, rtol=tol)
+
+    # large offset does not lose precision
+    y_np = 1e4 + np.linspace(0, 1, num=100000)
+    y = dpt.asarray(y_np, dtype="f4", sycl_queue=q)
+    assert np.allclose(
+        dpt.asnumpy(dpt.var(y)), np.var(y_np.astype("f4")), rtol=1e-3
+    )
+
+
 def test_stat_function_errors():
     d = dict()
     with pytest.raises(TypeError):
@@ -253,3 +286,133 @@ def test_stat_function_errors():
         dpt.var(x)
     with pytest.raises(ValueError):
         dpt.std(x)
+
+
+@pytest.mark.parametrize("dt", ["i1", "u1", "i2", "u2", "i4", "u4", "i8", "u8"])
+def test_bincount(dt):
+    q = get_queue_or_skip()
+
+    x_np = np.tile(np.arange(0, 100, 3, dtype=dt), 50)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    r = dpt.bincount(x)
+    assert r.dtype == dpt.dtype(default_device_index_type(q))
+    assert np.array_equal(dpt.asnumpy(r), np.bincount(x_np))
+
+    r = dpt.bincount(x, minlength=200)
+    assert r.shape == (200,)
+    assert np.array_equal(dpt.asnumpy(r), np.bincount(x_np, minlength=200))
+
+    r = dpt.bincount(x[::-2])
+    assert np.array_equal(dpt.asnumpy(r), np.bincount(x_np[::-2]))
+
+
+def test_bincount_weights():
+    q = get_queue_or_skip()
+
+    x_np = np.arange(1000, dtype="i4") % 17
+    w_np = np.linspace(0, 1, num=x_np.size, dtype="f4")
+    x = dpt.asarray(x_np, sycl_queue=q)
+    w = dpt.asarray(w_np, sycl_queue=q)
+    r = dpt.bincount(x, w)
+    assert r.dtype == dpt.float32
+    assert np.allclose(dpt.asnumpy(r), np.bincount(x_np, w_np), rtol=1e-5)
+
+    w_i = dpt.ones(x.shape, dtype="i4", sycl_queue=q)
+    r = dpt.bincount(x, w_i)
+    assert r.dtype == dpt.dtype(default_device_fp_type(q))
+    assert np.array_equal(dpt.asnumpy(r), np.bincount(x_np).astype(r.dtype))
+
+    w_c = dpt.asarray(w_np + 1j * w_np, dtype="c8", sycl_queue=q)
+    r = dpt.bincount(x, w_c)
+    assert r.dtype == dpt.complex64
+    expected = np.bincount(x_np, w_np)
+    assert np.allclose(dpt.asnumpy(r), expected + 1j * expected, rtol=1e-5)
+
+
+def test_bincount_empty_and_errors():
+    q = get_queue_or_skip()
+
+    x = dpt.empty(0, dtype="i4", sycl_queue=q)
+    assert dpt.bincount(x).shape == (0,)
+    r = dpt.bincount(x, minlength=5)
+    assert np.array_equal(dpt.asnumpy(r), np.zeros(5))
+
+    with pytest.raises(TypeError):
+        dpt.bincount(dict())
+    with pytest.raises(TypeError):
+        dpt.bincount(dpt.ones(3, dtype="f4", sycl_queue=q))
+    with pytest.raises(ValueError):
+        dpt.bincount(dpt.ones((2, 2), dtype="i4", sycl_queue=q))
+    with pytest.raises(ValueError):
+        dpt.bincount(dpt.asarray([1, -1], dtype="i4", sycl_queue=q))
+    with pytest.raises(ValueError):
+        dpt.bincount(x, minlength=-1)
+    with pytest.raises(ValueError):
+        dpt.bincount(
+            dpt.ones(3, dtype="i4", sycl_queue=q),
+            dpt.ones(2, dtype="f4", sycl_queue=q),
+        )
+
+
+@pytest.mark.parametrize("dt", ["i4", "f2", "f4", "f8"])
+def test_histogram_uniform(dt):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+
+    x_np = np.linspace(-3, 7, num=1234).astype(dt)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    for bins in [1, 7, 10, 100]:
+        hist, edges = dpt.histogram(x, bins=bins)
+        assert hist.dtype == dpt.dtype(default_device_index_type(q))
+        assert edges.shape == (bins + 1,)
+        expected, _ = np.histogram(x_np, bins=dpt.asnumpy(edges))
+        assert np.array_equal(dpt.asnumpy(hist), expected)
+        assert int(dpt.sum(hist)) == x_np.size
+
+    hist, edges = dpt.histogram(x, bins=4, range=(0, 4))
+    expected, _ = np.histogram(x_np, bins=dpt.asnumpy(edges))
+    assert np.array_equal(dpt.asnumpy(hist), expected)
+
+
+def test_histogram_edges():
+    q = get_queue_or_skip()
+
+    x_np = np.linspace(0, 10, num=1001, dtype="f4").reshape(11, 91)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    edges_np = np.asarray([0, 0.5, 1, 3, 3, 8, 10], dtype="f4")
+    edges = dpt.asarray(edges_np, sycl_queue=q)
+    w_np = np.ones_like(x_np) * 0.5
+    w = dpt.asarray(w_np, sycl_queue=q)
+
+    hist, r_edges = dpt.histogram(x, bins=edges, weights=w)
+    expected, _ = np.histogram(x_np, bins=edges_np, weights=w_np)
+    assert np.allclose(dpt.asnumpy(hist), expected)
+    assert np.array_equal(dpt.asnumpy(r_edges), edges_np)
+
+    # values outside of the edges and NaNs are not counted
+    y = dpt.asarray([-1, 0, 5, 10, 11, np.nan], dtype="f4", sycl_queue=q)
+    hist, _ = dpt.histogram(y, bins=edges)
+    assert int(dpt.sum(hist)) == 3
+
+    with pytest.raises(ValueError):
+        dpt.histogram(x, bins=edges[::-1])
+
+
+def test_histogram_errors():
+    q = get_queue_or_skip()
+
+    x = dpt.ones(10, dtype="f4", sycl_queue=q)
+    with pytest.raises(TypeError):
+        dpt.histogram(dict())
+    with pytest.raises(TypeError):
+        dpt.histogram(dpt.ones(3, dtype="c8", sycl_queue=q))
+    with pytest.raises(TypeError):
+        dpt.histogram(x, bins=1.5)
+    with pytest.raises(ValueError):
+        dpt.histogram(x, bins=0)
+    with pytest.raises(ValueError):
+        dpt.histogram(x, range=(1, 0))
+    with pytest.raises(ValueError):
+        dpt.histogram(x, range=(0, np.inf))
+    with pytest.raises(ValueError):
+        dpt.histogram(x, bins=dpt.ones(1, dtype="f4", sycl_queue=q))
@@ -1164,6 +1164,68 @@ def test_tofrom_numpy_permuted(dtype, usm_type):
     assert np.array_equal(dpt.to_numpy(Xusm), Ynp)
 
 
+@pytest.mark.parametrize("dtype", ["i4", "f4", "c8"])
+@pytest.mark.parametrize("usm_type", ["device", "shared", "host"])
+def test_from_numpy_async(dtype, usm_type):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    # spans several staging buffers, and ends with a partial chunk
+    n = 3 * 2**20 + 7
+    Ynp = np.arange(n, dtype=dtype)
+    Xusm = dpt.from_numpy_async(Ynp, usm_type=usm_type, sycl_queue=q)
+    assert Xusm.dtype == Ynp.dtype
+    assert Xusm.usm_type == usm_type
+    assert np.array_equal(dpt.asnumpy(Xusm), Ynp)
+
+    # non-contiguous input
+    Znp = np.ones((4, 6), dtype=dtype).T[::2]
+    Xusm = dpt.from_numpy_async(Znp, sycl_queue=q)
+    assert Xusm.flags.c_contiguous
+    assert np.array_equal(dpt.asnumpy(Xusm), Znp)
+
+    Xusm = dpt.from_numpy_async(np.empty((0, 3), dtype=dtype), sycl_queue=q)
+    assert Xusm.shape == (0, 3)
+
+
+def test_from_numpy_async_fp64_on_host():
+    q = get_queue_or_skip()
+
+    Ynp = np.linspace(0, 1, num=1001, dtype="f8")
+    Xusm = dpt.from_numpy_async(Ynp, sycl_queue=q)
+    if q.sycl_device.has_aspect_fp64:
+        assert Xusm.dtype == dpt.float64
+    else:
+        assert Xusm.dtype == dpt.float32
+    assert np.allclose(dpt.asnumpy(Xusm), Ynp)
+
+
+@pytest.mark.parametrize("repack", [True, False])
+def test_to_numpy_async(repack):
+    q = get_queue_or_skip()
+
+    Xnp = np.arange(6 * 7 * 8, dtype="i4").reshape(6, 7, 8)
+    X = dpt.asarray(Xnp, sycl_queue=q)
+    for ind in [
+        (Ellipsis,),
+        (slice(None, None, -2), slice(1, None), slice(None, None, 3)),
+    ]:
+        Ynp, ev = dpt.to_numpy_async(X[ind], repack=repack)
+        assert isinstance(ev, dpctl.SyclEvent)
+        ev.wait()
+        assert Ynp.flags.c_contiguous
+        assert np.array_equal(Ynp, Xnp[ind])
+
+    Ynp, ev = dpt.to_numpy_async(X[0].mT)
+    ev.wait()
+    assert Ynp.flags.f_contiguous
+    assert np.array_equal(Ynp, Xnp[0].T)
+
+    Ynp, ev = dpt.to_numpy_async(dpt.empty((0, 3), sycl_queue=q))
+    ev.wait()
+    assert Ynp.shape == (0, 3)
+
+
 @pytest.mark.parametrize(
     "dtype",
     _all_dtypes,
@@ -1587,6 +1649,27 @@ def test_copy_unaligned():
     assert dpt.all(r == 1)
 
 
+def test_kernel_launch_cache_reuse():
+    q = get_queue_or_skip()
+
+    import dpctl.tensor._tensor_impl as ti
+
+    # copying a strided matrix into C-contiguous layout always queries
+    # launch parameters of the copy kernel from the cache
+    x = dpt.reshape(dpt.arange(8 * 64, dtype="i4", sycl_queue=q), (8, 64))
+    x_s = x[:, ::2]
+    r1 = dpt.copy(x_s, order="C")
+    stats1 = ti._kernel_launch_cache_stats()
+    r2 = dpt.copy(x_s, order="C")
+    stats2 = ti._kernel_launch_cache_stats()
+
+    assert dpt.all(r1 == r2)
+    # repeated call must be served from the cache
+    assert stats2["misses"] == stats1["misses"]
+    assert stats2["entries"] == stats1["entries"]
+    assert stats2["hits"] > stats1["hits"]
+
+
 def test_ctor_invalid():
     try:
         m = dpm.MemoryUSMShared(12)
@@ -1528,6 +1528,88 @@ def test_nonzero_dtype():
     assert idy.dtype == index_dt
 
 
+def test_extract_deferred():
+    get_queue_or_skip()
+    x = dpt.arange(20, dtype="i4")
+    cond = dpt.remainder(x, 3) == 0
+    r = dpt.extract_deferred(cond, x)
+    assert isinstance(r, dpt.PaddedArray)
+    assert r.padded.shape == x.shape
+    assert r.count.shape == tuple()
+    assert int(r.count) == 7
+    expected = np.arange(0, 20, 3, dtype="i4")
+    assert_array_equal(dpt.asnumpy(r.view()), expected)
+    assert_array_equal(dpt.asnumpy(r.valid_mask), np.arange(20) < 7)
+
+    # chained selection excludes padding entries
+    r2 = dpt.extract_deferred(r, r)
+    assert_array_equal(dpt.asnumpy(r2.view()), expected[1:])
+
+
+def test_extract_deferred_empty():
+    get_queue_or_skip()
+    x = dpt.arange(5, dtype="i4")
+    r = dpt.extract_deferred(dpt.zeros(5, dtype="?"), x)
+    assert int(r.count) == 0
+    assert r.view().shape == (0,)
+    r = dpt.extract_deferred(dpt.ones(0, dtype="?"), x[:0])
+    assert r.padded.shape == (0,)
+    assert int(r.count) == 0
+
+
+def test_nonzero_deferred():
+    get_queue_or_skip()
+    x = dpt.reshape(dpt.arange(12, dtype="i4"), (3, 4))
+    x = dpt.remainder(x, 5)
+    r = dpt.nonzero_deferred(x)
+    assert r.axis == 1
+    assert r.padded.shape == (2, 12)
+    res = dpt.asnumpy(r.view())
+    expected = np.nonzero(dpt.asnumpy(x))
+    assert_array_equal(res[0], expected[0])
+    assert_array_equal(res[1], expected[1])
+    index_dt = dpt.dtype(ti.default_device_index_type(x.sycl_queue))
+    assert r.padded.dtype == index_dt
+
+    with pytest.raises(ValueError):
+        dpt.nonzero_deferred(dpt.ones(tuple(), dtype="?"))
+
+
+def test_deferred_padded_condition():
+    get_queue_or_skip()
+    x = dpt.arange(12, dtype="i4")
+    # values 1, 0, 2, 1, 0, 2 followed by 6 padding entries
+    r = dpt.extract_deferred(dpt.remainder(x, 2) == 1, dpt.remainder(x, 3))
+    (expected,) = np.nonzero(dpt.asnumpy(r.view()))
+
+    r2 = dpt.extract_deferred(r, x)
+    assert isinstance(r2, dpt.PaddedArray)
+    assert int(r2.count) == expected.size
+    assert_array_equal(dpt.asnumpy(r2.view()), expected)
+
+    r3 = dpt.nonzero_deferred(r)
+    assert isinstance(r3, dpt.PaddedArray)
+    assert r3.padded.shape == (1, 12)
+    assert int(r3.count) == expected.size
+    assert_array_equal(dpt.asnumpy(r3.view())[0], expected)
+
+    # only one-dimensional PaddedArray is a valid condition
+    with pytest.raises(ValueError):
+        dpt.nonzero_deferred(r3)
+
+
+def test_place_broadcast_vals_along_mask():
+    get_queue_or_skip()
+    x = dpt.reshape(dpt.arange(12, dtype="i2"), (3, 4))
+    sel = dpt.asarray([True, False, True, False])
+    x[:, sel] = dpt.asarray([[-1], [-2], [-3]], dtype="i2")
+    expected = np.arange(12, dtype="i2").reshape(3, 4)
+    expected[:, [0, 2]] = np.array([[-1], [-2], [-3]], dtype="i2")
+    assert_array_equal(dpt.asnumpy(x), expected)
+    x[:, dpt.zeros(4, dtype="?")] = dpt.asarray(7, dtype="i2")
+    assert_array_equal(dpt.asnumpy(x), expected)
+
+
 def test_take_empty_axes():
     get_queue_or_skip()
 
@@ -2037,3 +2119,104 @@ def test_getitem_impl_fn_invalid_inp():
     no_array_inds = (2, 3)
     with pytest.raises(TypeError):
         _take_multi_index(x, no_array_inds, 0, 0)
+
+
+_put_reduce_ufuncs = {
+    "add": np.add,
+    "mul": np.multiply,
+    "max": np.maximum,
+    "min": np.minimum,
+}
+
+
+@pytest.mark.parametrize("reduce", ["add", "mul", "max", "min"])
+@pytest.mark.parametrize(
+    "data_dt", ["?", "i1", "u2", "i4", "u8", "f2", "f4", "f8", "c8"]
+)
+def test_put_reduce_duplicates(data_dt, reduce):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(data_dt, q)
+    if data_dt == "c8" and reduce in ("max", "min"):
+        pytest.skip("Ordering of complex values is not tested")
+
+    ind_np = np.asarray([0, 3, 3, 1, 0, 3, 5, -1, 3], dtype="i8")
+    vals_np = np.arange(1, ind_np.size + 1).astype(data_dt)
+    x_np = np.ones(7, dtype=data_dt)
+
+    x = dpt.asarray(x_np, sycl_queue=q)
+    dpt.put(
+        x,
+        dpt.asarray(ind_np, sycl_queue=q),
+        dpt.asarray(vals_np, sycl_queue=q),
+        reduce=reduce,
+    )
+    _put_reduce_ufuncs[reduce].at(x_np, ind_np, vals_np)
+    assert_array_equal(dpt.asnumpy(x), x_np)
+
+
+@pytest.mark.parametrize("data_dt", ["i2", "f4"])
+def test_put_reduce_strided_destination(data_dt):
+    q = get_queue_or_skip()
+
+    x_np = np.zeros((4, 10), dtype=data_dt)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    ind_np = np.asarray([1, 1, 4, 1], dtype="i4")
+    vals_np = np.ones((2, ind_np.size), dtype=data_dt)
+
+    dpt.put(
+        x[::2, ::-2],
+        dpt.asarray(ind_np, sycl_queue=q),
+        dpt.asarray(vals_np, sycl_queue=q),
+        axis=1,
+        reduce="add",
+    )
+    np.add.at(x_np[::2, ::-2], (slice(None), ind_np), vals_np)
+    assert_array_equal(dpt.asnumpy(x), x_np)
+
+
+def test_put_reduce_broadcast_vals():
+    q = get_queue_or_skip()
+
+    x = dpt.zeros(5, dtype="i4", sycl_queue=q)
+    ind = dpt.zeros(100, dtype="i4", sycl_queue=q)
+    dpt.put(x, ind, 2, reduce="add")
+    assert_array_equal(dpt.asnumpy(x), [200, 0, 0, 0, 0])
+
+    dpt.put(x, ind[:3], 1, mode="clip", reduce="max")
+    assert_array_equal(dpt.asnumpy(x), [200, 0, 0, 0, 0])
+
+
+def test_put_along_axis_reduce():
+    q = get_queue_or_skip()
+
+    x_np = np.zeros((3, 4), dtype="f4")
+    ind_np = np.asarray([[0, 0, 2], [1, 3, 1], [2, 2, 2]], dtype="i8")
+    vals_np = np.arange(9, dtype="f4").reshape(3, 3)
+
+    x = dpt.asarray(x_np, sycl_queue=q)
+    dpt.put_along_axis(
+        x,
+        dpt.asarray(ind_np, sycl_queue=q),
+        dpt.asarray(vals_np, sycl_queue=q),
+        axis=1,
+        reduce="add",
+    )
+    rows = np.broadcast_to(np.arange(3)[:, np.newaxis], ind_np.shape)
+    np.add.at(x_np, (rows, ind_np), vals_np)
+    assert_array_equal(dpt.asnumpy(x), x_np)
+
+
+def test_put_reduce_validation():
+    q = get_queue_or_skip()
+
+    x = dpt.zeros(5, dtype="i4", sycl_queue=q)
+    ind = dpt.zeros(2, dtype="i4", sycl_queue=q)
+    with pytest.raises(ValueError):
+        dpt.put(x, ind, 1, reduce="sum")
+    with pytest.raises(ValueError):
+        dpt.put_along_axis(x, ind, 1, reduce=1)
+    with pytest.raises(ValueError):
+        ti._put_reduce_atomic_supported(x.dtype, 0, "device", q)
+    assert isinstance(
+        ti._put_reduce_atomic_supported(x.dtype, 1, "device", q), bool
+    )
@@ -653,6 +653,75 @@ def test_matmul_largish_rect(dtype, random_matrix):
     assert dpt.allclose(x1, dpt.asarray(x_np), atol=tol, rtol=tol)
 
 
+@pytest.mark.parametrize("dtype", ["f4", "f8"])
+@pytest.mark.parametrize("autotune", ["0", "1"])
+def test_matmul_tiled(dtype, autotune, tmp_path, monkeypatch):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    cache_path = tmp_path / "gemm_tuning.txt"
+    monkeypatch.setenv("DPCTL_GEMM_AUTOTUNE", autotune)
+    monkeypatch.setenv("DPCTL_GEMM_TUNING_CACHE", str(cache_path))
+
+    rs = np.random.RandomState(seed=654321)
+    # shapes not divisible by tile sizes
+    a_np = rs.randint(low=-3, high=4, size=(3, 101, 67)).astype(dtype)
+    b_np = rs.randint(low=-3, high=4, size=(3, 67, 93)).astype(dtype)
+
+    a = dpt.asarray(a_np, sycl_queue=q)
+    b = dpt.asarray(b_np, sycl_queue=q)
+
+    r = dpt.matmul(a, b)
+    assert dpt.all(r == dpt.asarray(np.matmul(a_np, b_np), sycl_queue=q))
+
+    r = dpt.matmul(a[1], b[2])
+    assert dpt.all(
+        r == dpt.asarray(np.matmul(a_np[1], b_np[2]), sycl_queue=q)
+    )
+
+    # broadcast batch dimension
+    r = dpt.matmul(a, b[0])
+    assert dpt.all(r == dpt.asarray(np.matmul(a_np, b_np[0]), sycl_queue=q))
+
+    # only tuned configurations are persisted
+    assert cache_path.exists() == (autotune == "1")
+
+
+@pytest.mark.parametrize("dtype", ["f4", "f8"])
+def test_matmul_tiled_strided(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    rs = np.random.RandomState(seed=654321)
+    a_np = rs.randint(low=-3, high=4, size=(3, 67, 101)).astype(dtype)
+    b_np = rs.randint(low=-3, high=4, size=(3, 93, 67)).astype(dtype)
+
+    a = dpt.asarray(a_np, sycl_queue=q)
+    b = dpt.asarray(b_np, sycl_queue=q)
+
+    # transposed operands
+    r = dpt.matmul(a.mT, b.mT)
+    expected = np.matmul(np.swapaxes(a_np, -1, -2), np.swapaxes(b_np, -1, -2))
+    assert dpt.all(r == dpt.asarray(expected, sycl_queue=q))
+
+    r = dpt.matmul(a[1].mT, b[2].mT)
+    expected = np.matmul(a_np[1].T, b_np[2].T)
+    assert dpt.all(r == dpt.asarray(expected, sycl_queue=q))
+
+    # transposed operand broadcast along batch dimension
+    r = dpt.matmul(a.mT, b[0].mT)
+    expected = np.matmul(np.swapaxes(a_np, -1, -2), b_np[0].T)
+    assert dpt.all(r == dpt.asarray(expected, sycl_queue=q))
+
+    # non-unit strides and F-contiguous output
+    r = dpt.matmul(a[:, ::2, ::-1].mT, b[::-1, ::2, :34].mT, order="F")
+    expected = np.matmul(
+        np.swapaxes(a_np[:, ::2, ::-1], -1, -2),
+        np.swapaxes(b_np[::-1, ::2, :34], -1, -2),
+    )
+    assert dpt.all(r == dpt.asarray(expected, sycl_queue=q))
+
+
 @pytest.mark.parametrize("dtype", _numeric_types)
 def test_tensordot_outer(dtype):
     q = get_queue_or_skip()
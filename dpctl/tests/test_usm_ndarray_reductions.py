@@ -688,3 +688,232 @@ def test_count_nonzero(dt):
     res = dpt.count_nonzero(x)
     assert res == 7
     assert res.dtype == expected_dt
+
+
+@pytest.mark.parametrize("dt", ["i4", "f4", "c8"])
+def test_minmax(dt):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+
+    x_np = (np.arange(3 * 4 * 5001) % 113).astype(dt).reshape(3, 4, 5001)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    for axis in [None, 2, (0, 2), ()]:
+        mn, mx = dpt.minmax(x, axis=axis)
+        assert dpt.all(mn == dpt.min(x, axis=axis))
+        assert dpt.all(mx == dpt.max(x, axis=axis))
+
+    mn, mx = dpt.minmax(x.mT, axis=1, keepdims=True)
+    assert mn.shape == (3, 1, 4)
+    assert dpt.all(mx == dpt.max(x.mT, axis=1, keepdims=True))
+
+    with pytest.raises(ValueError):
+        dpt.minmax(dpt.empty((2, 0), dtype=dt, sycl_queue=q), axis=1)
+
+
+def test_minmax_nan():
+    get_queue_or_skip()
+
+    x = dpt.linspace(0, 1, num=100, dtype="f4")
+    x[37] = dpt.nan
+    mn, mx = dpt.minmax(x)
+    assert dpt.isnan(mn) and dpt.isnan(mx)
+
+
+@pytest.mark.parametrize("dt", ["i1", "u2", "i8", "f4", "f8", "c8"])
+def test_sum_and_sumsq(dt):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+
+    x = dpt.asarray(np.arange(2 * 30011) % 7, dtype=dt, sycl_queue=q)
+    x = dpt.reshape(x, (2, 30011))
+    for axis in [None, 0, 1]:
+        s, ss = dpt.sum_and_sumsq(x, axis=axis)
+        assert s.dtype == dpt.sum(x).dtype
+        assert ss.dtype == s.dtype
+        assert dpt.allclose(s, dpt.sum(x, axis=axis))
+        expected_ss = dpt.sum(dpt.astype(x, s.dtype) ** 2, axis=axis)
+        assert dpt.allclose(ss, expected_ss)
+
+    s, ss = dpt.sum_and_sumsq(x, axis=1, dtype="f4", keepdims=True)
+    assert s.dtype == dpt.float32 and s.shape == (2, 1)
+
+    s, ss = dpt.sum_and_sumsq(dpt.empty((3, 0), dtype=dt, sycl_queue=q))
+    assert s == 0 and ss == 0
+
+
+@pytest.mark.parametrize("dt", ["?", "i2", "u4", "f2", "f4", "c16"])
+def test_max_with_argmax(dt):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+
+    x_np = (np.arange(5 * 7011) % 31).astype(dt).reshape(5, 7011)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    for axis in [None, 0, 1]:
+        for arr in [x, x.mT, x[:, ::-2]]:
+            mx, idx = dpt.max_with_argmax(arr, axis=axis)
+            assert dpt.all(mx == dpt.max(arr, axis=axis))
+            assert dpt.all(idx == dpt.argmax(arr, axis=axis))
+            assert idx.dtype == default_device_index_type(q)
+
+    mx, idx = dpt.max_with_argmax(x, axis=1, keepdims=True)
+    assert mx.shape == (5, 1) and idx.shape == (5, 1)
+
+    with pytest.raises(TypeError):
+        dpt.max_with_argmax(x, axis=(0, 1))
+
+
+def test_max_with_argmax_nan():
+    get_queue_or_skip()
+
+    x = dpt.zeros(20000, dtype="f4")
+    x[12345] = dpt.nan
+    x[15000] = dpt.nan
+    mx, idx = dpt.max_with_argmax(x)
+    assert dpt.isnan(mx)
+    assert int(idx) == 12345
+
+
+def _segment_offsets(lengths):
+    return np.concatenate([[0], np.cumsum(lengths)]).astype(np.int64)
+
+
+@pytest.mark.parametrize("dt", ["i4", "u8", "f4", "f8", "c8"])
+@pytest.mark.parametrize("op", ["sum", "prod", "min", "max"])
+def test_segment_reduce(dt, op):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+    if op in ("min", "max") and dt == "c8":
+        pytest.skip("complex ordering is tested separately")
+
+    # short, empty and long segments
+    lengths = [3, 0, 1, 17, 700, 5, 0, 2000, 64, 65]
+    offsets_np = _segment_offsets(lengths)
+    x_np = (np.arange(offsets_np[-1]) % 5 + 1).astype(dt)
+    if op == "prod":
+        x_np = np.ones_like(x_np)
+        x_np[::97] = 2
+    x = dpt.asarray(x_np, sycl_queue=q)
+    offsets = dpt.asarray(offsets_np, sycl_queue=q)
+
+    res = dpt.segment_reduce(x, offsets, op)
+    assert res.shape == (len(lengths),)
+    if op in ("sum", "prod"):
+        assert res.dtype == getattr(dpt, op)(x).dtype
+    else:
+        assert res.dtype == x.dtype
+
+    res_np = dpt.asnumpy(res)
+    for i, (b, e) in enumerate(zip(offsets_np[:-1], offsets_np[1:])):
+        if b == e:
+            if op in ("sum", "prod"):
+                assert res_np[i] == (0 if op == "sum" else 1)
+            continue
+        seg = x_np[b:e]
+        expected = getattr(np, op)(seg.astype(res_np.dtype))
+        assert_allclose(res_np[i], expected, rtol=1e-5)
+
+
+@pytest.mark.parametrize("dt", ["?", "i2", "u4", "f2", "f4", "c16"])
+@pytest.mark.parametrize("op", ["argmin", "argmax"])
+def test_segment_reduce_search(dt, op):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dt, q)
+
+    lengths = [1, 7, 0, 300, 2, 1500, 33]
+    offsets_np = _segment_offsets(lengths)
+    x_np = (np.arange(offsets_np[-1]) % 13).astype(dt)
+    x = dpt.asarray(x_np, sycl_queue=q)
+    offsets = dpt.asarray(offsets_np, sycl_queue=q)
+
+    res = dpt.segment_reduce(x, offsets, op)
+    assert res.dtype == default_device_index_type(q)
+    res_np = dpt.asnumpy(res)
+    for i, (b, e) in enumerate(zip(offsets_np[:-1], offsets_np[1:])):
+        if b == e:
+            assert res_np[i] == -1
+        else:
+            assert res_np[i] == b + getattr(np, op)(x_np[b:e])
+
+    # strided input
+    x_r = x[::-1]
+    res = dpt.segment_reduce(x_r, offsets, op)
+    x_r_np = x_np[::-1]
+    res_np = dpt.asnumpy(res)
+    for i, (b, e) in enumerate(zip(offsets_np[:-1], offsets_np[1:])):
+        if b < e:
+            assert res_np[i] == b + getattr(np, op)(x_r_np[b:e])
+
+
+@pytest.mark.parametrize("op", ["sum", "min", "max", "argmin", "argmax"])
+def test_segment_reduce_long(op):
+    q = get_queue_or_skip()
+
+    # segments longer than a work-group's chunk of the input are split
+    # among work-groups, adjacent long segments share chunks
+    lengths = [5, 70001, 0, 3, 50000, 100003, 10]
+    offsets_np = _segment_offsets(lengths) + 7
+    n = offsets_np[-1] + 11
+    x_np = (np.arange(n) * 7919 % 1013).astype("i4")
+    x = dpt.asarray(x_np, sycl_queue=q)
+    offsets = dpt.asarray(offsets_np, sycl_queue=q)
+
+    res_np = dpt.asnumpy(dpt.segment_reduce(x, offsets, op))
+    for i, (b, e) in enumerate(zip(offsets_np[:-1], offsets_np[1:])):
+        if b == e:
+            continue
+        expected = getattr(np, op)(x_np[b:e])
+        if op in ("argmin", "argmax"):
+            expected += b
+        assert res_np[i] == expected
+
+
+def test_segment_reduce_nan():
+    get_queue_or_skip()
+
+    offsets = dpt.asarray([0, 10, 2010], dtype="i4")
+    x = dpt.zeros(2010, dtype="f4")
+    x[3] = dpt.nan
+    x[1500] = dpt.nan
+    x[1700] = dpt.nan
+    for op in ["argmin", "argmax"]:
+        res = dpt.asnumpy(dpt.segment_reduce(x, offsets, op))
+        assert res.tolist() == [3, 1500]
+    for op in ["min", "max"]:
+        res = dpt.segment_reduce(x, offsets, op)
+        assert dpt.all(dpt.isnan(res))
+
+
+def test_segment_reduce_logsumexp():
+    q = get_queue_or_skip()
+
+    lengths = [4, 0, 500]
+    offsets_np = _segment_offsets(lengths)
+    x_np = np.linspace(-3, 3, num=offsets_np[-1], dtype="f4")
+    x = dpt.asarray(x_np, sycl_queue=q)
+    offsets = dpt.asarray(offsets_np, sycl_queue=q)
+    res = dpt.asnumpy(dpt.segment_reduce(x, offsets, "logsumexp"))
+    assert res[1] == -np.inf
+    assert_allclose(res[0], np.logaddexp.reduce(x_np[:4]), rtol=1e-5)
+    assert_allclose(res[2], np.logaddexp.reduce(x_np[4:]), rtol=1e-5)
+
+
+def test_segment_reduce_validation():
+    q = get_queue_or_skip()
+
+    x = dpt.ones(10, sycl_queue=q)
+    offsets = dpt.asarray([0, 5, 10], sycl_queue=q)
+    with pytest.raises(ValueError):
+        dpt.segment_reduce(x, offsets, "mean")
+    with pytest.raises(ValueError):
+        dpt.segment_reduce(dpt.reshape(x, (2, 5)), offsets, "sum")
+    with pytest.raises(TypeError):
+        dpt.segment_reduce(x, dpt.astype(offsets, "f4"), "sum")
+    with pytest.raises(TypeError):
+        dpt.segment_reduce(x, np.asarray([0, 5, 10]), "sum")
+
+    r = dpt.segment_reduce(x, dpt.zeros(1, dtype="i8", sycl_queue=q), "max")
+    assert r.shape == (0,)
+
+    q2 = get_queue_or_skip()
+    with pytest.raises(ExecutionPlacementError):
+        dpt.segment_reduce(x, dpt.asarray(offsets, sycl_queue=q2), "sum")
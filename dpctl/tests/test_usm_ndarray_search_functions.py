@@ -315,6 +315,22 @@ def test_where_strided():
     assert_array_equal(dpt.asnumpy(res), expected)
 
 
+@pytest.mark.parametrize("nd", [3, 8, 9])
+def test_where_strided_nd(nd):
+    get_queue_or_skip()
+
+    # strides of sliced arrays do not collapse, so iteration space
+    # keeps `nd` dimensions, covering by-value and USM packed metadata
+    sl = (slice(None, None, 2),) * nd
+    cond = dpt.reshape(dpt.arange(3**nd, dtype="i4") % 3 == 0, (3,) * nd)[sl]
+    x1 = dpt.reshape(dpt.arange(3**nd, dtype="i4"), (3,) * nd)[sl]
+    x2 = dpt.zeros((2,) * nd, dtype="i4")
+
+    res = dpt.where(cond, x1, x2)
+    expected = np.where(dpt.asnumpy(cond), dpt.asnumpy(x1), dpt.asnumpy(x2))
+    assert_array_equal(dpt.asnumpy(res), expected)
+
+
 def test_where_invariants():
     get_queue_or_skip()
 
@@ -378,3 +378,24 @@ def test_radix_argsort_size_1_axis():
     x4 = dpt.reshape(dpt.arange(10, dtype="i1"), (1, 10))
     r4 = dpt.argsort(x4, axis=0, kind="radixsort")
     assert dpt.all(r4 == 0)
+
+
+@pytest.mark.parametrize("dtype", ["i2", "f4", "f8"])
+@pytest.mark.parametrize("shape", [(300, 3000), (2000, 70)])
+def test_radix_sort_many_rows(dtype, shape):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    rng = np.random.default_rng(1234)
+    x_np = rng.integers(-500, 500, size=shape).astype(dtype)
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    s = dpt.sort(x, kind="radixsort")
+    assert np.array_equal(dpt.asnumpy(s), np.sort(x_np, axis=-1))
+
+    s = dpt.sort(x, descending=True, kind="radixsort")
+    assert np.array_equal(dpt.asnumpy(s), np.sort(x_np, axis=-1)[:, ::-1])
+
+    ind = dpt.argsort(x, kind="radixsort")
+    expected = np.argsort(x_np, axis=-1, kind="stable")
+    assert np.array_equal(dpt.asnumpy(ind), expected)
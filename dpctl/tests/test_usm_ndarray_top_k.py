@@ -14,6 +14,7 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import numpy as np
 import pytest
 
 import dpctl.tensor as dpt
@@ -313,3 +314,32 @@ def test_top_k_validation():
     with pytest.raises(ValueError):
         # mode must be "largest", or "smallest"
         dpt.top_k(x, 2, mode="invalid")
+
+
+@pytest.mark.parametrize("dtype", ["i2", "u4", "i8", "f2", "f4", "f8"])
+@pytest.mark.parametrize("mode", ["largest", "smallest"])
+def test_top_k_batched_long_rows(dtype, mode):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    rng = np.random.default_rng(42)
+    x_np = rng.integers(0, 3000, size=(5, 20011)).astype(dtype)
+    x = dpt.asarray(x_np, sycl_queue=q)
+
+    k = 17
+    s = dpt.top_k(x, k, axis=-1, mode=mode)
+
+    key_np = -x_np.astype("f8") if mode == "largest" else x_np
+    expected_inds = np.argsort(key_np, axis=-1, kind="stable")[:, :k]
+    expected_vals = np.take_along_axis(x_np, expected_inds, axis=-1)
+    assert np.array_equal(dpt.asnumpy(s.indices), expected_inds)
+    assert np.array_equal(dpt.asnumpy(s.values), expected_vals)
+
+
+def test_top_k_zero_k_long_rows():
+    q = get_queue_or_skip()
+
+    x = dpt.ones((3, 8192), dtype="i4", sycl_queue=q)
+    s = dpt.top_k(x, 0, axis=-1)
+    assert s.values.shape == (3, 0)
+    assert s.indices.shape == (3, 0)
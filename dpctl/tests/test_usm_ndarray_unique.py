@@ -343,3 +343,27 @@ def test_gh_1738():
     assert dt == ind_dt
     dt = dpt.unique_all(iota).inverse_indices.dtype
     assert dt == ind_dt
+
+
+@pytest.mark.parametrize("dtype", ["i4", "u8", "f4", "f8"])
+def test_unique_many_runs(dtype):
+    q = get_queue_or_skip()
+    skip_if_dtype_not_supported(dtype, q)
+
+    n, m = 5003, 97
+    inp = dpt.remainder(dpt.arange(n, dtype="i8", sycl_queue=q) * 31, m)
+    inp = dpt.astype(inp, dtype)
+    expected_vals = dpt.arange(m, dtype=dtype, sycl_queue=q)
+
+    uv = dpt.unique_values(inp)
+    assert uv.shape == expected_vals.shape
+    assert dpt.all(uv == expected_vals)
+
+    uv, uc = dpt.unique_counts(inp)
+    assert dpt.all(uv == expected_vals)
+    assert int(dpt.sum(uc)) == n
+    assert int(dpt.max(uc)) - int(dpt.min(uc)) <= 1
+
+    uv, inv = dpt.unique_inverse(inp[::-1])
+    assert dpt.all(uv == expected_vals)
+    assert dpt.all(inp[::-1] == uv[inv])
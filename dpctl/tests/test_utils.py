@@ -183,3 +183,31 @@ def test_order_manager():
         _passed = True
     finally:
         assert _passed
+
+
+def test_order_manager_keep_alive_batching():
+    try:
+        q = dpctl.SyclQueue()
+    except dpctl.SyclQueueCreationError:
+        pytest.skip("Queue could not created for default-selected device")
+    import dpctl.tensor as dpt
+    _mngr = dpctl.utils.SequentialOrderManager[q]
+    assert _mngr.num_keep_alive_batched == 0
+
+    x = dpt.ones(64, dtype="i4", sycl_queue=q)
+    with _mngr.keep_alive_batching(max_size=4):
+        for _ in range(10):
+            x = dpt.add(x[::-1], 1)
+        assert _mngr.num_keep_alive_batched < 4
+        with _mngr.keep_alive_batching():
+            x = dpt.add(x[::-1], 1)
+        _mngr.flush_keep_alive()
+        assert _mngr.num_keep_alive_batched == 0
+        x = dpt.add(x[::-1], 1)
+    assert _mngr.num_keep_alive_batched == 0
+    _mngr.wait()
+    assert dpt.all(x == 13)
+
+    with pytest.raises(ValueError):
+        with _mngr.keep_alive_batching(max_size=0):
+            pass
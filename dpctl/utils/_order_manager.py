@@ -1,10 +1,70 @@
 import weakref
 from collections import defaultdict
+from contextlib import contextmanager
 from contextvars import ContextVar
 
 from .._sycl_event import SyclEvent
 from .._sycl_queue import SyclQueue
-from ._seq_order_keeper import _OrderManager
+from ._seq_order_keeper import (
+    _keep_alive_batch_begin,
+    _keep_alive_batch_end,
+    _keep_alive_batch_flush,
+    _keep_alive_batch_size,
+    _OrderManager,
+)
+
+
+class _RecordedOrder:
+    """
+    Order state used while tasks offloaded to a queue are recorded into
+    a command graph.
+
+    Events of recorded commands can not be queried or waited on, so they
+    are never pruned. Only events of the latest task are kept, since each
+    task depends on all events submitted before it, and hence on all
+    commands recorded earlier.
+    """
+
+    def __init__(self):
+        self._host_task_events = []
+        self._submitted_events = []
+
+    def get_num_submitted_events(self):
+        return len(self._submitted_events)
+
+    def get_num_host_task_events(self):
+        return len(self._host_task_events)
+
+    def get_submitted_events(self):
+        return list(self._submitted_events)
+
+    def get_host_task_events(self):
+        return list(self._host_task_events)
+
+    def add_to_both_events(self, host_task_ev, comp_ev):
+        self._host_task_events = [host_task_ev]
+        self._submitted_events = [comp_ev]
+
+    def add_vector_to_both_events(self, host_task_evs, comp_evs):
+        self._host_task_events = list(host_task_evs)
+        self._submitted_events = list(comp_evs)
+
+    def add_to_host_task_events(self, host_task_ev):
+        self._host_task_events = [host_task_ev]
+
+    def add_to_submitted_events(self, comp_ev):
+        self._submitted_events = [comp_ev]
+
+    def wait(self):
+        raise RuntimeError(
+            "Tasks being recorded into a command graph can not be waited on"
+        )
+
+    def __copy__(self):
+        res = _RecordedOrder()
+        res._host_task_events = list(self._host_task_events)
+        res._submitted_events = list(self._submitted_events)
+        return res
 
 
 class _SequentialOrderManager:
@@ -13,8 +73,12 @@ class _SequentialOrderManager:
     of the tasks offloaded from Python.
     """
 
-    def __init__(self):
+    def __init__(self, queue=None):
         self._state = _OrderManager(16)
+        self._queue = queue
+        # number of calls to `add_event_pair`, used to detect offloaded
+        # tasks, e.g. by dpctl.graph.capture
+        self._num_event_pairs = 0
 
     def __dealloc__(self):
         _local = self._state
@@ -22,6 +86,7 @@ class _SequentialOrderManager:
         SyclEvent.wait_for(_local.get_host_task_events())
 
     def add_event_pair(self, host_task_ev, comp_ev):
+        self._num_event_pairs += 1
         _local = self._state
         if isinstance(host_task_ev, SyclEvent) and isinstance(
             comp_ev, SyclEvent
@@ -54,13 +119,84 @@ class _SequentialOrderManager:
         _local = self._state
         return _local.get_submitted_events()
 
+    @contextmanager
+    def keep_alive_batching(self, max_size=64):
+        """
+        Context manager batching keep-alive host tasks of offloaded
+        operations.
+
+        While active, Python objects and USM allocations that must outlive
+        offloaded tasks are collected, and released by a single host task
+        per ``max_size`` operations, or on the host once all tasks
+        collected so far have completed. Remaining objects are released
+        when the context exits, or when :meth:`flush_keep_alive` or
+        :meth:`wait` is called.
+        """
+        q = self._queue
+        if q is None:
+            raise ValueError(
+                "Keep-alive batching requires order manager associated "
+                "with a queue"
+            )
+        max_size = int(max_size)
+        if max_size < 1:
+            raise ValueError(f"Expected positive batch size, got {max_size}")
+        _keep_alive_batch_begin(q, max_size)
+        try:
+            yield self
+        finally:
+            ht_ev = _keep_alive_batch_end(q)
+            self._state.add_to_host_task_events(ht_ev)
+
+    def flush_keep_alive(self):
+        """Release objects collected by active keep-alive batch once
+        their tasks complete"""
+        q = self._queue
+        if q is not None:
+            ht_ev = _keep_alive_batch_flush(q)
+            self._state.add_to_host_task_events(ht_ev)
+
+    @property
+    def num_keep_alive_batched(self):
+        """Number of operations in active keep-alive batch"""
+        q = self._queue
+        if q is None:
+            return 0
+        return _keep_alive_batch_size(q)
+
     def wait(self):
+        self.flush_keep_alive()
         _local = self._state
         return _local.wait()
 
+    @property
+    def is_recording(self):
+        """True while tasks are recorded into a command graph"""
+        return isinstance(self._state, _RecordedOrder)
+
+    @contextmanager
+    def _recording(self):
+        """
+        Context manager tracking events of tasks recorded into a command
+        graph separately from events of tasks submitted for execution.
+        """
+        if self.is_recording:
+            raise RuntimeError("Tasks are already being recorded")
+        saved_state = self._state
+        self._state = _RecordedOrder()
+        try:
+            yield self
+        finally:
+            self._state = saved_state
+
     def __copy__(self):
         res = _SequentialOrderManager.__new__(_SequentialOrderManager)
-        res._state = _OrderManager(self._state)
+        if self.is_recording:
+            res._state = self._state.__copy__()
+        else:
+            res._state = _OrderManager(self._state)
+        res._queue = self._queue
+        res._num_event_pairs = self._num_event_pairs
         return res
 
 
@@ -82,7 +218,7 @@ class SyclQueueToOrderManagerMap:
         if q in _local:
             return _local[q]
         else:
-            v = _local[q]
+            v = _SequentialOrderManager(q)
             _local[q] = v
             return v
 
@@ -40,4 +40,43 @@ PYBIND11_MODULE(_seq_order_keeper, m)
     };
     m.def("_submit_empty_task", submit_empty_task_fn, py::arg("sycl_queue"),
           py::arg("depends") = py::list());
+
+    using dpctl::utils::detail::KeepAliveBatchRegistry;
+
+    // registry is shared with other extensions via capsule, and is
+    // intentionally leaked, since batches may hold USM allocations
+    static KeepAliveBatchRegistry *keep_alive_registry =
+        new KeepAliveBatchRegistry{};
+    m.attr("_keep_alive_batch_registry") = py::capsule(
+        static_cast<void *>(keep_alive_registry),
+        KeepAliveBatchRegistry::capsule_name);
+
+    auto keep_alive_batch_begin_fn = [](const sycl::queue &exec_q,
+                                        std::size_t max_size) {
+        keep_alive_registry->begin(exec_q, max_size);
+    };
+    m.def("_keep_alive_batch_begin", keep_alive_batch_begin_fn,
+          py::arg("sycl_queue"), py::arg("max_size"));
+
+    auto keep_alive_batch_end_fn =
+        [](const sycl::queue &exec_q) -> sycl::event {
+        return keep_alive_registry->end(exec_q);
+    };
+    m.def("_keep_alive_batch_end", keep_alive_batch_end_fn,
+          py::arg("sycl_queue"));
+
+    auto keep_alive_batch_flush_fn =
+        [](const sycl::queue &exec_q) -> sycl::event {
+        return keep_alive_registry->flush(exec_q);
+    };
+    m.def("_keep_alive_batch_flush", keep_alive_batch_flush_fn,
+          py::arg("sycl_queue"));
+
+    auto keep_alive_batch_size_fn =
+        [](const sycl::queue &exec_q) -> std::size_t {
+        const auto *batch = keep_alive_registry->get(exec_q);
+        return (batch) ? batch->size() : 0;
+    };
+    m.def("_keep_alive_batch_size", keep_alive_batch_size_fn,
+          py::arg("sycl_queue"));
 }
@@ -0,0 +1,172 @@
+//===-- dpctl_program_cache.hpp - Cache of compiled program binaries ------===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file declares a cache of device-specific binaries of programs
+/// created from OpenCL source or SPIR-V, kept in memory and on disk.
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace dpctl
+{
+namespace helper
+{
+
+/*!
+ * @brief Process-wide cache of compiled program binaries.
+ *
+ * Binaries are looked up by a key describing the program input, the build
+ * options and the device. Recently used binaries are kept in memory, up to
+ * a limit on their total size. If a cache directory is set, binaries are
+ * also persisted there, one file per key, and the least recently used files
+ * are removed once their total size exceeds the disk limit.
+ *
+ * The cache is best effort: failures to read or write files are ignored.
+ */
+class ProgramBinaryCache
+{
+public:
+    /*! @brief Counters of cache lookups since the process started. */
+    struct Stats
+    {
+        //! Lookups served from memory
+        std::size_t memory_hits = 0;
+        //! Lookups served from the cache directory
+        std::size_t disk_hits = 0;
+        //! Lookups which found no binary
+        std::size_t misses = 0;
+        //! Binaries found by lookups but rejected by the driver
+        std::size_t rejected = 0;
+    };
+
+    static constexpr std::size_t default_memory_limit = 64 * 1024 * 1024;
+    static constexpr std::size_t default_disk_limit = 1024 * 1024 * 1024;
+
+    ProgramBinaryCache(const ProgramBinaryCache &) = delete;
+    ProgramBinaryCache &operator=(const ProgramBinaryCache &) = delete;
+
+    /*!
+     * @brief Returns the process-wide cache.
+     *
+     * The cache directory is initialized from the environment variable
+     * ``DPCTL_PROGRAM_CACHE_DIR``, persistent caching is disabled if the
+     * variable is not set or is empty.
+     */
+    static ProgramBinaryCache &get();
+
+    /*!
+     * @brief Builds the cache key of a program.
+     *
+     * @param    Kind           Kind of the program input, e.g. "spirv".
+     * @param    Data           Pointer to the program input.
+     * @param    Length         Size of the program input in bytes.
+     * @param    CompileOpts    Build options, may be NULL.
+     * @param    DeviceId       String identifying device and its driver.
+     * @return   The key string.
+     */
+    static std::string make_key(const char *Kind,
+                                const void *Data,
+                                std::size_t Length,
+                                const char *CompileOpts,
+                                const std::string &DeviceId);
+
+    /*!
+     * @brief Looks up binary stored for key `Key`, first in memory, then
+     * on disk.
+     *
+     * @return   True if the binary was found and copied into `Binary`.
+     */
+    bool lookup(const std::string &Key, std::vector<unsigned char> &Binary);
+
+    /*!
+     * @brief Records that the binary found for key `Key` was rejected by the
+     * driver, and removes it from memory.
+     */
+    void reject(const std::string &Key);
+
+    /*! @brief Stores binary `Binary` for key `Key`. */
+    void store(const std::string &Key,
+               const std::vector<unsigned char> &Binary);
+
+    /*!
+     * @brief Sets the directory of the persistent cache, an empty path
+     * disables persistent caching.
+     */
+    void set_directory(const std::string &Dir);
+    std::string get_directory();
+
+    /*!
+     * @brief Sets limits on total size of binaries kept in memory and on
+     * disk, in bytes. Entries in excess are evicted immediately.
+     */
+    void set_limits(std::size_t MemoryLimit, std::size_t DiskLimit);
+    std::size_t get_memory_limit();
+    std::size_t get_disk_limit();
+
+    /*!
+     * @brief Removes all binaries kept in memory, and if `ClearDisk` is
+     * true, all binaries persisted in the cache directory.
+     */
+    void clear(bool ClearDisk);
+
+    /*! @brief Returns counters of lookups. */
+    Stats get_stats();
+
+private:
+    using EntryT = std::pair<std::string, std::vector<unsigned char>>;
+
+    std::mutex mu_{};
+    std::string dir_{};
+    std::size_t memory_limit_ = default_memory_limit;
+    std::size_t disk_limit_ = default_disk_limit;
+    std::size_t memory_size_ = 0;
+    Stats stats_{};
+    // most recently used entries are at the front of the list
+    std::list<EntryT> lru_{};
+    std::unordered_map<std::string, std::list<EntryT>::iterator> index_{};
+
+    ProgramBinaryCache();
+
+    void insert_in_memory(const std::string &Key,
+                          std::vector<unsigned char> Binary);
+    void evict_in_memory();
+    static std::string file_path(const std::string &Dir,
+                                 const std::string &Key);
+    static bool load_from_disk(const std::string &Dir,
+                               const std::string &Key,
+                               std::vector<unsigned char> &Binary);
+    static void store_on_disk(const std::string &Dir,
+                              const std::string &Key,
+                              const std::vector<unsigned char> &Binary);
+    static void evict_on_disk(const std::string &Dir, std::size_t DiskLimit);
+};
+
+} // namespace helper
+} // namespace dpctl
@@ -0,0 +1,396 @@
+//===- dpctl_program_cache.cpp - Cache of compiled program binaries -------===//
+//
+//                      Data Parallel Control (dpctl)
+//
+// Copyright 2020-2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//===----------------------------------------------------------------------===//
+///
+/// \file
+/// This file implements the cache of program binaries declared in
+/// dpctl_program_cache.hpp.
+///
+//===----------------------------------------------------------------------===//
+
+#include "dpctl_program_cache.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <system_error>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+
+static constexpr char file_magic[] = "DPCTLPB1";
+static constexpr char file_suffix[] = ".bin";
+
+/*!
+ * @brief 64-bit FNV-1a hash of `Length` bytes at `Data`, starting from
+ * offset basis `Seed`.
+ */
+std::uint64_t
+fnv1a_hash(const void *Data, std::size_t Length, std::uint64_t Seed)
+{
+    static constexpr std::uint64_t fnv_prime = 0x100000001b3ULL;
+
+    const unsigned char *bytes = static_cast<const unsigned char *>(Data);
+    std::uint64_t h = Seed;
+    for (std::size_t i = 0; i < Length; ++i) {
+        h ^= bytes[i];
+        h *= fnv_prime;
+    }
+    return h;
+}
+
+/*! @brief 128-bit digest of the bytes as a hexadecimal string. */
+std::string hex_digest(const void *Data, std::size_t Length)
+{
+    static constexpr std::uint64_t seed0 = 0xcbf29ce484222325ULL;
+    static constexpr std::uint64_t seed1 = 0x84222325cbf29ce4ULL;
+
+    std::ostringstream os;
+    os << std::hex << std::setfill('0') << std::setw(16)
+       << fnv1a_hash(Data, Length, seed0) << std::setw(16)
+       << fnv1a_hash(Data, Length, seed1);
+    return os.str();
+}
+
+} // end of anonymous namespace
+
+namespace dpctl
+{
+namespace helper
+{
+
+ProgramBinaryCache::ProgramBinaryCache()
+{
+    if (const char *dir = std::getenv("DPCTL_PROGRAM_CACHE_DIR")) {
+        dir_ = std::string(dir);
+    }
+}
+
+ProgramBinaryCache &ProgramBinaryCache::get()
+{
+    // intentionally never destroyed, the cache may be used by static
+    // destructors of other objects
+    static ProgramBinaryCache *cache = new ProgramBinaryCache{};
+    return *cache;
+}
+
+std::string ProgramBinaryCache::make_key(const char *Kind,
+                                         const void *Data,
+                                         std::size_t Length,
+                                         const char *CompileOpts,
+                                         const std::string &DeviceId)
+{
+    std::ostringstream os;
+    os << Kind << ";" << DeviceId << ";"
+       << ((CompileOpts) ? CompileOpts : "") << ";" << Length << ";"
+       << hex_digest(Data, Length);
+    return os.str();
+}
+
+bool ProgramBinaryCache::lookup(const std::string &Key,
+                                std::vector<unsigned char> &Binary)
+{
+    std::string dir;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        const auto &pos = index_.find(Key);
+        if (pos != index_.end()) {
+            lru_.splice(lru_.begin(), lru_, pos->second);
+            Binary = pos->second->second;
+            ++stats_.memory_hits;
+            return true;
+        }
+        dir = dir_;
+    }
+
+    if (dir.empty() || !load_from_disk(dir, Key, Binary)) {
+        std::lock_guard<std::mutex> lock(mu_);
+        ++stats_.misses;
+        return false;
+    }
+    // mark the file as recently used for eviction purposes
+    std::error_code ec;
+    fs::last_write_time(file_path(dir, Key), fs::file_time_type::clock::now(),
+                        ec);
+
+    std::lock_guard<std::mutex> lock(mu_);
+    ++stats_.disk_hits;
+    insert_in_memory(Key, Binary);
+    return true;
+}
+
+void ProgramBinaryCache::reject(const std::string &Key)
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    ++stats_.rejected;
+    const auto &pos = index_.find(Key);
+    if (pos != index_.end()) {
+        memory_size_ -= pos->second->second.size();
+        lru_.erase(pos->second);
+        index_.erase(pos);
+    }
+}
+
+void ProgramBinaryCache::store(const std::string &Key,
+                               const std::vector<unsigned char> &Binary)
+{
+    if (Binary.empty()) {
+        return;
+    }
+    std::string dir;
+    std::size_t disk_limit = 0;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        insert_in_memory(Key, Binary);
+        dir = dir_;
+        disk_limit = disk_limit_;
+    }
+    if (!dir.empty()) {
+        store_on_disk(dir, Key, Binary);
+        evict_on_disk(dir, disk_limit);
+    }
+}
+
+void ProgramBinaryCache::set_directory(const std::string &Dir)
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    dir_ = Dir;
+}
+
+std::string ProgramBinaryCache::get_directory()
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    return dir_;
+}
+
+void ProgramBinaryCache::set_limits(std::size_t MemoryLimit,
+                                    std::size_t DiskLimit)
+{
+    std::string dir;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        memory_limit_ = MemoryLimit;
+        disk_limit_ = DiskLimit;
+        evict_in_memory();
+        dir = dir_;
+    }
+    if (!dir.empty()) {
+        evict_on_disk(dir, DiskLimit);
+    }
+}
+
+std::size_t ProgramBinaryCache::get_memory_limit()
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    return memory_limit_;
+}
+
+std::size_t ProgramBinaryCache::get_disk_limit()
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    return disk_limit_;
+}
+
+void ProgramBinaryCache::clear(bool ClearDisk)
+{
+    std::string dir;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        lru_.clear();
+        index_.clear();
+        memory_size_ = 0;
+        dir = dir_;
+    }
+    if (!ClearDisk || dir.empty()) {
+        return;
+    }
+
+    std::error_code ec;
+    for (const auto &entry : fs::directory_iterator(dir, ec)) {
+        const fs::path &p = entry.path();
+        if (entry.is_regular_file(ec) && p.extension() == file_suffix) {
+            fs::remove(p, ec);
+        }
+    }
+}
+
+ProgramBinaryCache::Stats ProgramBinaryCache::get_stats()
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    return stats_;
+}
+
+void ProgramBinaryCache::insert_in_memory(const std::string &Key,
+                                          std::vector<unsigned char> Binary)
+{
+    const auto &pos = index_.find(Key);
+    if (pos != index_.end()) {
+        memory_size_ -= pos->second->second.size();
+        lru_.erase(pos->second);
+        index_.erase(pos);
+    }
+    memory_size_ += Binary.size();
+    lru_.emplace_front(Key, std::move(Binary));
+    index_.emplace(Key, lru_.begin());
+    evict_in_memory();
+}
+
+void ProgramBinaryCache::evict_in_memory()
+{
+    while (memory_size_ > memory_limit_ && !lru_.empty()) {
+        const EntryT &victim = lru_.back();
+        memory_size_ -= victim.second.size();
+        index_.erase(victim.first);
+        lru_.pop_back();
+    }
+}
+
+std::string ProgramBinaryCache::file_path(const std::string &Dir,
+                                          const std::string &Key)
+{
+    const fs::path p = fs::path(Dir) / (hex_digest(Key.data(), Key.size()) +
+                                        std::string(file_suffix));
+    return p.string();
+}
+
+bool ProgramBinaryCache::load_from_disk(const std::string &Dir,
+                                        const std::string &Key,
+                                        std::vector<unsigned char> &Binary)
+{
+    std::ifstream in(file_path(Dir, Key), std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    std::string magic;
+    std::size_t key_len = 0;
+    std::size_t bin_len = 0;
+    if (!(in >> magic >> key_len >> bin_len) || magic != file_magic ||
+        key_len != Key.size() || bin_len == 0 || in.get() != '\n')
+    {
+        return false;
+    }
+
+    // file names are digests of keys, verify the key to rule out collisions
+    std::string stored_key(key_len, '\0');
+    if (!in.read(&stored_key[0], key_len) || stored_key != Key) {
+        return false;
+    }
+
+    std::vector<unsigned char> data(bin_len);
+    if (!in.read(reinterpret_cast<char *>(data.data()), bin_len)) {
+        return false;
+    }
+    Binary = std::move(data);
+    return true;
+}
+
+void ProgramBinaryCache::store_on_disk(
+    const std::string &Dir,
+    const std::string &Key,
+    const std::vector<unsigned char> &Binary)
+{
+    std::error_code ec;
+    fs::create_directories(Dir, ec);
+
+    const std::string &path = file_path(Dir, Key);
+    // temporary name unique to the writing thread
+    std::ostringstream tmp_suffix;
+    tmp_suffix << ".tmp" << std::hex
+               << std::hash<std::thread::id>{}(std::this_thread::get_id())
+               << std::chrono::steady_clock::now().time_since_epoch().count();
+    const std::string &tmp_path = path + tmp_suffix.str();
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return;
+        }
+        out << file_magic << " " << Key.size() << " " << Binary.size()
+            << "\n";
+        out.write(Key.data(), Key.size());
+        out.write(reinterpret_cast<const char *>(Binary.data()),
+                  Binary.size());
+        if (!out) {
+            out.close();
+            fs::remove(tmp_path, ec);
+            return;
+        }
+    }
+    // readers never observe partially written files
+    fs::rename(tmp_path, path, ec);
+    if (ec) {
+        fs::remove(tmp_path, ec);
+    }
+}
+
+void ProgramBinaryCache::evict_on_disk(const std::string &Dir,
+                                       std::size_t DiskLimit)
+{
+    struct FileInfo
+    {
+        fs::path path;
+        fs::file_time_type mtime;
+        std::uintmax_t size;
+    };
+
+    std::error_code ec;
+    std::vector<FileInfo> files;
+    std::uintmax_t total_size = 0;
+    for (const auto &entry : fs::directory_iterator(Dir, ec)) {
+        const fs::path &p = entry.path();
+        if (!entry.is_regular_file(ec) || p.extension() != file_suffix) {
+            continue;
+        }
+        const std::uintmax_t size = entry.file_size(ec);
+        if (ec) {
+            continue;
+        }
+        const fs::file_time_type mtime = entry.last_write_time(ec);
+        if (ec) {
+            continue;
+        }
+        files.push_back(FileInfo{p, mtime, size});
+        total_size += size;
+    }
+    if (total_size <= DiskLimit) {
+        return;
+    }
+
+    std::sort(files.begin(), files.end(),
+              [](const FileInfo &a, const FileInfo &b) {
+                  return a.mtime < b.mtime;
+              });
+    for (const auto &f : files) {
+        if (total_size <= DiskLimit) {
+            break;
+        }
+        if (fs::remove(f.path, ec)) {
+            total_size -= f.size;
+        }
+    }
+}
+
+} // namespace helper
+} // namespace dpctl
@@ -129,4 +129,111 @@ DPCTL_API
 __dpctl_give DPCTLSyclKernelBundleRef
 DPCTLKernelBundle_Copy(__dpctl_keep const DPCTLSyclKernelBundleRef KBRef);
 
+
+/*!
+ * @brief Sets the directory where binaries of programs created with
+ * DPCTLKernelBundle_CreateFromSpirv and
+ * DPCTLKernelBundle_CreateFromOCLSource are persisted.
+ *
+ * Binaries are keyed by a hash of the program source or SPIR-V, the build
+ * options, the device and its driver version, and are reused instead of
+ * recompiling the program. The initial directory is read from the
+ * environment variable ``DPCTL_PROGRAM_CACHE_DIR``.
+ *
+ * @param    Dir            Path to the cache directory. NULL or an empty
+ *                          string disables persistent caching, binaries are
+ *                          then only cached in memory.
+ * @ingroup KernelBundleInterface
+ */
+DPCTL_API
+void DPCTLKernelBundle_SetProgramCacheDir(__dpctl_keep const char *Dir);
+
+/*!
+ * @brief Returns the directory of the persistent program binary cache.
+ *
+ * @return   A C string with the path, empty if persistent caching is
+ * disabled. The string must be freed with DPCTLCString_Delete.
+ * @ingroup KernelBundleInterface
+ */
+DPCTL_API
+__dpctl_give const char *DPCTLKernelBundle_GetProgramCacheDir(void);
+
+/*!
+ * @brief Sets limits on total size of program binaries cached in memory
+ * and in the cache directory. Least recently used binaries in excess of
+ * the limits are evicted.
+ *
+ * @param    MemoryLimit    Limit for binaries kept in memory in bytes.
+ * @param    DiskLimit      Limit for binaries kept on disk in bytes.
+ * @ingroup KernelBundleInterface
+ */
+DPCTL_API
+void DPCTLKernelBundle_SetProgramCacheLimits(size_t MemoryLimit,
+                                             size_t DiskLimit);
+
+/*!
+ * @brief Returns the limit on total size of program binaries cached in
+ * memory, in bytes.
+ *
+ * @ingroup KernelBundleInterface
+ */
+DPCTL_API
+size_t DPCTLKernelBundle_GetProgramCacheMemoryLimit(void);
+
+/*!
+ * @brief Returns the limit on total size of program binaries cached in the
+ * cache directory, in bytes.
+ *
+ * @ingroup KernelBundleInterface
+ */
+DPCTL_API
+size_t DPCTLKernelBundle_GetProgramCacheDiskLimit(void);
+
+/*!
+ * @brief Removes program binaries cached in memory, and optionally the
+ * binaries persisted in the cache directory.
+ *
+ * @param    ClearDisk      If true, also remove the persisted binaries.
+ * @ingroup KernelBundleInterface
+ */
+DPCTL_API
+void DPCTLKernelBundle_ClearProgramCache(bool ClearDisk);
+
+/*!
+ * @brief Returns the number of program binary cache lookups served from
+ * memory since the process started.
+ *
+ * @ingroup KernelBundleInterface
+ */
+DPCTL_API
+size_t DPCTLKernelBundle_GetProgramCacheMemoryHits(void);
+
+/*!
+ * @brief Returns the number of program binary cache lookups served from the
+ * cache directory since the process started.
+ *
+ * @ingroup KernelBundleInterface
+ */
+DPCTL_API
+size_t DPCTLKernelBundle_GetProgramCacheDiskHits(void);
+
+/*!
+ * @brief Returns the number of program binary cache lookups which found no
+ * binary since the process started.
+ *
+ * @ingroup KernelBundleInterface
+ */
+DPCTL_API
+size_t DPCTLKernelBundle_GetProgramCacheMisses(void);
+
+/*!
+ * @brief Returns the number of cached program binaries rejected by the
+ * driver since the process started. Such programs are built from their
+ * source instead.
+ *
+ * @ingroup KernelBundleInterface
+ */
+DPCTL_API
+size_t DPCTLKernelBundle_GetProgramCacheRejected(void);
+
 DPCTL_C_EXTERN_C_END
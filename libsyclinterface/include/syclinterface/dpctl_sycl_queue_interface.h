@@ -276,6 +276,100 @@ DPCTLQueue_SubmitNDRange(__dpctl_keep const DPCTLSyclKernelRef KRef,
                          __dpctl_keep const DPCTLSyclEventRef *DepEvents,
                          size_t NDepEvents);
 
+/*!
+ * @brief Prepares a launch of a kernel with the given arguments and range,
+ * to be submitted repeatedly with DPCTLKernelLaunch_Submit.
+ *
+ * Arguments are validated and copied once: scalar arguments and local
+ * accessor descriptors are copied by value, USM pointers and references to
+ * work-group memory and raw kernel arguments are stored as is, and must
+ * remain valid while the launch is submitted.
+ *
+ * @param    KRef           Opaque pointer to a ``sycl::kernel``.
+ * @param    Args           An array of void* pointers that represent the
+ *                          kernel arguments for the kernel.
+ * @param    ArgTypes       An array of DPCTLKernelArgType enum values that
+ *                          represent the type of each kernel argument.
+ * @param    NArgs          Size of Args.
+ * @param    gRange         Global range of the launch.
+ * @param    lRange         Local range of the launch, or NULL to submit the
+ *                          kernel over ``sycl::range`` instead of
+ *                          ``sycl::nd_range``.
+ * @param    NDims          The number of dimensions of the ranges.
+ * @return   An opaque pointer to the prepared launch, or NULL if an argument
+ *           or the range is invalid.
+ * @ingroup QueueInterface
+ */
+DPCTL_API
+__dpctl_give DPCTLSyclKernelLaunchRef
+DPCTLKernelLaunch_Create(__dpctl_keep const DPCTLSyclKernelRef KRef,
+                         __dpctl_keep void **Args,
+                         __dpctl_keep const DPCTLKernelArgType *ArgTypes,
+                         size_t NArgs,
+                         __dpctl_keep const size_t gRange[3],
+                         __dpctl_keep const size_t lRange[3],
+                         size_t NDims);
+
+/*!
+ * @brief Replaces an argument of a prepared launch.
+ *
+ * The type of the new argument must be the type the argument was prepared
+ * with. Submissions made before the call are not affected.
+ *
+ * @param    LRef           Opaque pointer to a prepared kernel launch.
+ * @param    Idx            Position of the argument.
+ * @param    Arg            Pointer to the new argument value, or the USM
+ *                          pointer itself for DPCTL_VOID_PTR arguments.
+ * @param    ArgTy          Type of the argument.
+ * @return   True if the argument was replaced, false otherwise.
+ * @ingroup QueueInterface
+ */
+DPCTL_API
+bool DPCTLKernelLaunch_SetArg(__dpctl_keep DPCTLSyclKernelLaunchRef LRef,
+                              size_t Idx,
+                              __dpctl_keep void *Arg,
+                              DPCTLKernelArgType ArgTy);
+
+/*!
+ * @brief Returns the number of arguments of a prepared launch.
+ *
+ * @param    LRef           Opaque pointer to a prepared kernel launch.
+ * @return   The number of kernel arguments.
+ * @ingroup QueueInterface
+ */
+DPCTL_API
+size_t
+DPCTLKernelLaunch_GetNumArgs(__dpctl_keep const DPCTLSyclKernelLaunchRef LRef);
+
+/*!
+ * @brief Submits a prepared kernel launch to the queue.
+ *
+ * @param    LRef           Opaque pointer to a prepared kernel launch.
+ * @param    QRef           Opaque pointer to the sycl::queue where the kernel
+ *                          will be enqueued.
+ * @param    DepEvents      List of dependent DPCTLSyclEventRef objects (events)
+ *                          for the kernel.
+ * @param    NDepEvents     Size of the DepEvents list.
+ * @return   An opaque pointer to the ``sycl::event`` returned by the
+ *           ``sycl::queue.submit()`` function.
+ * @ingroup QueueInterface
+ */
+DPCTL_API
+__dpctl_give DPCTLSyclEventRef
+DPCTLKernelLaunch_Submit(__dpctl_keep const DPCTLSyclKernelLaunchRef LRef,
+                         __dpctl_keep const DPCTLSyclQueueRef QRef,
+                         __dpctl_keep const DPCTLSyclEventRef *DepEvents,
+                         size_t NDepEvents);
+
+/*!
+ * @brief Frees a prepared kernel launch.
+ *
+ * @param    LRef           Opaque pointer to a prepared kernel launch.
+ * @ingroup QueueInterface
+ */
+DPCTL_API
+void DPCTLKernelLaunch_Delete(__dpctl_take DPCTLSyclKernelLaunchRef LRef);
+
 /*!
  * @brief Calls the ``sycl::queue::submit`` function to do a blocking wait on
  * all enqueued tasks in the queue.
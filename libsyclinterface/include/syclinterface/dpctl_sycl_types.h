@@ -66,6 +66,13 @@ typedef struct DPCTLOpaqueSyclKernel *DPCTLSyclKernelRef;
  */
 typedef struct DPCTLOpaqueSyclKernelBundle *DPCTLSyclKernelBundleRef;
 
+/*!
+ * @brief Opaque pointer to a prepared launch of a ``sycl::kernel``, which
+ * holds the kernel, its packed arguments and its iteration range
+ *
+ */
+typedef struct DPCTLOpaqueSyclKernelLaunch *DPCTLSyclKernelLaunchRef;
+
 /*!
  * @brief Opaque pointer to a ``sycl::platform``
  *
@@ -29,13 +29,18 @@
 #include "Config/dpctl_config.h"
 #include "dpctl_dynamic_lib_helper.h"
 #include "dpctl_error_handlers.h"
+#include "dpctl_program_cache.hpp"
+#include "dpctl_string_utils.hpp"
 #include "dpctl_sycl_type_casters.hpp"
 #include <CL/cl.h> /* OpenCL headers     */
+#include <cstring>
 #include <sstream>
 #include <stddef.h>
+#include <string>
 #include <sycl/backend/opencl.hpp>
 #include <sycl/sycl.hpp> /* Sycl headers       */
 #include <utility>
+#include <vector>
 
 #ifdef DPCTL_ENABLE_L0_PROGRAM_CREATION
 // Note: include ze_api.h before level_zero.hpp. Make sure clang-format does
@@ -129,6 +134,37 @@ clCreateProgramWithILFT get_clCreateProgramWithIL()
 
     return st_clCreateProgramWithILF;
 }
+typedef cl_program (*clCreateProgramWithBinaryFT)(cl_context,
+                                                  cl_uint,
+                                                  const cl_device_id *,
+                                                  const size_t *,
+                                                  const unsigned char **,
+                                                  cl_int *,
+                                                  cl_int *);
+const char *clCreateProgramWithBinary_Name = "clCreateProgramWithBinary";
+clCreateProgramWithBinaryFT get_clCreateProgramWithBinary()
+{
+    static auto st_clCreateProgramWithBinaryF =
+        cl_loader::get().getSymbol<clCreateProgramWithBinaryFT>(
+            clCreateProgramWithBinary_Name);
+
+    return st_clCreateProgramWithBinaryF;
+}
+
+typedef cl_int (*clGetProgramInfoFT)(cl_program,
+                                     cl_program_info,
+                                     size_t,
+                                     void *,
+                                     size_t *);
+const char *clGetProgramInfo_Name = "clGetProgramInfo";
+clGetProgramInfoFT get_clGetProgramInfo()
+{
+    static auto st_clGetProgramInfoF =
+        cl_loader::get().getSymbol<clGetProgramInfoFT>(clGetProgramInfo_Name);
+
+    return st_clGetProgramInfoF;
+}
+
 typedef cl_int (*clBuildProgramFT)(cl_program,
                                    cl_uint,
                                    const cl_device_id *,
@@ -144,6 +180,16 @@ clBuildProgramFT get_clBuldProgram()
     return st_clBuildProgramF;
 }
 
+typedef cl_int (*clReleaseProgramFT)(cl_program);
+const char *clReleaseProgram_Name = "clReleaseProgram";
+clReleaseProgramFT get_clReleaseProgram()
+{
+    static auto st_clReleaseProgramF =
+        cl_loader::get().getSymbol<clReleaseProgramFT>(clReleaseProgram_Name);
+
+    return st_clReleaseProgramF;
+}
+
 typedef cl_kernel (*clCreateKernelFT)(cl_program, const char *, cl_int *);
 const char *clCreateKernel_Name = "clCreateKernel";
 clCreateKernelFT get_clCreateKernel()
@@ -154,6 +200,21 @@ clCreateKernelFT get_clCreateKernel()
     return st_clCreateKernelF;
 }
 
+/*!
+ * @brief Returns a string identifying the device, its platform and driver,
+ * used as part of keys of the program binary cache.
+ */
+std::string _GetProgramCacheDeviceId(const device &dev)
+{
+    std::ostringstream os;
+    const platform &p = dev.get_platform();
+    os << p.get_backend() << ";" << p.get_info<info::platform::name>() << ";"
+       << dev.get_info<info::device::name>() << ";"
+       << dev.get_info<info::device::version>() << ";"
+       << dev.get_info<info::device::driver_version>();
+    return os.str();
+}
+
 std::string _GetErrorCode_ocl_impl(cl_int code)
 {
     switch (code) {
@@ -170,11 +231,66 @@ std::string _GetErrorCode_ocl_impl(cl_int code)
     }
 }
 
+/*!
+ * @brief Stores the binary of program `clProgram` built for device
+ * `clDevice` in the program binary cache.
+ */
+void _StoreProgramBinary_ocl_impl(cl_program clProgram,
+                                  cl_device_id clDevice,
+                                  const std::string &CacheKey)
+{
+    auto clGetProgramInfoF = get_clGetProgramInfo();
+    if (clGetProgramInfoF == nullptr) {
+        return;
+    }
+
+    cl_uint n_devices = 0;
+    if (clGetProgramInfoF(clProgram, CL_PROGRAM_NUM_DEVICES, sizeof(cl_uint),
+                          &n_devices, nullptr) != CL_SUCCESS ||
+        n_devices == 0)
+    {
+        return;
+    }
+    std::vector<cl_device_id> devices(n_devices);
+    std::vector<size_t> sizes(n_devices);
+    if (clGetProgramInfoF(clProgram, CL_PROGRAM_DEVICES,
+                          n_devices * sizeof(cl_device_id), devices.data(),
+                          nullptr) != CL_SUCCESS ||
+        clGetProgramInfoF(clProgram, CL_PROGRAM_BINARY_SIZES,
+                          n_devices * sizeof(size_t), sizes.data(),
+                          nullptr) != CL_SUCCESS)
+    {
+        return;
+    }
+
+    // only the binary for the device the program was built for is needed,
+    // null pointers make the runtime skip binaries of other devices
+    std::vector<unsigned char> binary;
+    std::vector<unsigned char *> binary_ptrs(n_devices, nullptr);
+    for (cl_uint i = 0; i < n_devices; ++i) {
+        if (devices[i] == clDevice && sizes[i] > 0) {
+            binary.resize(sizes[i]);
+            binary_ptrs[i] = binary.data();
+            break;
+        }
+    }
+    if (binary.empty() ||
+        clGetProgramInfoF(clProgram, CL_PROGRAM_BINARIES,
+                          n_devices * sizeof(unsigned char *),
+                          binary_ptrs.data(), nullptr) != CL_SUCCESS)
+    {
+        return;
+    }
+
+    dpctl::helper::ProgramBinaryCache::get().store(CacheKey, binary);
+}
+
 DPCTLSyclKernelBundleRef
 _CreateKernelBundle_common_ocl_impl(cl_program clProgram,
                                     const context &ctx,
                                     const device &dev,
-                                    const char *CompileOpts)
+                                    const char *CompileOpts,
+                                    const std::string &CacheKey)
 {
     backend_traits<cl_be>::return_type<device> clDevice;
     clDevice = get_native<cl_be>(dev);
@@ -195,6 +311,73 @@ _CreateKernelBundle_common_ocl_impl(cl_program clProgram,
         return nullptr;
     }
 
+    _StoreProgramBinary_ocl_impl(clProgram, clDevice, CacheKey);
+
+    using ekbTy = kernel_bundle<bundle_state::executable>;
+    const ekbTy &kb =
+        make_kernel_bundle<cl_be, bundle_state::executable>(clProgram, ctx);
+    return wrap<ekbTy>(new ekbTy(kb));
+}
+
+/*!
+ * @brief Creates kernel bundle from program binary found in the program
+ * binary cache for key `CacheKey`.
+ *
+ * Returns NULL without reporting an error if no binary is cached, or if the
+ * cached binary is rejected by the driver, so that callers can fall back to
+ * building the program from its source.
+ */
+DPCTLSyclKernelBundleRef
+_CreateKernelBundleFromCache_ocl_impl(const context &ctx,
+                                      const device &dev,
+                                      const char *CompileOpts,
+                                      const std::string &CacheKey)
+{
+    auto &cache = dpctl::helper::ProgramBinaryCache::get();
+    std::vector<unsigned char> binary;
+    if (!cache.lookup(CacheKey, binary)) {
+        return nullptr;
+    }
+
+    auto clCreateProgramWithBinaryF = get_clCreateProgramWithBinary();
+    auto clBuildProgramF = get_clBuldProgram();
+    auto clReleaseProgramF = get_clReleaseProgram();
+    if (clCreateProgramWithBinaryF == nullptr || clBuildProgramF == nullptr ||
+        clReleaseProgramF == nullptr)
+    {
+        return nullptr;
+    }
+
+    backend_traits<cl_be>::return_type<context> clContext;
+    clContext = get_native<cl_be>(ctx);
+    backend_traits<cl_be>::return_type<device> clDevice;
+    clDevice = get_native<cl_be>(dev);
+
+    const size_t binary_size = binary.size();
+    const unsigned char *binary_ptr = binary.data();
+    cl_int binary_status = CL_SUCCESS;
+    cl_int create_err_code = CL_SUCCESS;
+    cl_program clProgram = clCreateProgramWithBinaryF(
+        clContext, 1, &clDevice, &binary_size, &binary_ptr, &binary_status,
+        &create_err_code);
+    if (create_err_code != CL_SUCCESS) {
+        cache.reject(CacheKey);
+        return nullptr;
+    }
+    if (binary_status != CL_SUCCESS) {
+        clReleaseProgramF(clProgram);
+        cache.reject(CacheKey);
+        return nullptr;
+    }
+
+    cl_int build_status =
+        clBuildProgramF(clProgram, 1, &clDevice, CompileOpts, nullptr, nullptr);
+    if (build_status != CL_SUCCESS) {
+        clReleaseProgramF(clProgram);
+        cache.reject(CacheKey);
+        return nullptr;
+    }
+
     using ekbTy = kernel_bundle<bundle_state::executable>;
     const ekbTy &kb =
         make_kernel_bundle<cl_be, bundle_state::executable>(clProgram, ctx);
@@ -207,6 +390,15 @@ _CreateKernelBundleWithOCLSource_ocl_impl(const context &ctx,
                                           const char *oclSrc,
                                           const char *CompileOpts)
 {
+    const std::string &CacheKey = dpctl::helper::ProgramBinaryCache::make_key(
+        "ocl-src", oclSrc, std::strlen(oclSrc), CompileOpts,
+        _GetProgramCacheDeviceId(dev));
+    auto CachedKBRef =
+        _CreateKernelBundleFromCache_ocl_impl(ctx, dev, CompileOpts, CacheKey);
+    if (CachedKBRef) {
+        return CachedKBRef;
+    }
+
     auto clCreateProgramWithSourceF = get_clCreateProgramWithSource();
     if (clCreateProgramWithSourceF == nullptr) {
         return nullptr;
@@ -227,7 +419,7 @@ _CreateKernelBundleWithOCLSource_ocl_impl(const context &ctx,
     }
 
     return _CreateKernelBundle_common_ocl_impl(clProgram, ctx, dev,
-                                               CompileOpts);
+                                               CompileOpts, CacheKey);
 }
 
 DPCTLSyclKernelBundleRef
@@ -237,6 +429,14 @@ _CreateKernelBundleWithIL_ocl_impl(const context &ctx,
                                    size_t il_length,
                                    const char *CompileOpts)
 {
+    const std::string &CacheKey = dpctl::helper::ProgramBinaryCache::make_key(
+        "spirv", IL, il_length, CompileOpts, _GetProgramCacheDeviceId(dev));
+    auto CachedKBRef =
+        _CreateKernelBundleFromCache_ocl_impl(ctx, dev, CompileOpts, CacheKey);
+    if (CachedKBRef) {
+        return CachedKBRef;
+    }
+
     auto clCreateProgramWithILF = get_clCreateProgramWithIL();
     if (clCreateProgramWithILF == nullptr) {
         return nullptr;
@@ -258,7 +458,7 @@ _CreateKernelBundleWithIL_ocl_impl(const context &ctx,
     }
 
     return _CreateKernelBundle_common_ocl_impl(clProgram, ctx, dev,
-                                               CompileOpts);
+                                               CompileOpts, CacheKey);
 }
 
 bool _HasKernel_ocl_impl(const kernel_bundle<bundle_state::executable> &kb,
@@ -392,6 +592,19 @@ zeModuleDestroyFT get_zeModuleDestroy()
     return st_zeModuleDestroyF;
 }
 
+typedef ze_result_t (*zeModuleGetNativeBinaryFT)(ze_module_handle_t,
+                                                 size_t *,
+                                                 uint8_t *);
+const char *zeModuleGetNativeBinary_Name = "zeModuleGetNativeBinary";
+zeModuleGetNativeBinaryFT get_zeModuleGetNativeBinary()
+{
+    static auto st_zeModuleGetNativeBinaryF =
+        ze_loader::get().getSymbol<zeModuleGetNativeBinaryFT>(
+            zeModuleGetNativeBinary_Name);
+
+    return st_zeModuleGetNativeBinaryF;
+}
+
 typedef ze_result_t (*zeKernelCreateFT)(ze_module_handle_t,
                                         const ze_kernel_desc_t *,
                                         ze_kernel_handle_t *);
@@ -458,13 +671,52 @@ _CreateKernelBundleWithIL_ze_impl(const context &SyclCtx,
 
     ze_module_handle_t ZeModule;
 
-    auto ret_code = zeModuleCreateFn(ZeContext, ZeDevice, &ZeModuleDesc,
-                                     &ZeModule, nullptr);
-    if (ret_code != ZE_RESULT_SUCCESS) {
-        error_handler("Module creation failed " +
-                          _GetErrorCode_ze_impl(ret_code),
-                      __FILE__, __func__, __LINE__);
-        return nullptr;
+    auto &cache = dpctl::helper::ProgramBinaryCache::get();
+    const std::string &CacheKey = dpctl::helper::ProgramBinaryCache::make_key(
+        "spirv", IL, il_length, CompileOpts, _GetProgramCacheDeviceId(SyclDev));
+
+    // native binaries are device specific, if the cached binary is rejected
+    // the module is built from SPIR-V
+    bool from_native_binary = false;
+    std::vector<unsigned char> NativeBinary;
+    if (cache.lookup(CacheKey, NativeBinary)) {
+        ze_module_desc_t ZeNativeModuleDesc = ZeModuleDesc;
+        ZeNativeModuleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+        ZeNativeModuleDesc.inputSize = NativeBinary.size();
+        ZeNativeModuleDesc.pInputModule = NativeBinary.data();
+        from_native_binary =
+            (zeModuleCreateFn(ZeContext, ZeDevice, &ZeNativeModuleDesc,
+                              &ZeModule, nullptr) == ZE_RESULT_SUCCESS);
+        if (!from_native_binary) {
+            cache.reject(CacheKey);
+        }
+    }
+
+    if (!from_native_binary) {
+        auto ret_code = zeModuleCreateFn(ZeContext, ZeDevice, &ZeModuleDesc,
+                                         &ZeModule, nullptr);
+        if (ret_code != ZE_RESULT_SUCCESS) {
+            error_handler("Module creation failed " +
+                              _GetErrorCode_ze_impl(ret_code),
+                          __FILE__, __func__, __LINE__);
+            return nullptr;
+        }
+
+        auto zeModuleGetNativeBinaryFn = get_zeModuleGetNativeBinary();
+        size_t NativeBinarySize = 0;
+        if (zeModuleGetNativeBinaryFn &&
+            zeModuleGetNativeBinaryFn(ZeModule, &NativeBinarySize, nullptr) ==
+                ZE_RESULT_SUCCESS &&
+            NativeBinarySize > 0)
+        {
+            NativeBinary.resize(NativeBinarySize);
+            if (zeModuleGetNativeBinaryFn(ZeModule, &NativeBinarySize,
+                                          NativeBinary.data()) ==
+                ZE_RESULT_SUCCESS)
+            {
+                cache.store(CacheKey, NativeBinary);
+            }
+        }
     }
 
     try {
@@ -761,3 +1013,57 @@ DPCTLKernelBundle_Copy(__dpctl_keep const DPCTLSyclKernelBundleRef KBRef)
         return nullptr;
     }
 }
+
+void DPCTLKernelBundle_SetProgramCacheDir(__dpctl_keep const char *Dir)
+{
+    dpctl::helper::ProgramBinaryCache::get().set_directory(
+        (Dir) ? std::string(Dir) : std::string{});
+}
+
+__dpctl_give const char *DPCTLKernelBundle_GetProgramCacheDir(void)
+{
+    return dpctl::helper::cstring_from_string(
+        dpctl::helper::ProgramBinaryCache::get().get_directory());
+}
+
+void DPCTLKernelBundle_SetProgramCacheLimits(size_t MemoryLimit,
+                                             size_t DiskLimit)
+{
+    dpctl::helper::ProgramBinaryCache::get().set_limits(MemoryLimit,
+                                                        DiskLimit);
+}
+
+size_t DPCTLKernelBundle_GetProgramCacheMemoryLimit(void)
+{
+    return dpctl::helper::ProgramBinaryCache::get().get_memory_limit();
+}
+
+size_t DPCTLKernelBundle_GetProgramCacheDiskLimit(void)
+{
+    return dpctl::helper::ProgramBinaryCache::get().get_disk_limit();
+}
+
+void DPCTLKernelBundle_ClearProgramCache(bool ClearDisk)
+{
+    dpctl::helper::ProgramBinaryCache::get().clear(ClearDisk);
+}
+
+size_t DPCTLKernelBundle_GetProgramCacheMemoryHits(void)
+{
+    return dpctl::helper::ProgramBinaryCache::get().get_stats().memory_hits;
+}
+
+size_t DPCTLKernelBundle_GetProgramCacheDiskHits(void)
+{
+    return dpctl::helper::ProgramBinaryCache::get().get_stats().disk_hits;
+}
+
+size_t DPCTLKernelBundle_GetProgramCacheMisses(void)
+{
+    return dpctl::helper::ProgramBinaryCache::get().get_stats().misses;
+}
+
+size_t DPCTLKernelBundle_GetProgramCacheRejected(void)
+{
+    return dpctl::helper::ProgramBinaryCache::get().get_stats().rejected;
+}
@@ -36,11 +36,15 @@
 #include <stdint.h>
 
 #include <cstdint>
+#include <cstring>
 #include <exception>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
+#include <string>
 #include <sycl/sycl.hpp> /* SYCL headers   */
 #include <utility>
+#include <vector>
 
 #if defined(SYCL_EXT_ONEAPI_WORK_GROUP_MEMORY) ||                              \
     defined(SYCL_EXT_ONEAPI_RAW_KERNEL_ARG)
@@ -268,6 +272,203 @@ void set_kernel_args(handler &cgh,
     }
 }
 
+struct KernelArgSlot;
+typedef void (*KernelArgSetterFnT)(handler &, size_t, const KernelArgSlot &);
+
+/*!
+ * @brief Kernel argument packed by value, together with the function that
+ * sets it on a command group handler without inspecting its type.
+ */
+struct KernelArgSlot
+{
+    DPCTLKernelArgType type;
+    KernelArgSetterFnT setter;
+    // bits of a scalar argument
+    std::uint64_t scalar;
+    // USM pointer, or reference to a work-group memory or raw argument
+    void *ptr;
+    MDLocalAccessor accessor;
+};
+
+template <typename T>
+void set_scalar_arg(handler &cgh, size_t idx, const KernelArgSlot &slot)
+{
+    T v;
+    std::memcpy(&v, &slot.scalar, sizeof(T));
+    cgh.set_arg(idx, v);
+}
+
+void set_pointer_arg(handler &cgh, size_t idx, const KernelArgSlot &slot)
+{
+    cgh.set_arg(idx, slot.ptr);
+}
+
+void set_local_accessor_slot_arg(handler &cgh,
+                                 size_t idx,
+                                 const KernelArgSlot &slot)
+{
+    // the accessor was validated when it was packed
+    set_local_accessor_arg(cgh, idx, &slot.accessor);
+}
+
+void set_extension_arg(handler &cgh, size_t idx, const KernelArgSlot &slot)
+{
+    if (!set_kernel_arg(cgh, idx, slot.ptr, slot.type)) {
+        throw std::invalid_argument("Kernel argument could not be created.");
+    }
+}
+
+template <typename T>
+void pack_scalar_arg(KernelArgSlot &slot, __dpctl_keep const void *Arg)
+{
+    static_assert(sizeof(T) <= sizeof(slot.scalar));
+    slot.scalar = 0;
+    std::memcpy(&slot.scalar, Arg, sizeof(T));
+    slot.setter = &set_scalar_arg<T>;
+}
+
+bool is_local_accessor_elem_type(DPCTLKernelArgType ArgTy)
+{
+    switch (ArgTy) {
+    case DPCTL_INT8_T:
+    case DPCTL_UINT8_T:
+    case DPCTL_INT16_T:
+    case DPCTL_UINT16_T:
+    case DPCTL_INT32_T:
+    case DPCTL_UINT32_T:
+    case DPCTL_INT64_T:
+    case DPCTL_UINT64_T:
+    case DPCTL_FLOAT32_T:
+    case DPCTL_FLOAT64_T:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/*!
+ * @brief Validates kernel argument `Arg` of type `ArgTy` and packs it into
+ * `slot`.
+ *
+ * @return   True if the argument type is supported, false otherwise.
+ */
+bool pack_kernel_arg(KernelArgSlot &slot,
+                     __dpctl_keep void *Arg,
+                     DPCTLKernelArgType ArgTy)
+{
+    switch (ArgTy) {
+    case DPCTL_INT8_T:
+        pack_scalar_arg<std::int8_t>(slot, Arg);
+        break;
+    case DPCTL_UINT8_T:
+        pack_scalar_arg<std::uint8_t>(slot, Arg);
+        break;
+    case DPCTL_INT16_T:
+        pack_scalar_arg<std::int16_t>(slot, Arg);
+        break;
+    case DPCTL_UINT16_T:
+        pack_scalar_arg<std::uint16_t>(slot, Arg);
+        break;
+    case DPCTL_INT32_T:
+        pack_scalar_arg<std::int32_t>(slot, Arg);
+        break;
+    case DPCTL_UINT32_T:
+        pack_scalar_arg<std::uint32_t>(slot, Arg);
+        break;
+    case DPCTL_INT64_T:
+        pack_scalar_arg<std::int64_t>(slot, Arg);
+        break;
+    case DPCTL_UINT64_T:
+        pack_scalar_arg<std::uint64_t>(slot, Arg);
+        break;
+    case DPCTL_FLOAT32_T:
+        pack_scalar_arg<float>(slot, Arg);
+        break;
+    case DPCTL_FLOAT64_T:
+        pack_scalar_arg<double>(slot, Arg);
+        break;
+    case DPCTL_VOID_PTR:
+        slot.ptr = Arg;
+        slot.setter = &set_pointer_arg;
+        break;
+    case DPCTL_LOCAL_ACCESSOR:
+    {
+        const MDLocalAccessor *mdstruct = (const MDLocalAccessor *)Arg;
+        if (!mdstruct || mdstruct->ndim < 1 || mdstruct->ndim > 3 ||
+            !is_local_accessor_elem_type(mdstruct->dpctl_type_id))
+        {
+            return false;
+        }
+        slot.accessor = *mdstruct;
+        slot.setter = &set_local_accessor_slot_arg;
+        break;
+    }
+#ifdef SYCL_EXT_ONEAPI_WORK_GROUP_MEMORY
+    case DPCTL_WORK_GROUP_MEMORY:
+#endif
+#ifdef SYCL_EXT_ONEAPI_RAW_KERNEL_ARG
+    case DPCTL_RAW_KERNEL_ARG:
+#endif
+#if defined(SYCL_EXT_ONEAPI_WORK_GROUP_MEMORY) ||                              \
+    defined(SYCL_EXT_ONEAPI_RAW_KERNEL_ARG)
+        if (!Arg) {
+            return false;
+        }
+        slot.ptr = Arg;
+        slot.setter = &set_extension_arg;
+        break;
+#endif
+    default:
+        return false;
+    }
+    slot.type = ArgTy;
+    return true;
+}
+
+/*!
+ * @brief Kernel with its packed arguments and iteration range, submitted
+ * repeatedly by DPCTLKernelLaunch_Submit.
+ */
+struct KernelLaunch
+{
+    typedef void (*LaunchFnT)(handler &, const KernelLaunch &);
+
+    kernel krn;
+    std::vector<KernelArgSlot> args;
+    size_t gRange[3];
+    size_t lRange[3];
+    LaunchFnT launch_fn;
+};
+
+DEFINE_SIMPLE_CONVERSION_FUNCTIONS(KernelLaunch, DPCTLSyclKernelLaunchRef)
+
+template <int Dims> range<Dims> make_range(const size_t (&R)[3])
+{
+    if constexpr (Dims == 1) {
+        return range<1>{R[0]};
+    }
+    else if constexpr (Dims == 2) {
+        return range<2>{R[0], R[1]};
+    }
+    else {
+        return range<3>{R[0], R[1], R[2]};
+    }
+}
+
+template <int Dims>
+void launch_range(handler &cgh, const KernelLaunch &launch)
+{
+    cgh.parallel_for(make_range<Dims>(launch.gRange), launch.krn);
+}
+
+template <int Dims>
+void launch_nd_range(handler &cgh, const KernelLaunch &launch)
+{
+    cgh.parallel_for(nd_range<Dims>{make_range<Dims>(launch.gRange),
+                                    make_range<Dims>(launch.lRange)},
+                     launch.krn);
+}
+
 std::unique_ptr<property_list> create_property_list(int properties)
 {
     std::unique_ptr<property_list> propList;
@@ -619,6 +820,154 @@ DPCTLQueue_SubmitNDRange(__dpctl_keep const DPCTLSyclKernelRef KRef,
     }
 }
 
+__dpctl_give DPCTLSyclKernelLaunchRef
+DPCTLKernelLaunch_Create(__dpctl_keep const DPCTLSyclKernelRef KRef,
+                         __dpctl_keep void **Args,
+                         __dpctl_keep const DPCTLKernelArgType *ArgTypes,
+                         size_t NArgs,
+                         __dpctl_keep const size_t gRange[3],
+                         __dpctl_keep const size_t lRange[3],
+                         size_t NDims)
+{
+    auto Kernel = unwrap<kernel>(KRef);
+    if (!Kernel) {
+        error_handler("Cannot prepare launch of a NULL kernel.", __FILE__,
+                      __func__, __LINE__);
+        return nullptr;
+    }
+    if (NArgs > 0 && (!Args || !ArgTypes)) {
+        error_handler("Kernel arguments or their types are NULL.", __FILE__,
+                      __func__, __LINE__);
+        return nullptr;
+    }
+    if (!gRange || NDims < 1 || NDims > 3) {
+        error_handler("Range must have between one and three dimensions.",
+                      __FILE__, __func__, __LINE__);
+        return nullptr;
+    }
+
+    try {
+        auto Launch = std::unique_ptr<KernelLaunch>(new KernelLaunch{
+            *Kernel, std::vector<KernelArgSlot>(NArgs), {1, 1, 1}, {1, 1, 1},
+            nullptr});
+        for (size_t i = 0; i < NArgs; ++i) {
+            if (!pack_kernel_arg(Launch->args[i], Args[i], ArgTypes[i])) {
+                error_handler("Kernel argument " + std::to_string(i) +
+                                  " could not be created.",
+                              __FILE__, __func__, __LINE__);
+                return nullptr;
+            }
+        }
+        for (size_t d = 0; d < NDims; ++d) {
+            Launch->gRange[d] = gRange[d];
+            if (lRange) {
+                Launch->lRange[d] = lRange[d];
+            }
+        }
+        switch (NDims) {
+        case 1:
+            Launch->launch_fn =
+                (lRange) ? &launch_nd_range<1> : &launch_range<1>;
+            break;
+        case 2:
+            Launch->launch_fn =
+                (lRange) ? &launch_nd_range<2> : &launch_range<2>;
+            break;
+        default:
+            Launch->launch_fn =
+                (lRange) ? &launch_nd_range<3> : &launch_range<3>;
+            break;
+        }
+        return wrap<KernelLaunch>(Launch.release());
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__);
+        return nullptr;
+    }
+}
+
+bool DPCTLKernelLaunch_SetArg(__dpctl_keep DPCTLSyclKernelLaunchRef LRef,
+                              size_t Idx,
+                              __dpctl_keep void *Arg,
+                              DPCTLKernelArgType ArgTy)
+{
+    auto Launch = unwrap<KernelLaunch>(LRef);
+    if (!Launch) {
+        error_handler("Input LRef is nullptr", __FILE__, __func__, __LINE__);
+        return false;
+    }
+    if (Idx >= Launch->args.size()) {
+        error_handler("Kernel argument index " + std::to_string(Idx) +
+                          " is out of range.",
+                      __FILE__, __func__, __LINE__);
+        return false;
+    }
+    KernelArgSlot &slot = Launch->args[Idx];
+    if (slot.type != ArgTy) {
+        error_handler("Type of kernel argument " + std::to_string(Idx) +
+                          " differs from the prepared type.",
+                      __FILE__, __func__, __LINE__);
+        return false;
+    }
+    if (!pack_kernel_arg(slot, Arg, ArgTy)) {
+        error_handler("Kernel argument could not be created.", __FILE__,
+                      __func__, __LINE__);
+        return false;
+    }
+    return true;
+}
+
+size_t
+DPCTLKernelLaunch_GetNumArgs(__dpctl_keep const DPCTLSyclKernelLaunchRef LRef)
+{
+    auto Launch = unwrap<KernelLaunch>(LRef);
+    if (!Launch) {
+        error_handler("Input LRef is nullptr", __FILE__, __func__, __LINE__);
+        return 0;
+    }
+    return Launch->args.size();
+}
+
+__dpctl_give DPCTLSyclEventRef
+DPCTLKernelLaunch_Submit(__dpctl_keep const DPCTLSyclKernelLaunchRef LRef,
+                         __dpctl_keep const DPCTLSyclQueueRef QRef,
+                         __dpctl_keep const DPCTLSyclEventRef *DepEvents,
+                         size_t NDepEvents)
+{
+    auto Launch = unwrap<KernelLaunch>(LRef);
+    auto Queue = unwrap<queue>(QRef);
+    if (!Launch || !Queue) {
+        error_handler("Input LRef or QRef is nullptr", __FILE__, __func__,
+                      __LINE__);
+        return nullptr;
+    }
+
+    try {
+        event e = Queue->submit([&](handler &cgh) {
+            // Depend on any event that was specified by the caller.
+            set_dependent_events(cgh, DepEvents, NDepEvents);
+            const size_t n_args = Launch->args.size();
+            for (size_t i = 0; i < n_args; ++i) {
+                const KernelArgSlot &slot = Launch->args[i];
+                slot.setter(cgh, i, slot);
+            }
+            Launch->launch_fn(cgh, *Launch);
+        });
+        return wrap<event>(new event(std::move(e)));
+    } catch (std::exception const &e) {
+        error_handler(e, __FILE__, __func__, __LINE__, error_level::error);
+        return nullptr;
+    } catch (...) {
+        error_handler("Unknown exception encountered", __FILE__, __func__,
+                      __LINE__, error_level::error);
+        return nullptr;
+    }
+}
+
+void DPCTLKernelLaunch_Delete(__dpctl_take DPCTLSyclKernelLaunchRef LRef)
+{
+    delete unwrap<KernelLaunch>(LRef);
+}
+
 void DPCTLQueue_Wait(__dpctl_keep DPCTLSyclQueueRef QRef)
 {
     // \todo what happens if the QRef is null or a pointer to a valid sycl
@@ -33,12 +33,14 @@
 #include "dpctl_sycl_kernel_bundle_interface.h"
 #include "dpctl_sycl_kernel_interface.h"
 #include "dpctl_sycl_queue_interface.h"
+#include "dpctl_utils.h"
 
 #include <stddef.h>
 
 #include <array>
 #include <filesystem>
 #include <fstream>
+#include <string>
 #include <gtest/gtest.h>
 #include <sycl/sycl.hpp>
 
@@ -104,6 +106,46 @@ TEST_P(TestDPCTLSyclKernelBundleInterface, ChkCreateFromSpirv)
     ASSERT_FALSE(DPCTLKernelBundle_HasKernel(KBRef, nullptr));
 }
 
+TEST_P(TestDPCTLSyclKernelBundleInterface, ChkCreateFromSpirvDiskCache)
+{
+    const char *SavedDir = DPCTLKernelBundle_GetProgramCacheDir();
+    ASSERT_TRUE(SavedDir != nullptr);
+    const std::string CacheDir = (std::filesystem::temp_directory_path() /
+                                  "dpctl_test_program_cache_spirv")
+                                     .string();
+    std::filesystem::remove_all(CacheDir);
+    DPCTLKernelBundle_SetProgramCacheDir(CacheDir.c_str());
+    DPCTLKernelBundle_ClearProgramCache(false);
+
+    // the first build misses the cache and persists the binary
+    size_t Misses = DPCTLKernelBundle_GetProgramCacheMisses();
+    auto KBRef1 = DPCTLKernelBundle_CreateFromSpirv(
+        CRef, DRef, spirvBuffer.data(), spirvFileSize, nullptr);
+    ASSERT_TRUE(KBRef1 != nullptr);
+    EXPECT_EQ(DPCTLKernelBundle_GetProgramCacheMisses(), Misses + 1);
+    DPCTLKernelBundle_Delete(KBRef1);
+
+    // with the in-memory cache dropped the binary must be loaded from disk
+    DPCTLKernelBundle_ClearProgramCache(false);
+    size_t DiskHits = DPCTLKernelBundle_GetProgramCacheDiskHits();
+    size_t Rejected = DPCTLKernelBundle_GetProgramCacheRejected();
+    Misses = DPCTLKernelBundle_GetProgramCacheMisses();
+    auto KBRef2 = DPCTLKernelBundle_CreateFromSpirv(
+        CRef, DRef, spirvBuffer.data(), spirvFileSize, nullptr);
+    ASSERT_TRUE(KBRef2 != nullptr);
+    EXPECT_TRUE(DPCTLKernelBundle_HasKernel(KBRef2, "add"));
+    EXPECT_TRUE(DPCTLKernelBundle_HasKernel(KBRef2, "axpy"));
+    EXPECT_EQ(DPCTLKernelBundle_GetProgramCacheDiskHits(), DiskHits + 1);
+    EXPECT_EQ(DPCTLKernelBundle_GetProgramCacheMisses(), Misses);
+    EXPECT_EQ(DPCTLKernelBundle_GetProgramCacheRejected(), Rejected);
+    DPCTLKernelBundle_Delete(KBRef2);
+
+    DPCTLKernelBundle_ClearProgramCache(true);
+    DPCTLKernelBundle_SetProgramCacheDir(SavedDir);
+    DPCTLCString_Delete(SavedDir);
+    std::filesystem::remove_all(CacheDir);
+}
+
 TEST_P(TestDPCTLSyclKernelBundleInterface, ChkCopy)
 {
     DPCTLSyclKernelBundleRef Copied_KBRef = nullptr;
@@ -355,3 +397,36 @@ TEST_F(TestKernelBundleUnsupportedBackend, CheckCreateFromSpirv)
             CRef, DRef, spirvBuffer.data(), spirvFileSize, nullptr));
     ASSERT_TRUE(KBRef == nullptr);
 }
+
+TEST(TestKernelBundleProgramCache, ChkSetGetCacheSettings)
+{
+    const char *SavedDir = DPCTLKernelBundle_GetProgramCacheDir();
+    ASSERT_TRUE(SavedDir != nullptr);
+    size_t SavedMemLimit = DPCTLKernelBundle_GetProgramCacheMemoryLimit();
+    size_t SavedDiskLimit = DPCTLKernelBundle_GetProgramCacheDiskLimit();
+
+    const std::string CacheDir =
+        (std::filesystem::temp_directory_path() / "dpctl_test_program_cache")
+            .string();
+    EXPECT_NO_FATAL_FAILURE(
+        DPCTLKernelBundle_SetProgramCacheDir(CacheDir.c_str()));
+    const char *Dir = DPCTLKernelBundle_GetProgramCacheDir();
+    ASSERT_TRUE(Dir != nullptr);
+    EXPECT_EQ(std::string(Dir), CacheDir);
+    DPCTLCString_Delete(Dir);
+
+    EXPECT_NO_FATAL_FAILURE(DPCTLKernelBundle_SetProgramCacheDir(nullptr));
+    Dir = DPCTLKernelBundle_GetProgramCacheDir();
+    ASSERT_TRUE(Dir != nullptr);
+    EXPECT_EQ(std::string(Dir), std::string{});
+    DPCTLCString_Delete(Dir);
+
+    EXPECT_NO_FATAL_FAILURE(DPCTLKernelBundle_SetProgramCacheLimits(1024, 0));
+    EXPECT_EQ(DPCTLKernelBundle_GetProgramCacheMemoryLimit(), size_t(1024));
+    EXPECT_EQ(DPCTLKernelBundle_GetProgramCacheDiskLimit(), size_t(0));
+    EXPECT_NO_FATAL_FAILURE(DPCTLKernelBundle_ClearProgramCache(false));
+
+    DPCTLKernelBundle_SetProgramCacheLimits(SavedMemLimit, SavedDiskLimit);
+    DPCTLKernelBundle_SetProgramCacheDir(SavedDir);
+    DPCTLCString_Delete(SavedDir);
+}
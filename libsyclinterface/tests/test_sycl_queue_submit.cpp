@@ -387,6 +387,88 @@ TEST_F(TestQueueSubmit, CheckForUnsupportedArgTy)
     ASSERT_TRUE(ERef == nullptr);
 }
 
+TEST_F(TestQueueSubmit, CheckPreparedLaunch)
+{
+    std::int32_t scalarVal = 3;
+    std::size_t Range[] = {SIZE};
+    static constexpr std::size_t RANGE_NDIMS = 1;
+    static constexpr std::size_t NARGS = 4;
+
+    auto kernel = DPCTLKernelBundle_GetKernel(KBRef, "_ZTS11RangeKernelIiE");
+    ASSERT_TRUE(kernel != nullptr);
+    auto a = DPCTLmalloc_shared(SIZE * sizeof(std::int32_t), QRef);
+    ASSERT_TRUE(a != nullptr);
+    auto b = DPCTLmalloc_shared(SIZE * sizeof(std::int32_t), QRef);
+    ASSERT_TRUE(b != nullptr);
+    auto c = DPCTLmalloc_shared(SIZE * sizeof(std::int32_t), QRef);
+    ASSERT_TRUE(c != nullptr);
+
+    void *args[NARGS] = {unwrap<void>(a), unwrap<void>(b), unwrap<void>(c),
+                         (void *)&scalarVal};
+    DPCTLKernelArgType argTypes[] = {DPCTL_VOID_PTR, DPCTL_VOID_PTR,
+                                     DPCTL_VOID_PTR, DPCTL_INT32_T};
+    DPCTLSyclKernelLaunchRef LRef = DPCTLKernelLaunch_Create(
+        kernel, args, argTypes, NARGS, Range, nullptr, RANGE_NDIMS);
+    ASSERT_TRUE(LRef != nullptr);
+    EXPECT_EQ(DPCTLKernelLaunch_GetNumArgs(LRef), NARGS);
+
+    // the scalar is packed by value when the launch is prepared
+    scalarVal = 7;
+    auto E1Ref = DPCTLKernelLaunch_Submit(LRef, QRef, nullptr, 0);
+    ASSERT_TRUE(E1Ref != nullptr);
+    DPCTLEvent_Wait(E1Ref);
+    auto c_ptr = reinterpret_cast<std::int32_t *>(unwrap<void>(c));
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        ASSERT_EQ(c_ptr[i], 3 * static_cast<std::int32_t>(2 * i + 3));
+    }
+
+    std::int32_t newScalarVal = 5;
+    EXPECT_TRUE(DPCTLKernelLaunch_SetArg(LRef, 3, (void *)&newScalarVal,
+                                         DPCTL_INT32_T));
+    EXPECT_FALSE(DPCTLKernelLaunch_SetArg(LRef, 3, (void *)&newScalarVal,
+                                          DPCTL_INT64_T));
+    EXPECT_FALSE(DPCTLKernelLaunch_SetArg(LRef, NARGS, (void *)&newScalarVal,
+                                          DPCTL_INT32_T));
+    DPCTLSyclEventRef DepEvs[] = {E1Ref};
+    auto E2Ref = DPCTLKernelLaunch_Submit(LRef, QRef, DepEvs, 1);
+    ASSERT_TRUE(E2Ref != nullptr);
+    DPCTLEvent_Wait(E2Ref);
+    for (std::size_t i = 0; i < SIZE; ++i) {
+        ASSERT_EQ(c_ptr[i], 5 * static_cast<std::int32_t>(2 * i + 3));
+    }
+
+    DPCTLEvent_Delete(E1Ref);
+    DPCTLEvent_Delete(E2Ref);
+    DPCTLKernelLaunch_Delete(LRef);
+    DPCTLKernel_Delete(kernel);
+    DPCTLfree_with_queue((DPCTLSyclUSMRef)a, QRef);
+    DPCTLfree_with_queue((DPCTLSyclUSMRef)b, QRef);
+    DPCTLfree_with_queue((DPCTLSyclUSMRef)c, QRef);
+}
+
+TEST_F(TestQueueSubmit, CheckPreparedLaunchUnsupportedArgTy)
+{
+    int scalarVal = 3;
+    std::size_t Range[] = {SIZE};
+    static constexpr std::size_t NARGS = 4;
+
+    auto kernel = DPCTLKernelBundle_GetKernel(KBRef, "_ZTS11RangeKernelIiE");
+    void *args[NARGS] = {unwrap<void>(nullptr), unwrap<void>(nullptr),
+                         unwrap<void>(nullptr), (void *)&scalarVal};
+    DPCTLKernelArgType argTypes[] = {DPCTL_VOID_PTR, DPCTL_VOID_PTR,
+                                     DPCTL_VOID_PTR,
+                                     DPCTL_UNSUPPORTED_KERNEL_ARG};
+    DPCTLSyclKernelLaunchRef LRef = nullptr;
+    EXPECT_NO_FATAL_FAILURE(LRef = DPCTLKernelLaunch_Create(
+                                kernel, args, argTypes, NARGS, Range, nullptr,
+                                1));
+    EXPECT_TRUE(LRef == nullptr);
+    EXPECT_NO_FATAL_FAILURE(LRef = DPCTLKernelLaunch_Create(
+                                kernel, args, argTypes, 3, Range, nullptr, 4));
+    EXPECT_TRUE(LRef == nullptr);
+    DPCTLKernel_Delete(kernel);
+}
+
 struct TestQueueSubmitBarrier : public ::testing::Test
 {
     DPCTLSyclQueueRef QRef = nullptr;
@@ -26,6 +26,7 @@ skbuild.setup(
     packages=[
         "dpctl",
         "dpctl.memory",
+        "dpctl.graph",
         "dpctl.tensor",
         "dpctl.program",
         "dpctl.utils",